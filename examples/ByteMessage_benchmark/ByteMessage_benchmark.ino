@@ -0,0 +1,159 @@
+/*
+  ByteMessage library for Arduino
+
+  This sketch measures the speed of all checksum functions of the library.
+  For each function and each message length, the time per message (in ns)
+  and the number of CPU cycles per byte are printed as comma-separated values.
+  Use the results to pick a checksum algorithm for your platform.
+  This example code is in the public domain.
+*/
+
+// checksum functions
+#include <bm_checksum_fletcher.h>
+#include <bm_checksum_luhn.h>
+#include <bm_checksum_onesum.h>
+#include <bm_checksum_twosum.h>
+#include <bm_checksum_xor.h>
+#include <bm_checksum_crc.h>
+
+// largest message length to benchmark
+// boards with little RAM (e.g. Arduino Uno) cannot hold a 4 KB buffer
+#if !defined(BENCHMARK_MAX_LENGTH)
+    #if defined(RAMEND) && (RAMEND < 0x1000)
+        #define BENCHMARK_MAX_LENGTH 256
+    #else
+        #define BENCHMARK_MAX_LENGTH 4096
+    #endif
+#endif
+
+// number of bytes to process per measurement
+// larger values give more accurate results, but take longer
+#if !defined(BENCHMARK_BYTES_PER_RUN)
+    #define BENCHMARK_BYTES_PER_RUN 65536UL
+#endif
+
+// message lengths to benchmark: 4 bytes, 16 bytes, ..., 4 KB
+const size_t benchmark_lengths[] = {4, 16, 64, 256, 1024, 4096};
+
+// the message buffer, filled with random data in setup()
+uint8_t benchmark_buffer[BENCHMARK_MAX_LENGTH];
+
+// result of last checksum calculation
+// volatile: prevent the compiler from optimizing away the calculations
+volatile uint32_t benchmark_sink;
+
+// Luhn's checksum takes an additional base parameter
+// wrap it to get the common checksum function signature
+uint8_t luhn10_checksum(const uint8_t* data, size_t length) {
+    return luhn_checksum(data, length, 10);
+}
+
+uint8_t luhn10_checksum_textbook(const uint8_t* data, size_t length) {
+    return luhn_checksum_textbook(data, length, 10);
+}
+
+// function to benchmark a checksum function over all message lengths
+// Note: The second parameter is a pointer to a function taking a const uint8_t* and a size_t as parameters and returns a T.
+template <typename T> void benchmark_checksum_function(const __FlashStringHelper* name, T (*cfp)(const uint8_t*, size_t)) {
+    for (size_t i=0; i<sizeof(benchmark_lengths)/sizeof(benchmark_lengths[0]); i++) {
+        const size_t len = benchmark_lengths[i];
+        if (len > BENCHMARK_MAX_LENGTH) {
+            break;
+        }
+        const uint32_t repetitions = (BENCHMARK_BYTES_PER_RUN / len < 16) ? 16 : BENCHMARK_BYTES_PER_RUN / len;
+        const uint32_t start = micros();
+        for (uint32_t r=0; r<repetitions; r++) {
+            benchmark_sink = static_cast<uint32_t>(cfp(benchmark_buffer, len));
+        }
+        const uint32_t elapsed = micros() - start;
+        // 1 us == 1000 ns
+        const float ns_per_message = (1000.0f * elapsed) / repetitions;
+        Serial.print(name);
+        Serial.print(F(", "));
+        Serial.print(len, DEC);
+        Serial.print(F(", "));
+        Serial.print(ns_per_message, 1);
+        Serial.print(F(", "));
+#if defined(F_CPU)
+        // F_CPU is the CPU clock frequency in Hz
+        const float cycles_per_byte = (ns_per_message * (F_CPU / 1000000.0f)) / (1000.0f * len);
+        Serial.println(cycles_per_byte, 2);
+#else
+        Serial.println(F("n/a"));
+#endif
+    }
+}
+
+void setup() {
+
+    Serial.begin(115200);
+    while (!Serial);
+    Serial.println(F("\n###### Starting checksum benchmark for ByteMessage library! ######\n"));
+
+    // fill buffer with random data
+    randomSeed(42);
+    for (size_t i=0; i<BENCHMARK_MAX_LENGTH; i++) {
+        benchmark_buffer[i] = static_cast<uint8_t>(random(0, 256));
+    }
+
+    Serial.println(F("function, length, ns/message, cycles/byte"));
+
+    /* ---- XOR checksums ---- */
+    benchmark_checksum_function(F("xor8_checksum"),  &xor8_checksum);
+    benchmark_checksum_function(F("xor16_checksum"), &xor16_checksum);
+    benchmark_checksum_function(F("xor32_checksum"), &xor32_checksum);
+    benchmark_checksum_function(F("xor64_checksum"), &xor64_checksum);
+
+    /* ---- two's complement checksums ---- */
+    benchmark_checksum_function(F("sum8_checksum"),  &sum8_checksum);
+    benchmark_checksum_function(F("sum16_checksum"), &sum16_checksum);
+    benchmark_checksum_function(F("sum32_checksum"), &sum32_checksum);
+    benchmark_checksum_function(F("sum64_checksum"), &sum64_checksum);
+
+    /* ---- one's complement checksums ---- */
+    benchmark_checksum_function(F("onesum8_checksum"),           &onesum8_checksum);
+    benchmark_checksum_function(F("onesum8_checksum_textbook"),  &onesum8_checksum_textbook);
+    benchmark_checksum_function(F("onesum16_checksum"),          &onesum16_checksum);
+    benchmark_checksum_function(F("onesum16_checksum_textbook"), &onesum16_checksum_textbook);
+    benchmark_checksum_function(F("onesum32_checksum"),          &onesum32_checksum);
+    benchmark_checksum_function(F("onesum32_checksum_textbook"), &onesum32_checksum_textbook);
+
+    /* ---- Fletcher's checksums ---- */
+    benchmark_checksum_function(F("fletcher8_checksum"),  &fletcher8_checksum);
+    benchmark_checksum_function(F("fletcher16_checksum"), &fletcher16_checksum);
+    benchmark_checksum_function(F("fletcher32_checksum"), &fletcher32_checksum);
+
+    /* ---- Luhn's checksums ---- */
+    benchmark_checksum_function(F("luhn_checksum"),          &luhn10_checksum);
+    benchmark_checksum_function(F("luhn_checksum_textbook"), &luhn10_checksum_textbook);
+    benchmark_checksum_function(F("luhn256_checksum"),       &luhn256_checksum);
+
+    /* ---- cyclic redundancy checks ---- */
+    benchmark_checksum_function(F("crc8_checksum_bitwise"),   &crc8_checksum_bitwise);
+    benchmark_checksum_function(F("crc8_checksum_table"),     &crc8_checksum_table);
+    benchmark_checksum_function(F("crc16_checksum_bitwise"),  &crc16_checksum_bitwise);
+    benchmark_checksum_function(F("crc16_checksum_table"),    &crc16_checksum_table);
+    benchmark_checksum_function(F("crc32_checksum_bitwise"),  &crc32_checksum_bitwise);
+    benchmark_checksum_function(F("crc32_checksum_table"),    &crc32_checksum_table);
+    benchmark_checksum_function(F("crc32c_checksum_bitwise"), &crc32c_checksum_bitwise);
+    benchmark_checksum_function(F("crc32c_checksum_table"),   &crc32c_checksum_table);
+#if (UINTPTR_MAX > 0xFFFF)
+    // 22 KB of lookup tables do not fit into the flash of small 8 bit boards
+    benchmark_checksum_function(F("crc8_checksum_slicing8"),   &crc8_checksum_slicing8);
+    benchmark_checksum_function(F("crc16_checksum_slicing8"),  &crc16_checksum_slicing8);
+    benchmark_checksum_function(F("crc32_checksum_slicing8"),  &crc32_checksum_slicing8);
+    benchmark_checksum_function(F("crc32c_checksum_slicing8"), &crc32c_checksum_slicing8);
+#endif
+#if defined(BM_CHECKSUM_CRC32_HW)
+    benchmark_checksum_function(F("crc32_checksum_hw"),  &crc32_checksum_hw);
+#endif
+#if defined(BM_CHECKSUM_CRC32C_HW)
+    benchmark_checksum_function(F("crc32c_checksum_hw"), &crc32c_checksum_hw);
+#endif
+
+    Serial.println(F("\n###### Checksum benchmark finished! ######"));
+}
+
+void loop() {
+    // do nothing
+}
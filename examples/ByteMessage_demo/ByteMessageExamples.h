@@ -10,6 +10,7 @@
 #include "ByteMessageField.h"
 #include "ByteMessageChecksum.h"
 #include "ByteMessageFieldBlob.h"
+#include "ByteMessageSchema.h"
 
 #include "bm_checksum_luhn.h"
 #include "bm_checksum_twosum.h"
@@ -44,8 +45,8 @@ class Point3D : public ByteMessage<Point3D_TYPE, Point3D_SIZE> {
         Point3D(const Point3D &src) : ByteMessage{src} {};
         // if we provide a copy constructor, we also *have* to provide a default constructor...
         Point3D() = default;
-        // explicitly use default copy assignment operator
-        Point3D& operator= (const Point3D&) = default;
+        // copy the whole array at once, the fields need not copy anything
+        Point3D& operator= (const Point3D &src) { ByteMessage::operator=(src); return *this; }
 
         // index 0 --> implicit type byte
         ByteMessageField<float>      x{msgarr, 1}; // index 1, 2, 3, 4
@@ -88,13 +89,13 @@ class TankControl : public ByteMessage<TankControl_TYPE, TankControl_SIZE> {
         TankControl(const TankControl &src) : ByteMessage{src} {};
         // if we provide a copy constructor, we also *have* to provide a default constructor...
         TankControl() = default;
-        // explicitly use default copy assignment operator
-        TankControl& operator= (const TankControl &p) = default;
+        // copy the whole array at once, the fields need not copy anything
+        TankControl& operator= (const TankControl &src) { ByteMessage::operator=(src); return *this; }
 
         // index 0 --> implicit type byte
         ByteMessageField<int8_t>     left{msgarr, 1};
         ByteMessageField<int8_t>     right{msgarr, 2};
-        ByteMessageChecksum<uint8_t> checksum{msgarr, 13, &sum8_checksum};
+        ByteMessageChecksum<uint8_t> checksum{msgarr, 3, &sum8_checksum};
         
         static_assert(2*sizeof(int8_t)+sizeof(uint8_t)+1 == TankControl_SIZE);
         static_assert(sizeof(uint8_t) == sizeof(sum8_checksum(nullptr, 0)));
@@ -122,8 +123,8 @@ class AESkey : public ByteMessage<AESkey_TYPE, AESkey_SIZE> {
         AESkey(const AESkey &src) : ByteMessage{src} {};
         // if we provide a copy constructor, we also *have* to provide a default constructor...
         AESkey() = default;
-        // explicitly use default copy assignment operator
-        AESkey& operator= (const AESkey &p) = default;
+        // copy the whole array at once, the fields need not copy anything
+        AESkey& operator= (const AESkey &src) { ByteMessage::operator=(src); return *this; }
 
         // index 0 --> implicit type
         // binary blob named "key" starting at index 1 and 16 bytes length
@@ -155,10 +156,72 @@ class SensorData : public ByteMessage<SensorData_TYPE, SensorData_SIZE> {
     public:
         SensorData(const SensorData &src) : ByteMessage{src} {};
         SensorData() = default;
-        SensorData& operator= (const SensorData &p) = default;
+        SensorData& operator= (const SensorData &src) { ByteMessage::operator=(src); return *this; }
         
         ByteMessageField<float>      temperature{msgarr, 1};
         ByteMessageField<uint8_t>    humidity{msgarr, 5};
         ByteMessageChecksum<uint8_t> checksum{msgarr, 6, &xor8_checksum};  
 };
+
+/*
+ * Example 5
+ * 
+ * Same layout as Point3D from example 1, but using compile-time fields
+ * and checksum. Positions are template parameters, so the data members
+ * do not store any pointers. They are static constexpr members and do
+ * not add to the size of a Point3DCompact object at all.
+ * 
+ * Access works through the message object:
+ * 
+ *     Point3DCompact p;
+ *     p.set(p.x, 11.1);
+ *     float x = p.get(p.x);
+ *     p.update(p.checksum);
+ *     bool ok = p.check(p.checksum);
+ * 
+ * Message Type shall be 22 for this example.
+ */
+namespace {
+    constexpr size_t Point3DCompact_TYPE = 22;
+    constexpr size_t Point3DCompact_SIZE = 14;
+}
+
+class Point3DCompact : public ByteMessage<Point3DCompact_TYPE, Point3DCompact_SIZE> {
+    public:
+        // Note: No user-defined copy constructor or assignment operator
+        // is necessary, because there are no data members besides the 
+        // array. Copies are a single memcpy() of the array.
+
+        // index 0 --> implicit type byte
+        static constexpr ByteMessageField<float, 1> x{}; // index 1, 2, 3, 4
+        static constexpr ByteMessageField<float, 5> y{}; // index 5, 6, 7, 8
+        static constexpr ByteMessageField<float, 9> z{}; // index 9, 10, 11, 12
+        static constexpr ByteMessageChecksum<uint8_t, 13, &luhn256_checksum> checksum{}; // index 13
+};
+static_assert(sizeof(Point3DCompact) == sizeof(ByteMessage<Point3DCompact_TYPE, Point3DCompact_SIZE>), "compile-time fields take no RAM");
+static_assert(bm_layout_valid<Point3DCompact>(Point3DCompact::x, Point3DCompact::y, Point3DCompact::z, Point3DCompact::checksum), 
+              "fields overlap or do not fit into the message");
+
+/*
+ * Example 6
+ * 
+ * Same layout as Point3DCompact from example 5, but nobody has to count
+ * bytes: the schema lists the fields in wire order and calculates their
+ * positions and the message size at compile time.
+ * Deriving from plain_message (i.e. ByteMessagePlain) drops the vtable
+ * pointer: the object is just the array and can be copied with memcpy().
+ * 
+ * Message Type shall be 23 for this example.
+ */
+using Point3DSchema = ByteMessageSchema<23, float, float, float, ByteMessageSchemaChecksum<uint8_t, &luhn256_checksum>>;
+
+class Point3DAuto : public Point3DSchema::plain_message {
+    public:
+        static constexpr Point3DSchema::field<0> x{};        // index 1, 2, 3, 4
+        static constexpr Point3DSchema::field<1> y{};        // index 5, 6, 7, 8
+        static constexpr Point3DSchema::field<2> z{};        // index 9, 10, 11, 12
+        static constexpr Point3DSchema::field<3> checksum{}; // index 13
+};
+static_assert(Point3DAuto::size == Point3DCompact_SIZE && Point3DAuto::checksum.pos == 13, "same layout as Point3DCompact");
+static_assert(sizeof(Point3DAuto) == Point3DAuto::size, "no vtable pointer");
 #endif
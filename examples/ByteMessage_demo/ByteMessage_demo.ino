@@ -9,6 +9,16 @@
 
 #include "ByteMessageExamples.h"
 
+// definitions of the compile-time fields (not needed from C++17 on)
+constexpr ByteMessageField<float, 1> Point3DCompact::x;
+constexpr ByteMessageField<float, 5> Point3DCompact::y;
+constexpr ByteMessageField<float, 9> Point3DCompact::z;
+constexpr ByteMessageChecksum<uint8_t, 13, &luhn256_checksum> Point3DCompact::checksum;
+constexpr Point3DSchema::field<0> Point3DAuto::x;
+constexpr Point3DSchema::field<1> Point3DAuto::y;
+constexpr Point3DSchema::field<2> Point3DAuto::z;
+constexpr Point3DSchema::field<3> Point3DAuto::checksum;
+
 void setup() {
 
     Serial.begin(115200);
@@ -115,6 +125,36 @@ void setup() {
     TankControl tc;
     // the next line results in a compiler error: we cannot assign a Point3D object to a TankControl object!
 //    tc = p1;
+
+    // Point3DCompact has the same layout as Point3D, but uses compile-time fields.
+    // Fields are accessed through the message object.
+    Point3DCompact pc;
+    pc.set(pc.x, 11.1);
+    pc.set(pc.y, 22.2);
+    pc.set(pc.z, 33.3);
+    pc.update(pc.checksum);
+
+    Serial.print(F("RAM used by a Point3D object: "));
+    Serial.println(sizeof(Point3D));
+    Serial.print(F("RAM used by a Point3DCompact object: "));
+    Serial.println(sizeof(Point3DCompact));
+    Serial.print(F("x coordinate of Point3DCompact object: "));
+    Serial.println(pc.get(pc.x), 6);
+    Serial.print(F("Checksum of Point3DCompact object is ok: "));
+    Serial.println(pc.check(pc.checksum) ? F("yes") : F("no"));
+
+    // Point3DAuto has the same layout again, calculated from a schema.
+    Point3DAuto pa;
+    pa.set(pa.x, pc.get(pc.x));
+    pa.set(pa.y, pc.get(pc.y));
+    pa.set(pa.z, pc.get(pc.z));
+    pa.update(pa.checksum);
+    Serial.print(F("Size of a Point3DAuto message: "));
+    Serial.println(Point3DAuto::size);
+    Serial.print(F("RAM used by a Point3DAuto object: "));
+    Serial.println(sizeof(Point3DAuto));
+    Serial.print(F("Checksum of Point3DAuto object is ok: "));
+    Serial.println(pa.check(pa.checksum) ? F("yes") : F("no"));
 } // end of setup()
 
 void loop() {
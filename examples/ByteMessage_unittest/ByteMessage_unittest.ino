@@ -10,6 +10,32 @@
 #include <ByteMessageField.h>
 #include <ByteMessageChecksum.h>
 #include <ByteMessageFieldBlob.h>
+#include <ByteMessageFieldArray.h>
+#include <ByteMessageBitField.h>
+#include <ByteMessageVariable.h>
+#include <ByteMessagePool.h>
+#include <ByteMessageRing.h>
+#include <ByteMessageGather.h>
+#include <ByteMessageChecksumStream.h>
+#include <ByteMessageView.h>
+#include <ByteMessageDispatcher.h>
+#include <ByteMessageStreamDecoder.h>
+#include <ByteMessageScanner.h>
+#if !defined(ARDUINO) || defined(BM_HOST)
+    #include <ByteMessageParallelVerifier.h>
+    #include <ByteMessageLog.h>
+    #if defined(__unix__) || defined(__APPLE__)
+        #include <signal.h>       // needed for signal() (tests of failed writes only)
+        #include <sys/stat.h>     // needed for stat() (tests of failed writes only)
+        #include <sys/resource.h> // needed for setrlimit() (tests of failed writes only)
+    #endif
+#endif
+#if (__cplusplus >= 201402L)
+    #include <ByteMessageConstant.h> // needs C++14
+#endif
+#include <ByteMessageBatch.h>
+#include <ByteMessageSchema.h>
+#include <ByteMessageStats.h>
 
 // checksum functions
 #include <bm_checksum_fletcher.h>
@@ -17,6 +43,10 @@
 #include <bm_checksum_onesum.h>
 #include <bm_checksum_twosum.h>
 #include <bm_checksum_xor.h>
+#include <bm_checksum_crc.h>
+#if (__cplusplus >= 201402L)
+    #include <bm_checksum_constexpr.h> // needs C++14
+#endif
 
 // function to test ByteMessageField instances
 template <typename T>
@@ -55,6 +85,46 @@ template <typename T> uint8_t unittest_checksum_function(const uint8_t* in, size
     return errorcounter;
 }
 
+// function to test delta updates of checksum functions
+// Changes 'len' bytes starting at 'offset' and compares the delta update with a full recalculation.
+template <typename T> uint8_t unittest_checksum_delta(const uint8_t* in, size_t total, size_t offset, size_t len, 
+                                                      T (*cfp)(const uint8_t*, size_t), 
+                                                      T (*dfp)(T, size_t, const uint8_t*, const uint8_t*, size_t)) {
+    uint32_t errorcounter = 0;
+    uint8_t changed[128];
+    memcpy(changed, in, total);
+    for (size_t i=offset; i<offset+len; ++i) { changed[i] = ~changed[i] + i; }
+    Serial.print(F("offset = "));
+    Serial.print(offset, DEC);
+    Serial.print(F(", len = "));
+    Serial.print(len, DEC);
+    Serial.print(F(": "));
+    const T result = dfp(cfp(in, total), offset, in+offset, changed+offset, len);
+    unittest_message( result == cfp(changed, total), errorcounter);
+    
+    return errorcounter;
+}
+
+// function to test streaming calculation of checksum functions
+// Splits the data into three parts at split1 and split2 and compares the result with the one-shot function.
+template <typename T, T (*FUNC)(const uint8_t*, size_t)> uint8_t unittest_checksum_stream(const uint8_t* in, size_t total, size_t split1, size_t split2) {
+    using stream = ByteMessageChecksumStream<T, FUNC>;
+    uint32_t errorcounter = 0;
+    Serial.print(F("split at "));
+    Serial.print(split1, DEC);
+    Serial.print(F(" and "));
+    Serial.print(split2, DEC);
+    Serial.print(F(": "));
+    typename stream::context_type ctx;
+    stream::init(ctx);
+    stream::update(ctx, in, split1);
+    stream::update(ctx, in+split1, split2-split1);
+    stream::update(ctx, in+split2, total-split2);
+    unittest_message( stream::final(ctx) == FUNC(in, total), errorcounter);
+    
+    return errorcounter;
+}
+
 // helper function to print results 
 void unittest_message(bool result, uint32_t &counter) {
     if (result) {
@@ -66,6 +136,194 @@ void unittest_message(bool result, uint32_t &counter) {
     }
 }
 
+// Handler for dispatcher tests: records type and number of handled messages.
+// Note: A generic lambda would do, but needs C++14. Local classes cannot
+// have member templates, so this must be declared at namespace scope, too.
+struct UnitTestHandler {
+    uint8_t &handled_type;
+    uint8_t &handled_count;
+    template <class MSG> void operator()(const MSG &m) {
+        handled_type = m.type;
+        ++handled_count;
+    }
+};
+
+// Message with compile-time fields and checksum.
+// Note: Must be declared at namespace scope, because local classes 
+// cannot have static data members.
+constexpr uint8_t BMC_TYPE = 2;
+constexpr size_t BMC_SIZE = 15;
+
+class UnitTestCompactMessage : public ByteMessage<BMC_TYPE, BMC_SIZE> {
+    public:
+        // inherit constructor for uninitialized messages
+        using ByteMessage::ByteMessage;
+        UnitTestCompactMessage() = default;
+
+        // index 0 --> implicit type byte
+        static constexpr ByteMessageField<uint32_t, 1>  foo{};  // index 1, 2, 3, 4
+        static constexpr ByteMessageField<int16_t, 5>   bar{};  // index 5, 6
+        static constexpr ByteMessageField<float, 7>     baz{};  // index 7, 8, 9, 10
+        static constexpr ByteMessageField<bool, 11>     flag{}; // index 11
+        static constexpr ByteMessageChecksum<uint16_t, 13, &internet_checksum> checksum{}; // index 13, 14
+};
+
+// definitions of the static constexpr members, not needed from C++17 on
+constexpr ByteMessageField<uint32_t, 1>                         UnitTestCompactMessage::foo;
+constexpr ByteMessageField<int16_t, 5>                          UnitTestCompactMessage::bar;
+constexpr ByteMessageField<float, 7>                            UnitTestCompactMessage::baz;
+constexpr ByteMessageField<bool, 11>                            UnitTestCompactMessage::flag;
+constexpr ByteMessageChecksum<uint16_t, 13, &internet_checksum> UnitTestCompactMessage::checksum;
+
+// Same layout as UnitTestCompactMessage, but without vtable pointer.
+constexpr uint8_t BMP_TYPE = 8;
+
+class UnitTestPlainMessage : public ByteMessagePlain<BMP_TYPE, BMC_SIZE> {
+    public:
+        using ByteMessage::ByteMessage;
+        UnitTestPlainMessage() = default;
+
+        static constexpr ByteMessageField<uint32_t, 1>  foo{};  // index 1, 2, 3, 4
+        static constexpr ByteMessageField<int16_t, 5>   bar{};  // index 5, 6
+        static constexpr ByteMessageChecksum<uint16_t, 13, &internet_checksum> checksum{}; // index 13, 14
+};
+
+// definitions of the static constexpr members, not needed from C++17 on
+constexpr ByteMessageField<uint32_t, 1>                         UnitTestPlainMessage::foo;
+constexpr ByteMessageField<int16_t, 5>                          UnitTestPlainMessage::bar;
+constexpr ByteMessageChecksum<uint16_t, 13, &internet_checksum> UnitTestPlainMessage::checksum;
+
+// Message with bit fields.
+constexpr uint8_t BMB_TYPE = 3;
+constexpr size_t BMB_SIZE = 6;
+
+class UnitTestBitFieldMessage : public ByteMessage<BMB_TYPE, BMB_SIZE> {
+    public:
+        // index 0 --> implicit type byte
+        static constexpr ByteMessageBitField<1, 0, 3>            mode{};    // index 1, bits 7..5
+        static constexpr ByteMessageBitField<1, 3, 5>            level{};   // index 1, bits 4..0
+        static constexpr ByteMessageBitField<2, 0, 10, int16_t>  offset{};  // index 2, 3 (upper 2 bits)
+        static constexpr ByteMessageBitField<3, 2, 1, bool>      enabled{}; // index 3, bit 5
+        static constexpr ByteMessageBitField<3, 3, 12, uint16_t> counter{}; // index 3 (lower 5 bits), 4 (upper 7 bits)
+        static constexpr ByteMessageChecksum<uint8_t, 5, &xor8_checksum> checksum{}; // index 5
+};
+
+// definitions of the static constexpr members, not needed from C++17 on
+constexpr ByteMessageBitField<1, 0, 3>                    UnitTestBitFieldMessage::mode;
+constexpr ByteMessageBitField<1, 3, 5>                    UnitTestBitFieldMessage::level;
+constexpr ByteMessageBitField<2, 0, 10, int16_t>          UnitTestBitFieldMessage::offset;
+constexpr ByteMessageBitField<3, 2, 1, bool>              UnitTestBitFieldMessage::enabled;
+constexpr ByteMessageBitField<3, 3, 12, uint16_t>         UnitTestBitFieldMessage::counter;
+constexpr ByteMessageChecksum<uint8_t, 5, &xor8_checksum> UnitTestBitFieldMessage::checksum;
+
+// Message with variable length.
+constexpr uint8_t BMV_TYPE = 4;
+constexpr size_t BMV_MAXSIZE = 20;
+
+class UnitTestVariableMessage : public ByteMessageVariable<BMV_TYPE, BMV_MAXSIZE, 2, 3, 2> {
+    public:
+        using ByteMessageVariable::ByteMessageVariable;
+        UnitTestVariableMessage() = default;
+
+        // index 0 --> implicit type byte
+        static constexpr ByteMessageField<uint8_t, 1>           node{};      // index 1
+        static constexpr ByteMessageVarintField<uint32_t, 0>    timestamp{}; // 1 to 5 bytes
+        static constexpr ByteMessageVarintField<int16_t, 1>     delta{};     // 1 to 3 bytes
+        static constexpr ByteMessageVarintField<uint64_t, 2>    counter{};   // 1 to 10 bytes
+        static constexpr ByteMessageTrailerChecksum<uint16_t, &internet_checksum> checksum{}; // last 2 bytes
+};
+
+// definitions of the static constexpr members, not needed from C++17 on
+constexpr ByteMessageField<uint8_t, 1>                             UnitTestVariableMessage::node;
+constexpr ByteMessageVarintField<uint32_t, 0>                      UnitTestVariableMessage::timestamp;
+constexpr ByteMessageVarintField<int16_t, 1>                       UnitTestVariableMessage::delta;
+constexpr ByteMessageVarintField<uint64_t, 2>                      UnitTestVariableMessage::counter;
+constexpr ByteMessageTrailerChecksum<uint16_t, &internet_checksum> UnitTestVariableMessage::checksum;
+
+// Message with variable length and length-prefixed blob.
+constexpr uint8_t BML_TYPE = 5;
+constexpr size_t BML_MAXSIZE = 24;
+
+class UnitTestLogMessage : public ByteMessageVariable<BML_TYPE, BML_MAXSIZE, 2, 2, 1, 0x02> {
+    public:
+        // index 0 --> implicit type byte
+        static constexpr ByteMessageField<uint8_t, 1>        level{};     // index 1
+        static constexpr ByteMessageVarintField<uint32_t, 0> timestamp{}; // 1 to 5 bytes
+        static constexpr ByteMessagePrefixedBlob<1, 16>      text{};      // 1 to 17 bytes
+        static constexpr ByteMessageTrailerChecksum<uint8_t, &xor8_checksum> checksum{}; // last byte
+};
+
+// definitions of the static constexpr members, not needed from C++17 on
+constexpr ByteMessageField<uint8_t, 1>                        UnitTestLogMessage::level;
+constexpr ByteMessageVarintField<uint32_t, 0>                 UnitTestLogMessage::timestamp;
+constexpr ByteMessagePrefixedBlob<1, 16>                      UnitTestLogMessage::text;
+constexpr ByteMessageTrailerChecksum<uint8_t, &xor8_checksum> UnitTestLogMessage::checksum;
+
+// Message with a blob which is sent from a caller-owned buffer.
+constexpr uint8_t BMG_TYPE = 6;
+constexpr size_t BMG_SIZE = 16;
+
+class UnitTestChunkMessage : public ByteMessage<BMG_TYPE, BMG_SIZE> {
+    public:
+        UnitTestChunkMessage(const UnitTestChunkMessage &src) : ByteMessage{src} {}
+        UnitTestChunkMessage() = default;
+        UnitTestChunkMessage& operator= (const UnitTestChunkMessage &src) { ByteMessage::operator=(src); return *this; }
+
+        // index 0 --> implicit type byte
+        static constexpr ByteMessageField<uint16_t, 1> chunk{};   // index 1, 2
+        ByteMessageFieldBlob payload{msgarr, 3, 10};              // index 3 ... 12
+        static constexpr ByteMessageChecksum<uint16_t, 13, &onesum16_checksum> checksum{}; // index 13, 14
+        static constexpr ByteMessageField<uint8_t, 15> flags{};   // index 15, not covered by checksum
+};
+
+// definitions of the static constexpr members, not needed from C++17 on
+constexpr ByteMessageField<uint16_t, 1>                         UnitTestChunkMessage::chunk;
+constexpr ByteMessageChecksum<uint16_t, 13, &onesum16_checksum> UnitTestChunkMessage::checksum;
+constexpr ByteMessageField<uint8_t, 15>                         UnitTestChunkMessage::flags;
+
+// Message with layout calculated from a schema.
+using UnitTestSchema = ByteMessageSchema<7, uint16_t, int32_t, ByteMessageSchemaReserved<3>, bool, 
+                                         ByteMessageSchemaChecksum<uint16_t, &fletcher16_checksum>, uint8_t>;
+
+class UnitTestSchemaMessage : public UnitTestSchema::message {
+    public:
+        static constexpr UnitTestSchema::field<0> id{};       // index 1, 2
+        static constexpr UnitTestSchema::field<1> value{};    // index 3 ... 6
+        static constexpr UnitTestSchema::field<2> reserved{}; // index 7, 8, 9
+        static constexpr UnitTestSchema::field<3> valid{};    // index 10
+        static constexpr UnitTestSchema::field<4> checksum{}; // index 11, 12
+        static constexpr UnitTestSchema::field<5> sequence{}; // index 13, not covered by checksum
+};
+
+// definitions of the static constexpr members, not needed from C++17 on
+constexpr UnitTestSchema::field<0> UnitTestSchemaMessage::id;
+constexpr UnitTestSchema::field<1> UnitTestSchemaMessage::value;
+constexpr UnitTestSchema::field<2> UnitTestSchemaMessage::reserved;
+constexpr UnitTestSchema::field<3> UnitTestSchemaMessage::valid;
+constexpr UnitTestSchema::field<4> UnitTestSchemaMessage::checksum;
+constexpr UnitTestSchema::field<5> UnitTestSchemaMessage::sequence;
+
+// Message with all values stored little-endian.
+constexpr uint8_t BMO_TYPE = 9;
+using UnitTestOrderSchema = ByteMessageOrderedSchema<ByteMessageLittleEndian, BMO_TYPE, uint32_t, int16_t, float, bool,
+                                                     ByteMessageSchemaChecksum<uint16_t, &fletcher16_checksum>>;
+
+class UnitTestOrderMessage : public UnitTestOrderSchema::message {
+    public:
+        static constexpr UnitTestOrderSchema::field<0> counter{};  // index 1 ... 4
+        static constexpr UnitTestOrderSchema::field<1> offset{};   // index 5, 6
+        static constexpr UnitTestOrderSchema::field<2> value{};    // index 7 ... 10
+        static constexpr UnitTestOrderSchema::field<3> valid{};    // index 11
+        static constexpr UnitTestOrderSchema::field<4> checksum{}; // index 12, 13, network byte order
+};
+
+// definitions of the static constexpr members, not needed from C++17 on
+constexpr UnitTestOrderSchema::field<0> UnitTestOrderMessage::counter;
+constexpr UnitTestOrderSchema::field<1> UnitTestOrderMessage::offset;
+constexpr UnitTestOrderSchema::field<2> UnitTestOrderMessage::value;
+constexpr UnitTestOrderSchema::field<3> UnitTestOrderMessage::valid;
+constexpr UnitTestOrderSchema::field<4> UnitTestOrderMessage::checksum;
+
 void setup() {
     
     // the number of errors during all tests
@@ -257,23 +515,182 @@ void setup() {
     bmfb1[0] = value;
     unittest_message(ptr1[0] == value, errorcount);
 
+#if !defined(BM_DEBUG_BOUNDS)
+    // out-of-bounds indices abort with BM_DEBUG_BOUNDS
     Serial.print(F("Test out-of-bounds read-access through subscript operator: "));
     unittest_message(bmfb1[bmfb1.size+55] == 0, errorcount);
 
     Serial.print(F("Test out-of-bounds write-access through subscript operator: "));
     bmfb1[bmfb1.size+55] = 123;
     unittest_message(bmfb1[bmfb1.size+55] == 0, errorcount);
+#endif
 
     Serial.print(F("Test regular read-access on const instance through subscript operator: "));
     unittest_message(bmfb_const[3] == ptr_const[3] && bmfb_const[3] == data[3], errorcount);
     
+#if !defined(BM_DEBUG_BOUNDS)
+    // out-of-bounds indices abort with BM_DEBUG_BOUNDS
     Serial.print(F("Test out-of-bounds read-access on const instance through subscript operator: "));
     unittest_message(bmfb_const[size_const+100] == 0, errorcount);
+#endif
+
+    Serial.print(F("Test unchecked span of blob: "));
+    ByteMessageSpan<uint8_t> blob_span = bmfb1.span();
+    blob_span[1] = 77;
+    size_t span_count = 0;
+    for (uint8_t &b : blob_span) { b ^= 0xFF; ++span_count; }
+    for (uint8_t &b : blob_span) { b ^= 0xFF; }
+    unittest_message(blob_span.data() == ptr1 && blob_span.size() == bmfb1.size && span_count == bmfb1.size && 
+                     ptr1[1] == 77 && bmfb_const.span().data() == ptr_const, errorcount);
+
+    Serial.print(F("Fields constructed for uninitialized messages do not write anything: "));
+    uint8_t backend_uninit[4] = {1, 2, 3, 4};
+    ByteMessageField<bool> bmf_uninit_bool{backend_uninit, 0, bm_uninitialized};
+    ByteMessageField<uint16_t> bmf_uninit_u16{backend_uninit, 1, bm_uninitialized};
+    ByteMessageFieldBlob bmfb_uninit{backend_uninit, 3, 1, bm_uninitialized};
+    unittest_message(backend_uninit[0] == 1 && bmf_uninit_bool.get() && bmf_uninit_u16.get() == 0x0203 && bmfb_uninit[0] == 4, errorcount);
+
+    Serial.print(F("ByteMessageFieldBlob constructor without zero-filling: "));
+    uint8_t backend_noprefill[4] = {1, 2, 3, 4};
+    ByteMessageFieldBlob bmfb_noprefill{backend_noprefill, 1, 2, false};
+    ByteMessageFieldBlob bmfb_prefill{backend_noprefill, 2, 2};
+    unittest_message(bmfb_noprefill.size == 2 && backend_noprefill[0] == 1 && backend_noprefill[1] == 2 && 
+                     backend_noprefill[2] == 0 && backend_noprefill[3] == 0, errorcount);
 
     // The following line does not compile due to const-ness:
     // Subscript assignment is not allowed on const instances!
 //    bmfb_const[3] = 10;
 
+    /* ---- ByteMessageFieldArray ---- */
+
+    Serial.println(F("\n### Running unit tests for ByteMessageFieldArray class ###\n"));
+
+    // 64 samples plus 2 bytes checksum
+    constexpr size_t ARRAY_N = 64;
+    uint8_t array_backend[ARRAY_N*sizeof(int16_t)+2] = {0};
+    uint8_t single_backend[ARRAY_N*sizeof(int16_t)] = {0};
+    ByteMessageFieldArray<int16_t, ARRAY_N> bmfa{array_backend, 0};
+    ByteMessageChecksum<uint16_t> array_checksum{array_backend, bmfa.size, &internet_checksum};
+    int16_t samples[ARRAY_N];
+    int16_t samples_read[ARRAY_N];
+    for (size_t i=0; i<ARRAY_N; ++i) {
+        samples[i] = static_cast<int16_t>(i*1021 - 30000);
+        ByteMessageField<int16_t> single{single_backend, i*sizeof(int16_t)};
+        single.set(samples[i]);
+    }
+
+    Serial.print(F("Checking that ByteMessageFieldArray has correct 'size' property: "));
+    unittest_message(bmfa.size == ARRAY_N*sizeof(int16_t) && bmfa.count == ARRAY_N, errorcount);
+
+    Serial.print(F("Setting all elements at once gives the same bytes as single fields: "));
+    unittest_message(bmfa.set_array(samples, ARRAY_N) == ARRAY_N && memcmp(array_backend, single_backend, bmfa.size) == 0, errorcount);
+
+    Serial.print(F("Getting all elements at once: "));
+    unittest_message(bmfa.get_array(samples_read, ARRAY_N) == ARRAY_N && memcmp(samples, samples_read, sizeof(samples)) == 0, errorcount);
+
+    Serial.print(F("Getting single elements: "));
+    unittest_message(bmfa.get(0) == samples[0] && bmfa.get(17) == samples[17] && bmfa.get(ARRAY_N-1) == samples[ARRAY_N-1], errorcount);
+
+    Serial.print(F("Setting single element: "));
+    bmfa.set(5, -2);
+    unittest_message(bmfa.get(5) == -2 && array_backend[10] == 0xFF && array_backend[11] == 0xFE, errorcount);
+
+    Serial.print(F("Test out-of-bounds access to single elements: "));
+    bmfa.set(ARRAY_N, 123);
+    unittest_message(bmfa.get(ARRAY_N) == 0 && array_backend[bmfa.size] == 0, errorcount);
+
+    Serial.print(F("Setting range of elements is clipped at end of array: "));
+    unittest_message(bmfa.set_array(samples, ARRAY_N, 60) == 4 && bmfa.get(60) == samples[0] && bmfa.get(63) == samples[3] && 
+                     array_backend[bmfa.size] == 0 && bmfa.set_array(samples, 1, ARRAY_N) == 0, errorcount);
+
+    Serial.print(F("Getting range of elements with odd length and offset: "));
+    bmfa.set_array(samples, ARRAY_N);
+    unittest_message(bmfa.get_array(samples_read, 37, 3) == 37 && memcmp(samples+3, samples_read, 37*sizeof(int16_t)) == 0, errorcount);
+
+    Serial.print(F("Setting single element and patching checksum: "));
+    array_checksum.update();
+    bmfa.set(42, 4242, array_checksum);
+    unittest_message(bmfa.get(42) == 4242 && array_checksum.check(), errorcount);
+
+    Serial.print(F("Bulk conversion of 32 bit values: "));
+    const uint32_t words[5] = {0x01020304, 0xDEADBEEF, 0, 0xFFFFFFFF, 0x80000001};
+    uint32_t words_read[5];
+    uint8_t words_encoded[5*sizeof(uint32_t)];
+    bm_encode_array(words_encoded, words, 5);
+    bm_decode_array(words_read, words_encoded, 5);
+    unittest_message(words_encoded[0] == 0x01 && words_encoded[3] == 0x04 && words_encoded[4] == 0xDE && 
+                     memcmp(words, words_read, sizeof(words)) == 0, errorcount);
+
+    Serial.print(F("Bulk conversion of float values: "));
+    float floats[9];
+    float floats_read[9];
+    uint8_t floats_encoded[9*sizeof(float)];
+    bool floats_ok = true;
+    for (size_t i=0; i<9; ++i) {
+        floats[i] = pi_float * i;
+    }
+    bm_encode_array(floats_encoded, floats, 9);
+    for (size_t i=0; i<9; ++i) {
+        floats_ok = floats_ok && ByteMessageFieldCodec<float>::decode(floats_encoded + i*sizeof(float)) == floats[i];
+    }
+    bm_decode_array(floats_read, floats_encoded, 9);
+    unittest_message(floats_ok && memcmp(floats, floats_read, sizeof(floats)) == 0, errorcount);
+
+    /* ---- byte order ---- */
+
+    Serial.println(F("\n### Running unit tests for little-endian and native byte order ###\n"));
+
+    Serial.print(F("Encoding integers little-endian: "));
+    uint8_t order_bytes[8] = {0};
+    ByteMessageFieldCodec<uint32_t, ByteMessageLittleEndian>::encode(order_bytes, 0x01020304);
+    ByteMessageFieldCodec<int16_t, ByteMessageLittleEndian>::encode(order_bytes + 4, -2);
+    unittest_message(order_bytes[0] == 0x04 && order_bytes[3] == 0x01 && order_bytes[4] == 0xFE && order_bytes[5] == 0xFF &&
+                     ByteMessageFieldCodec<uint32_t, ByteMessageLittleEndian>::decode(order_bytes) == 0x01020304 &&
+                     ByteMessageFieldCodec<int16_t, ByteMessageLittleEndian>::decode(order_bytes + 4) == -2, errorcount);
+
+    Serial.print(F("Encoding float little-endian gives reversed network byte order: "));
+    uint8_t order_network[4];
+    ByteMessageFieldCodec<float>::encode(order_network, pi_float);
+    ByteMessageFieldCodec<float, ByteMessageLittleEndian>::encode(order_bytes, pi_float);
+    unittest_message(order_bytes[0] == order_network[3] && order_bytes[1] == order_network[2] && 
+                     order_bytes[2] == order_network[1] && order_bytes[3] == order_network[0] &&
+                     ByteMessageFieldCodec<float, ByteMessageLittleEndian>::decode(order_bytes) == pi_float, errorcount);
+
+    Serial.print(F("Encoding in native byte order copies the value: "));
+    const uint64_t order_native = 0x0102030405060708;
+    ByteMessageFieldCodec<uint64_t, ByteMessageNativeOrder>::encode(order_bytes, order_native);
+    unittest_message(memcmp(order_bytes, &order_native, sizeof(order_native)) == 0 &&
+                     ByteMessageFieldCodec<uint64_t, ByteMessageNativeOrder>::decode(order_bytes) == order_native, errorcount);
+
+    Serial.print(F("Encoding bool and one-byte values in all byte orders: "));
+    ByteMessageFieldCodec<bool, ByteMessageLittleEndian>::encode(order_bytes, true);
+    ByteMessageFieldCodec<bool, ByteMessageNativeOrder>::encode(order_bytes + 1, true);
+    ByteMessageFieldCodec<int8_t, ByteMessageLittleEndian>::encode(order_bytes + 2, -1);
+    unittest_message(order_bytes[0] == 1 && order_bytes[1] == 1 && order_bytes[2] == 0xFF &&
+                     ByteMessageFieldCodec<bool, ByteMessageNativeOrder>::size == 1, errorcount);
+
+    Serial.print(F("Setting and getting little-endian field: "));
+    uint8_t order_backend[4] = {0};
+    ByteMessageField<uint16_t, BM_RUNTIME_POSITION, ByteMessageLittleEndian> order_field{order_backend, 1};
+    order_field.set(0x1234);
+    unittest_message(order_backend[1] == 0x34 && order_backend[2] == 0x12 && order_field.get() == 0x1234, errorcount);
+
+    Serial.print(F("Bulk conversion of little-endian array: "));
+    uint8_t order_array_backend[9*sizeof(uint32_t)];
+    ByteMessageFieldArray<uint32_t, 9, ByteMessageLittleEndian> order_array{order_array_backend, 0};
+    const uint32_t order_words[9] = {0x01020304, 0xDEADBEEF, 0, 0xFFFFFFFF, 0x80000001, 1, 2, 3, 0x11223344};
+    uint32_t order_words_read[9];
+    bool order_array_ok = order_array.set_array(order_words, 9) == 9 && order_array.get_array(order_words_read, 9) == 9;
+    for (size_t i=0; i<9; ++i) {
+        order_array_ok = order_array_ok && ByteMessageFieldCodec<uint32_t, ByteMessageLittleEndian>::decode(order_array_backend + i*sizeof(uint32_t)) == order_words[i];
+    }
+    unittest_message(order_array_ok && order_array_backend[0] == 0x04 && memcmp(order_words, order_words_read, sizeof(order_words)) == 0, errorcount);
+
+    Serial.print(F("Bulk conversion in native byte order copies the values: "));
+    ByteMessageFieldArray<uint32_t, 9, ByteMessageNativeOrder> native_array{order_array_backend, 0};
+    native_array.set_array(order_words, 9);
+    unittest_message(memcmp(order_array_backend, order_words, sizeof(order_words)) == 0 && native_array.get(8) == 0x11223344, errorcount);
+
     /* ---- checksum functions ---- */
 
     /*
@@ -399,6 +816,14 @@ void setup() {
     errorcount += unittest_checksum_function<uint32_t>(msg, 123, &onesum32_checksum, 708175348);
     errorcount += unittest_checksum_function<uint32_t>(msg, 122, &onesum32_checksum, 708227060);
     errorcount += unittest_checksum_function<uint32_t>(msg, 121, &onesum32_checksum, 719892468);
+#if (UINTPTR_MAX > 0xFFFF) // not enough RAM on small 8 bit boards
+    {
+        // longer than one block of the fast path, length not a multiple of four
+        static uint8_t long_msg[1021];
+        for (size_t i=0; i<sizeof(long_msg); i++) long_msg[i] = static_cast<uint8_t>(7*i + 3);
+        errorcount += unittest_checksum_function<uint32_t>(long_msg, sizeof(long_msg), &onesum32_checksum, 2154788730);
+    }
+#endif
 
     Serial.println(F("\nsum8_checksum:"));
     errorcount += unittest_checksum_function<uint8_t>(msg, 128, &sum8_checksum, 158);
@@ -480,6 +905,272 @@ void setup() {
     errorcount += unittest_checksum_function<uint64_t>(msg, 122, &xor64_checksum, 5020502599622242366U);
     errorcount += unittest_checksum_function<uint64_t>(msg, 121, &xor64_checksum, 4980533152929329214U);
 
+    Serial.println(F("\ncrc8_checksum:"));
+    errorcount += unittest_checksum_function<uint8_t>(msg, 128, &crc8_checksum, 24);
+    errorcount += unittest_checksum_function<uint8_t>(msg, 127, &crc8_checksum, 9);
+    errorcount += unittest_checksum_function<uint8_t>(msg, 126, &crc8_checksum, 255);
+    errorcount += unittest_checksum_function<uint8_t>(msg, 125, &crc8_checksum, 200);
+    errorcount += unittest_checksum_function<uint8_t>(msg, 124, &crc8_checksum, 210);
+    errorcount += unittest_checksum_function<uint8_t>(msg, 123, &crc8_checksum, 168);
+    errorcount += unittest_checksum_function<uint8_t>(msg, 122, &crc8_checksum, 242);
+    errorcount += unittest_checksum_function<uint8_t>(msg, 121, &crc8_checksum, 148);
+
+    Serial.println(F("\ncrc16_checksum:"));
+    errorcount += unittest_checksum_function<uint16_t>(msg, 128, &crc16_checksum, 52337);
+    errorcount += unittest_checksum_function<uint16_t>(msg, 127, &crc16_checksum, 13526);
+    errorcount += unittest_checksum_function<uint16_t>(msg, 126, &crc16_checksum, 60246);
+    errorcount += unittest_checksum_function<uint16_t>(msg, 125, &crc16_checksum, 8089);
+    errorcount += unittest_checksum_function<uint16_t>(msg, 124, &crc16_checksum, 64408);
+    errorcount += unittest_checksum_function<uint16_t>(msg, 123, &crc16_checksum, 32360);
+    errorcount += unittest_checksum_function<uint16_t>(msg, 122, &crc16_checksum, 42227);
+    errorcount += unittest_checksum_function<uint16_t>(msg, 121, &crc16_checksum, 10374);
+
+    Serial.println(F("\ncrc32_checksum:"));
+    errorcount += unittest_checksum_function<uint32_t>(msg, 128, &crc32_checksum, 4118955418);
+    errorcount += unittest_checksum_function<uint32_t>(msg, 127, &crc32_checksum, 2196487441);
+    errorcount += unittest_checksum_function<uint32_t>(msg, 126, &crc32_checksum, 3961757836);
+    errorcount += unittest_checksum_function<uint32_t>(msg, 125, &crc32_checksum, 1329125991);
+    errorcount += unittest_checksum_function<uint32_t>(msg, 124, &crc32_checksum, 3896657356);
+    errorcount += unittest_checksum_function<uint32_t>(msg, 123, &crc32_checksum, 4126904206);
+    errorcount += unittest_checksum_function<uint32_t>(msg, 122, &crc32_checksum, 4213287355);
+    errorcount += unittest_checksum_function<uint32_t>(msg, 121, &crc32_checksum, 4203720395);
+
+    Serial.println(F("\ncrc32c_checksum:"));
+    errorcount += unittest_checksum_function<uint32_t>(msg, 128, &crc32c_checksum, 3689715274);
+    errorcount += unittest_checksum_function<uint32_t>(msg, 127, &crc32c_checksum, 1185501051);
+    errorcount += unittest_checksum_function<uint32_t>(msg, 126, &crc32c_checksum, 2641010216);
+    errorcount += unittest_checksum_function<uint32_t>(msg, 125, &crc32c_checksum, 2721698060);
+    errorcount += unittest_checksum_function<uint32_t>(msg, 124, &crc32c_checksum, 618247082);
+    errorcount += unittest_checksum_function<uint32_t>(msg, 123, &crc32c_checksum, 624014920);
+    errorcount += unittest_checksum_function<uint32_t>(msg, 122, &crc32c_checksum, 3369607836);
+    errorcount += unittest_checksum_function<uint32_t>(msg, 121, &crc32c_checksum, 586050986);
+
+    // standard check value of CRCs is calculated over ASCII string "123456789"
+    const uint8_t crc_check_input[9] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+    Serial.println(F("\nCRC implementations, check value:"));
+    errorcount += unittest_checksum_function<uint8_t>(crc_check_input, 9, &crc8_checksum_bitwise, 0xF4);
+    errorcount += unittest_checksum_function<uint16_t>(crc_check_input, 9, &crc16_checksum_bitwise, 0x29B1);
+    errorcount += unittest_checksum_function<uint32_t>(crc_check_input, 9, &crc32_checksum_bitwise, 0xCBF43926);
+    errorcount += unittest_checksum_function<uint32_t>(crc_check_input, 9, &crc32c_checksum_bitwise, 0xE3069283);
+    errorcount += unittest_checksum_function<uint8_t>(crc_check_input, 9, &crc8_checksum_table, 0xF4);
+    errorcount += unittest_checksum_function<uint16_t>(crc_check_input, 9, &crc16_checksum_table, 0x29B1);
+    errorcount += unittest_checksum_function<uint32_t>(crc_check_input, 9, &crc32_checksum_table, 0xCBF43926);
+    errorcount += unittest_checksum_function<uint32_t>(crc_check_input, 9, &crc32c_checksum_table, 0xE3069283);
+#if (UINTPTR_MAX > 0xFFFF) // slicing-by-8 lookup tables do not fit into the flash of small 8 bit boards
+    errorcount += unittest_checksum_function<uint8_t>(crc_check_input, 9, &crc8_checksum_slicing8, 0xF4);
+    errorcount += unittest_checksum_function<uint16_t>(crc_check_input, 9, &crc16_checksum_slicing8, 0x29B1);
+    errorcount += unittest_checksum_function<uint32_t>(crc_check_input, 9, &crc32_checksum_slicing8, 0xCBF43926);
+    errorcount += unittest_checksum_function<uint32_t>(crc_check_input, 9, &crc32c_checksum_slicing8, 0xE3069283);
+#endif
+#if defined(BM_CHECKSUM_CRC32_HW)
+    errorcount += unittest_checksum_function<uint32_t>(crc_check_input, 9, &crc32_checksum_hw, 0xCBF43926);
+#endif
+#if defined(BM_CHECKSUM_CRC32C_HW)
+    errorcount += unittest_checksum_function<uint32_t>(crc_check_input, 9, &crc32c_checksum_hw, 0xE3069283);
+#endif
+
+    Serial.println(F("\nCRC implementations, unaligned data, compared to bitwise implementations:"));
+    errorcount += unittest_checksum_function<uint8_t>(msg+1, 119, &crc8_checksum_table, crc8_checksum_bitwise(msg+1, 119));
+    errorcount += unittest_checksum_function<uint16_t>(msg+1, 119, &crc16_checksum_table, crc16_checksum_bitwise(msg+1, 119));
+    errorcount += unittest_checksum_function<uint32_t>(msg+1, 119, &crc32_checksum_table, crc32_checksum_bitwise(msg+1, 119));
+    errorcount += unittest_checksum_function<uint32_t>(msg+1, 119, &crc32c_checksum_table, crc32c_checksum_bitwise(msg+1, 119));
+#if (UINTPTR_MAX > 0xFFFF) // slicing-by-8 lookup tables do not fit into the flash of small 8 bit boards
+    errorcount += unittest_checksum_function<uint8_t>(msg+1, 119, &crc8_checksum_slicing8, crc8_checksum_bitwise(msg+1, 119));
+    errorcount += unittest_checksum_function<uint16_t>(msg+1, 119, &crc16_checksum_slicing8, crc16_checksum_bitwise(msg+1, 119));
+    errorcount += unittest_checksum_function<uint32_t>(msg+1, 119, &crc32_checksum_slicing8, crc32_checksum_bitwise(msg+1, 119));
+    errorcount += unittest_checksum_function<uint32_t>(msg+1, 119, &crc32c_checksum_slicing8, crc32c_checksum_bitwise(msg+1, 119));
+#endif
+#if defined(BM_CHECKSUM_CRC32_HW)
+    errorcount += unittest_checksum_function<uint32_t>(msg+1, 119, &crc32_checksum_hw, crc32_checksum_bitwise(msg+1, 119));
+#endif
+#if defined(BM_CHECKSUM_CRC32C_HW)
+    errorcount += unittest_checksum_function<uint32_t>(msg+1, 119, &crc32c_checksum_hw, crc32c_checksum_bitwise(msg+1, 119));
+#endif
+
+    Serial.println(F("\nunaligned data, compared to textbook implementations:"));
+    errorcount += unittest_checksum_function<uint8_t>(msg+1, 119, &onesum8_checksum, onesum8_checksum_textbook(msg+1, 119));
+    errorcount += unittest_checksum_function<uint16_t>(msg+1, 119, &onesum16_checksum, onesum16_checksum_textbook(msg+1, 119));
+    errorcount += unittest_checksum_function<uint32_t>(msg+1, 119, &onesum32_checksum, onesum32_checksum_textbook(msg+1, 119));
+
+    /* ---- checksum delta updates ---- */
+
+    Serial.println(F("\n### Running unit tests for checksum delta updates ###\n"));
+
+    Serial.println(F("\nxor8_checksum_delta:"));
+    errorcount += unittest_checksum_delta<uint8_t>(msg, 121, 0, 1, &xor8_checksum, &xor8_checksum_delta);
+    errorcount += unittest_checksum_delta<uint8_t>(msg, 121, 7, 4, &xor8_checksum, &xor8_checksum_delta);
+
+    Serial.println(F("\nxor16_checksum_delta:"));
+    errorcount += unittest_checksum_delta<uint16_t>(msg, 121, 0, 1, &xor16_checksum, &xor16_checksum_delta);
+    errorcount += unittest_checksum_delta<uint16_t>(msg, 121, 7, 4, &xor16_checksum, &xor16_checksum_delta);
+    errorcount += unittest_checksum_delta<uint16_t>(msg, 121, 118, 3, &xor16_checksum, &xor16_checksum_delta);
+
+    Serial.println(F("\nxor32_checksum_delta:"));
+    errorcount += unittest_checksum_delta<uint32_t>(msg, 121, 7, 4, &xor32_checksum, &xor32_checksum_delta);
+    errorcount += unittest_checksum_delta<uint32_t>(msg, 121, 118, 3, &xor32_checksum, &xor32_checksum_delta);
+
+    Serial.println(F("\nxor64_checksum_delta:"));
+    errorcount += unittest_checksum_delta<uint64_t>(msg, 121, 7, 4, &xor64_checksum, &xor64_checksum_delta);
+    errorcount += unittest_checksum_delta<uint64_t>(msg, 121, 113, 8, &xor64_checksum, &xor64_checksum_delta);
+
+    Serial.println(F("\nsum8_checksum_delta:"));
+    errorcount += unittest_checksum_delta<uint8_t>(msg, 121, 0, 1, &sum8_checksum, &sum8_checksum_delta);
+    errorcount += unittest_checksum_delta<uint8_t>(msg, 121, 7, 4, &sum8_checksum, &sum8_checksum_delta);
+
+    Serial.println(F("\nsum16_checksum_delta:"));
+    errorcount += unittest_checksum_delta<uint16_t>(msg, 121, 7, 4, &sum16_checksum, &sum16_checksum_delta);
+    errorcount += unittest_checksum_delta<uint16_t>(msg, 121, 118, 3, &sum16_checksum, &sum16_checksum_delta);
+
+    Serial.println(F("\nsum32_checksum_delta:"));
+    errorcount += unittest_checksum_delta<uint32_t>(msg, 121, 7, 4, &sum32_checksum, &sum32_checksum_delta);
+    errorcount += unittest_checksum_delta<uint32_t>(msg, 121, 118, 3, &sum32_checksum, &sum32_checksum_delta);
+
+    Serial.println(F("\nsum64_checksum_delta:"));
+    errorcount += unittest_checksum_delta<uint64_t>(msg, 121, 7, 4, &sum64_checksum, &sum64_checksum_delta);
+    errorcount += unittest_checksum_delta<uint64_t>(msg, 121, 113, 8, &sum64_checksum, &sum64_checksum_delta);
+
+    Serial.println(F("\nonesum8_checksum_delta:"));
+    errorcount += unittest_checksum_delta<uint8_t>(msg, 121, 0, 1, &onesum8_checksum, &onesum8_checksum_delta);
+    errorcount += unittest_checksum_delta<uint8_t>(msg, 121, 7, 4, &onesum8_checksum, &onesum8_checksum_delta);
+
+    Serial.println(F("\nonesum16_checksum_delta:"));
+    errorcount += unittest_checksum_delta<uint16_t>(msg, 121, 7, 4, &onesum16_checksum, &onesum16_checksum_delta);
+    errorcount += unittest_checksum_delta<uint16_t>(msg, 121, 118, 3, &onesum16_checksum, &onesum16_checksum_delta);
+
+    Serial.println(F("\nonesum32_checksum_delta:"));
+    errorcount += unittest_checksum_delta<uint32_t>(msg, 121, 7, 4, &onesum32_checksum, &onesum32_checksum_delta);
+    errorcount += unittest_checksum_delta<uint32_t>(msg, 121, 118, 3, &onesum32_checksum, &onesum32_checksum_delta);
+
+    /* ---- streaming checksum calculation ---- */
+
+    Serial.println(F("\n### Running unit tests for streaming checksum calculation ###\n"));
+
+    Serial.println(F("\nxor8_checksum:"));
+    errorcount += unittest_checksum_stream<uint8_t, &xor8_checksum>(msg, 121, 0, 121);
+    errorcount += unittest_checksum_stream<uint8_t, &xor8_checksum>(msg, 121, 5, 64);
+
+    Serial.println(F("\nxor16_checksum:"));
+    errorcount += unittest_checksum_stream<uint16_t, &xor16_checksum>(msg, 121, 3, 64);
+    errorcount += unittest_checksum_stream<uint16_t, &xor16_checksum>(msg, 121, 1, 2);
+
+    Serial.println(F("\nxor32_checksum:"));
+    errorcount += unittest_checksum_stream<uint32_t, &xor32_checksum>(msg, 121, 3, 64);
+    errorcount += unittest_checksum_stream<uint32_t, &xor32_checksum>(msg, 121, 7, 100);
+
+    Serial.println(F("\nxor64_checksum:"));
+    errorcount += unittest_checksum_stream<uint64_t, &xor64_checksum>(msg, 121, 3, 64);
+    errorcount += unittest_checksum_stream<uint64_t, &xor64_checksum>(msg, 121, 13, 14);
+
+    Serial.println(F("\nsum8_checksum:"));
+    errorcount += unittest_checksum_stream<uint8_t, &sum8_checksum>(msg, 121, 5, 64);
+
+    Serial.println(F("\nsum16_checksum:"));
+    errorcount += unittest_checksum_stream<uint16_t, &sum16_checksum>(msg, 121, 3, 64);
+    errorcount += unittest_checksum_stream<uint16_t, &sum16_checksum>(msg, 121, 1, 2);
+
+    Serial.println(F("\nsum32_checksum:"));
+    errorcount += unittest_checksum_stream<uint32_t, &sum32_checksum>(msg, 121, 3, 64);
+    errorcount += unittest_checksum_stream<uint32_t, &sum32_checksum>(msg, 121, 7, 100);
+
+    Serial.println(F("\nsum64_checksum:"));
+    errorcount += unittest_checksum_stream<uint64_t, &sum64_checksum>(msg, 121, 3, 64);
+    errorcount += unittest_checksum_stream<uint64_t, &sum64_checksum>(msg, 121, 13, 14);
+
+    Serial.println(F("\nonesum8_checksum:"));
+    errorcount += unittest_checksum_stream<uint8_t, &onesum8_checksum>(msg, 121, 5, 64);
+
+    Serial.println(F("\nonesum16_checksum:"));
+    errorcount += unittest_checksum_stream<uint16_t, &onesum16_checksum>(msg, 121, 3, 64);
+    errorcount += unittest_checksum_stream<uint16_t, &onesum16_checksum>(msg, 121, 1, 2);
+
+    Serial.println(F("\nonesum32_checksum:"));
+    errorcount += unittest_checksum_stream<uint32_t, &onesum32_checksum>(msg, 121, 3, 64);
+    errorcount += unittest_checksum_stream<uint32_t, &onesum32_checksum>(msg, 121, 7, 100);
+
+    Serial.println(F("\nfletcher8_checksum:"));
+    errorcount += unittest_checksum_stream<uint8_t, &fletcher8_checksum>(msg, 121, 5, 64);
+    errorcount += unittest_checksum_stream<uint8_t, &fletcher8_checksum>(msg, 121, 1, 120);
+
+    Serial.println(F("\nfletcher16_checksum:"));
+    errorcount += unittest_checksum_stream<uint16_t, &fletcher16_checksum>(msg, 121, 5, 64);
+    errorcount += unittest_checksum_stream<uint16_t, &fletcher16_checksum>(msg, 121, 1, 120);
+
+    Serial.println(F("\nfletcher32_checksum (uneven parts and total length):"));
+    errorcount += unittest_checksum_stream<uint32_t, &fletcher32_checksum>(msg, 121, 5, 64);
+    errorcount += unittest_checksum_stream<uint32_t, &fletcher32_checksum>(msg, 121, 3, 4);
+    errorcount += unittest_checksum_stream<uint32_t, &fletcher32_checksum>(msg, 120, 1, 119);
+
+    Serial.println(F("\nluhn256_checksum:"));
+    errorcount += unittest_checksum_stream<uint8_t, &luhn256_checksum>(msg, 121, 5, 64);
+    errorcount += unittest_checksum_stream<uint8_t, &luhn256_checksum>(msg, 120, 1, 2);
+
+    {
+        Serial.print(F("\nluhn_checksum, base 10, digits in two parts: "));
+        const uint8_t digits[] = {7, 9, 9, 2, 7, 3, 9, 8, 7, 1};
+        luhn_checksum_context ctx;
+        luhn_checksum_init(ctx, 10);
+        luhn_checksum_update(ctx, digits, 3);
+        luhn_checksum_update(ctx, digits+3, 7);
+        // check digit of the textbook example 7992739871 is 3
+        unittest_message(luhn_checksum_final(ctx) == 3 && luhn_checksum_final(ctx) == luhn_checksum_textbook(digits, 10, 10), errorcount);
+    }
+
+    {
+        Serial.print(F("Streaming supported for CRC: "));
+        unittest_message(!ByteMessageChecksumStream<uint16_t, &crc16_checksum>::supported, errorcount);
+    }
+
+#if (__cplusplus >= 201402L)
+    /* ---- constexpr checksum functions ---- */
+
+    Serial.println(F("\n### Running unit tests for constexpr checksum functions ###\n"));
+
+    Serial.print(F("xor8_checksum_constexpr, "));
+    errorcount += unittest_checksum_function<uint8_t>(msg, 121, &xor8_checksum_constexpr, xor8_checksum(msg, 121));
+    Serial.print(F("xor16_checksum_constexpr, "));
+    errorcount += unittest_checksum_function<uint16_t>(msg, 121, &xor16_checksum_constexpr, xor16_checksum(msg, 121));
+    Serial.print(F("xor32_checksum_constexpr, "));
+    errorcount += unittest_checksum_function<uint32_t>(msg, 121, &xor32_checksum_constexpr, xor32_checksum(msg, 121));
+    Serial.print(F("xor64_checksum_constexpr, "));
+    errorcount += unittest_checksum_function<uint64_t>(msg, 121, &xor64_checksum_constexpr, xor64_checksum(msg, 121));
+    Serial.print(F("sum8_checksum_constexpr, "));
+    errorcount += unittest_checksum_function<uint8_t>(msg, 121, &sum8_checksum_constexpr, sum8_checksum(msg, 121));
+    Serial.print(F("sum16_checksum_constexpr, "));
+    errorcount += unittest_checksum_function<uint16_t>(msg, 121, &sum16_checksum_constexpr, sum16_checksum(msg, 121));
+    Serial.print(F("sum32_checksum_constexpr, "));
+    errorcount += unittest_checksum_function<uint32_t>(msg, 121, &sum32_checksum_constexpr, sum32_checksum(msg, 121));
+    Serial.print(F("sum64_checksum_constexpr, "));
+    errorcount += unittest_checksum_function<uint64_t>(msg, 121, &sum64_checksum_constexpr, sum64_checksum(msg, 121));
+    Serial.print(F("onesum8_checksum_constexpr, "));
+    errorcount += unittest_checksum_function<uint8_t>(msg, 121, &onesum8_checksum_constexpr, onesum8_checksum(msg, 121));
+    Serial.print(F("onesum16_checksum_constexpr, "));
+    errorcount += unittest_checksum_function<uint16_t>(msg, 121, &onesum16_checksum_constexpr, onesum16_checksum(msg, 121));
+    Serial.print(F("onesum32_checksum_constexpr, "));
+    errorcount += unittest_checksum_function<uint32_t>(msg, 121, &onesum32_checksum_constexpr, onesum32_checksum(msg, 121));
+    Serial.print(F("fletcher8_checksum_constexpr, "));
+    errorcount += unittest_checksum_function<uint8_t>(msg, 121, &fletcher8_checksum_constexpr, fletcher8_checksum(msg, 121));
+    Serial.print(F("fletcher16_checksum_constexpr, "));
+    errorcount += unittest_checksum_function<uint16_t>(msg, 121, &fletcher16_checksum_constexpr, fletcher16_checksum(msg, 121));
+    Serial.print(F("fletcher32_checksum_constexpr, "));
+    errorcount += unittest_checksum_function<uint32_t>(msg, 121, &fletcher32_checksum_constexpr, fletcher32_checksum(msg, 121));
+    Serial.print(F("luhn256_checksum_constexpr, "));
+    errorcount += unittest_checksum_function<uint8_t>(msg, 121, &luhn256_checksum_constexpr, luhn256_checksum(msg, 121));
+    Serial.print(F("crc8_checksum_constexpr, "));
+    errorcount += unittest_checksum_function<uint8_t>(msg, 121, &crc8_checksum_constexpr, crc8_checksum(msg, 121));
+    Serial.print(F("crc16_checksum_constexpr, "));
+    errorcount += unittest_checksum_function<uint16_t>(msg, 121, &crc16_checksum_constexpr, crc16_checksum(msg, 121));
+    Serial.print(F("crc32_checksum_constexpr, "));
+    errorcount += unittest_checksum_function<uint32_t>(msg, 121, &crc32_checksum_constexpr, crc32_checksum(msg, 121));
+    Serial.print(F("crc32c_checksum_constexpr, "));
+    errorcount += unittest_checksum_function<uint32_t>(msg, 121, &crc32c_checksum_constexpr, crc32c_checksum(msg, 121));
+
+    Serial.print(F("Checking evaluation of constexpr checksum function at compile time: "));
+    constexpr uint8_t constexpr_data[4] = {1, 2, 3, 4};
+    constexpr uint16_t constexpr_cs = fletcher16_checksum_constexpr(constexpr_data, 4);
+    unittest_message(constexpr_cs == fletcher16_checksum(constexpr_data, 4), errorcount);
+#endif
+
     /* ---- ByteMessage objects ---- */
 
     Serial.println(F("\n### Running unit tests for ByteMessage class ###\n"));
@@ -565,8 +1256,1091 @@ void setup() {
     utm3 = utm;
     unittest_message(utm.size == utm3.size && utm_ptr != utm3_ptr && memcmp(utm_ptr, utm3_ptr, utm.size) == 0, errorcount);
 
+    Serial.print(F("Checking that fields of assigned object still refer to their own array: "));
+    const uint32_t utm_foo = utm.foo.get();
+    utm3.foo.set(utm_foo + 1);
+    unittest_message(utm.foo.get() == utm_foo && utm3.foo.get() == utm_foo + 1 && memcmp(utm_ptr, utm3.get_ptr(), utm.size) != 0, errorcount);
+
+    Serial.print(F("Testing assignment operator of ByteMessage base class copies whole array: "));
+    ByteMessage<BM_TYPE, BM_SIZE> &utm3_base = utm3;
+    utm3_base = utm;
+    unittest_message(memcmp(utm_ptr, utm3.get_ptr(), utm.size) == 0 && utm3.foo.get() == utm_foo, errorcount);
+
+    Serial.print(F("Testing self-assignment of ByteMessage object: "));
+    utm3_base = utm3;
+    unittest_message(memcmp(utm_ptr, utm3.get_ptr(), utm.size) == 0, errorcount);
+
     Serial.print(F("Testing read-only subscript operator for ByteMessage object: "));
-    unittest_message(utm[0] == BM_TYPE && utm[1] == data_array[1] && utm[utm.size+1] == 0, errorcount);
+    bool subscript_ok = utm[0] == BM_TYPE && utm[1] == data_array[1];
+#if !defined(BM_DEBUG_BOUNDS)
+    subscript_ok = subscript_ok && utm[utm.size+1] == 0; // out-of-bounds indices abort with BM_DEBUG_BOUNDS
+#endif
+    unittest_message(subscript_ok, errorcount);
+
+    Serial.print(F("Testing unchecked span of ByteMessage object: "));
+    uint32_t span_sum = 0, index_sum = 0;
+    for (uint8_t b : utm.span()) { span_sum += b; }
+    for (size_t i=0; i<utm.size; ++i) { index_sum += utm.span()[i]; }
+    unittest_message(utm.span().data() == utm.get_ptr() && utm.span().size() == BM_SIZE && span_sum == index_sum && span_sum > 0, errorcount);
+
+    Serial.print(F("Testing field set() with checksum patch: "));
+    utm.checksum.update();
+    utm.bar.set(0x12345678, utm.checksum);
+    unittest_message(utm.bar.get() == 0x12345678 && utm.checksum.check(), errorcount);
+
+    Serial.print(F("Testing that checksum patch ignores changes outside of checksum: "));
+    uint16_t cs_before;
+    cs_before = utm.checksum.get();
+    utm.checksum.patch(utm_ptr+utm.size, utm_ptr, 1);
+    unittest_message(utm.checksum.get() == cs_before && utm.checksum.check(), errorcount);
+
+    Serial.print(F("Testing that checksum patch falls back to recalculation (Fletcher): "));
+    uint8_t fletcher_array[8] = {1, 2, 3, 4, 5, 6, 0, 0};
+    ByteMessageField<uint16_t> fletcher_field{fletcher_array, 2};
+    ByteMessageChecksum<uint16_t> fletcher_cs{fletcher_array, 6, &fletcher16_checksum};
+    fletcher_cs.update();
+    fletcher_field.set(4711, fletcher_cs);
+    unittest_message(fletcher_field.get() == 4711 && fletcher_cs.check(), errorcount);
+
+    Serial.print(F("Testing checksum with checksum function bound at compile time: "));
+    ByteMessageBoundChecksum<uint16_t, &fletcher16_checksum> fletcher_bound{fletcher_array, 6};
+    fletcher_field.set(815);
+    fletcher_bound.update();
+    unittest_message(fletcher_bound.get() == fletcher16_checksum(fletcher_array, 6) && fletcher_bound.check() && fletcher_cs.check(), errorcount);
+
+    Serial.print(F("Checking that bound checksum function is not stored in instance: "));
+    unittest_message(sizeof(fletcher_bound) < sizeof(fletcher_cs), errorcount);
+
+    Serial.print(F("Testing field set() with patch of bound checksum: "));
+    ByteMessageBoundChecksum<uint16_t, &internet_checksum> internet_bound{fletcher_array, 6};
+    internet_bound.update();
+    fletcher_field.set(4711, internet_bound);
+    unittest_message(internet_bound.check(), errorcount);
+
+    /* ---- ByteMessage objects with compile-time fields ---- */
+
+    Serial.println(F("\n### Running unit tests for ByteMessage class with compile-time fields ###\n"));
+
+    Serial.print(F("Checking that compile-time fields do not add to the object size: "));
+    unittest_message(sizeof(UnitTestCompactMessage) == sizeof(ByteMessage<BMC_TYPE, BMC_SIZE>), errorcount);
+
+    UnitTestCompactMessage utcm;
+    const uint8_t* utcm_ptr = utcm.get_ptr();
+    utcm.set(utcm.foo, 0xAABBCCDD);
+    utcm.set(utcm.bar, -5555);
+    utcm.set(utcm.baz, pi_float);
+    utcm.set(utcm.flag, true);
+
+    Serial.print(F("Testing set()/get() for compile-time fields: "));
+    unittest_message(utcm.get(utcm.foo) == 0xAABBCCDD && utcm.get(utcm.bar) == -5555 &&
+                     utcm.get(utcm.baz) == pi_float && utcm.get(utcm.flag), errorcount);
+
+    Serial.print(F("Checking big-endian encoding of compile-time fields: "));
+    unittest_message(utcm_ptr[1] == 0xAA && utcm_ptr[4] == 0xDD && utcm_ptr[11] == 1, errorcount);
+
+    Serial.print(F("Checking compile-time checksum calc() against checksum function: "));
+    unittest_message(utcm.calc(utcm.checksum) == internet_checksum(utcm_ptr, 13), errorcount);
+
+    Serial.print(F("Checking compile-time checksum update() and check(): "));
+    utcm.update(utcm.checksum);
+    unittest_message(utcm.get(utcm.checksum) == internet_checksum(utcm_ptr, 13) && utcm.check(utcm.checksum), errorcount);
+
+    Serial.print(F("Checking that compile-time checksum detects changed data: "));
+    utcm.set(utcm.flag, false);
+    unittest_message(!utcm.check(utcm.checksum), errorcount);
+
+    Serial.print(F("Testing assignment of ByteMessage objects with compile-time fields: "));
+    UnitTestCompactMessage utcm2;
+    utcm2 = utcm;
+    unittest_message(memcmp(utcm_ptr, utcm2.get_ptr(), utcm.size) == 0, errorcount);
+
+    Serial.print(F("Testing compile-time set() with checksum patch: "));
+    utcm2.update(utcm2.checksum);
+    utcm2.set(utcm2.bar, 1234, utcm2.checksum);
+    utcm2.set(utcm2.flag, true, utcm2.checksum);
+    unittest_message(utcm2.get(utcm2.bar) == 1234 && utcm2.check(utcm2.checksum), errorcount);
+
+    Serial.print(F("Constructing uninitialized message and populating it: "));
+    UnitTestCompactMessage utcm_uninit{bm_uninitialized};
+    bool uninit_ok = (utcm_uninit[0] == BMC_TYPE);
+    uninit_ok = uninit_ok && utcm_uninit.populate(utcm2.get_ptr(), BMC_SIZE);
+    unittest_message(uninit_ok && memcmp(utcm_uninit.get_ptr(), utcm2.get_ptr(), BMC_SIZE) == 0, errorcount);
+
+    Serial.print(F("Uninitialized construction through ByteMessageTraits: "));
+    UnitTestCompactMessage utcm_traits = ByteMessageTraits<UnitTestCompactMessage>::make_for_populate();
+    UnitTestMessage utm_traits = ByteMessageTraits<UnitTestMessage>::make_for_populate();
+    unittest_message(utcm_traits[0] == BMC_TYPE && utm_traits[0] == BM_TYPE && utm_traits[1] == 0, errorcount);
+
+    Serial.print(F("Checking that non-polymorphic message is just the array: "));
+    bool plain_ok = sizeof(UnitTestPlainMessage) == BMC_SIZE && sizeof(UnitTestCompactMessage) > BMC_SIZE;
+#if defined(__GNUC__)
+    plain_ok = plain_ok && __is_standard_layout(UnitTestPlainMessage) && __is_trivially_copyable(UnitTestPlainMessage) &&
+               !__is_polymorphic(UnitTestPlainMessage) && __is_polymorphic(UnitTestCompactMessage);
+#endif
+    unittest_message(plain_ok, errorcount);
+
+    Serial.print(F("Copying non-polymorphic message with memcpy(): "));
+    UnitTestPlainMessage utpm;
+    utpm.set(utpm.foo, 0x01020304);
+    utpm.set(utpm.bar, -2);
+    utpm.update(utpm.checksum);
+    UnitTestPlainMessage utpm_copy{bm_uninitialized};
+    memcpy(static_cast<void*>(&utpm_copy), &utpm, sizeof(utpm));
+    plain_ok = utpm_copy.get(utpm_copy.foo) == 0x01020304 && utpm_copy.check(utpm_copy.checksum) && 
+               utpm_copy.get_ptr() == reinterpret_cast<const uint8_t*>(&utpm_copy) && utpm_copy[0] == BMP_TYPE;
+    UnitTestPlainMessage utpm_assigned;
+    utpm_assigned = utpm;
+    unittest_message(plain_ok && utpm_assigned.get(utpm_assigned.bar) == -2 && ByteMessageTraits<UnitTestPlainMessage>::check(utpm_assigned), errorcount);
+
+    /* ---- ByteMessageView objects ---- */
+
+    Serial.println(F("\n### Running unit tests for ByteMessageView class ###\n"));
+
+    uint8_t view_buffer[BMC_SIZE];
+    memcpy(view_buffer, utcm_ptr, BMC_SIZE);
+
+    ByteMessageView<UnitTestCompactMessage> bmv;
+    Serial.print(F("Checking that default-constructed view is not valid: "));
+    unittest_message(!bmv.valid(), errorcount);
+
+    Serial.print(F("Checking that subscript operator of detached views returns zero: "));
+    ByteMessageView<const UnitTestCompactMessage> bmcv_detached;
+    unittest_message(bmv[0] == 0 && bmv[1] == 0 && bmcv_detached[0] == 0, errorcount);
+
+    Serial.print(F("Checking that fields and checksums of detached views read as zero and writes are ignored: "));
+    bmv.set(UnitTestCompactMessage::foo, 0x12345678);
+    bmv.set(UnitTestCompactMessage::bar, 7, UnitTestCompactMessage::checksum);
+    bmv.update(UnitTestCompactMessage::checksum);
+    unittest_message(bmv.get(UnitTestCompactMessage::foo) == 0 && bmv.calc(UnitTestCompactMessage::checksum) == 0 && 
+                     !bmv.check(UnitTestCompactMessage::checksum) && bmcv_detached.get(UnitTestCompactMessage::bar) == 0 && 
+                     bmcv_detached.calc(UnitTestCompactMessage::checksum) == 0 && !bmcv_detached.check(UnitTestCompactMessage::checksum), errorcount);
+
+    Serial.print(F("Checking that 'attach()' cannot be used when raw data has wrong length: "));
+    unittest_message(!bmv.attach(view_buffer, BMC_SIZE-1) && !bmv.valid(), errorcount);
+
+    Serial.print(F("Checking that 'attach()' cannot be used when type is wrong: "));
+    view_buffer[0] = BMC_TYPE+1;
+    unittest_message(!bmv.attach(view_buffer, BMC_SIZE) && !bmv.valid(), errorcount);
+    view_buffer[0] = BMC_TYPE;
+
+    Serial.print(F("Checking that 'attach()' works without copying: "));
+    unittest_message(bmv.attach(view_buffer, BMC_SIZE) && bmv.get_ptr() == view_buffer, errorcount);
+
+    Serial.print(F("Testing get() through view: "));
+    unittest_message(bmv.get(utcm.foo) == 0xAABBCCDD && bmv.get(UnitTestCompactMessage::bar) == -5555, errorcount);
+
+    Serial.print(F("Testing set() and update() through view write to buffer: "));
+    bmv.set(UnitTestCompactMessage::bar, 1234);
+    bmv.update(UnitTestCompactMessage::checksum);
+    unittest_message(ByteMessageFieldCodec<int16_t>::decode(view_buffer+5) == 1234 && bmv.check(UnitTestCompactMessage::checksum), errorcount);
+
+    Serial.print(F("Testing read-only view: "));
+    ByteMessageView<const UnitTestCompactMessage> bmcv{bmv};
+    unittest_message(bmcv.valid() && bmcv.get(UnitTestCompactMessage::bar) == 1234 && bmcv.check(UnitTestCompactMessage::checksum), errorcount);
+
+    Serial.print(F("Testing read-only subscript operator for view: "));
+    bool view_subscript_ok = bmcv[0] == BMC_TYPE;
+#if !defined(BM_DEBUG_BOUNDS)
+    view_subscript_ok = view_subscript_ok && bmcv[bmcv.size+1] == 0; // out-of-bounds indices abort with BM_DEBUG_BOUNDS
+#endif
+    unittest_message(view_subscript_ok, errorcount);
+
+    /* ---- ByteMessageDispatcher ---- */
+
+    Serial.println(F("\n### Running unit tests for ByteMessageDispatcher class ###\n"));
+
+    using UnitTestDispatcher = ByteMessageDispatcher<UnitTestMessage, UnitTestCompactMessage>;
+
+    Serial.print(F("Checking registry properties of dispatcher: "));
+    unittest_message(UnitTestDispatcher::count == 2 && UnitTestDispatcher::max_size == BM_SIZE &&
+                     UnitTestDispatcher::size_of(BM_TYPE) == BM_SIZE && UnitTestDispatcher::size_of(BMC_TYPE) == BMC_SIZE &&
+                     UnitTestDispatcher::known(BMC_TYPE) && !UnitTestDispatcher::known(BMC_TYPE+1), errorcount);
+
+    // a handler is anything which can be called with all registered message classes
+    uint8_t handled_type = 0;
+    uint8_t handled_count = 0;
+    UnitTestHandler handler{handled_type, handled_count};
+    ByteMessageDispatchResult result;
+
+    Serial.print(F("Dispatching message with classic fields: "));
+    utm.checksum.update();
+    result = UnitTestDispatcher::dispatch(utm.get_ptr(), utm.size, handler);
+    unittest_message(result == ByteMessageDispatchResult::ok && handled_type == BM_TYPE, errorcount);
+
+    Serial.print(F("Dispatching message with compile-time fields: "));
+    utcm.update(utcm.checksum);
+    result = UnitTestDispatcher::dispatch(utcm.get_ptr(), utcm.size, handler);
+    unittest_message(result == ByteMessageDispatchResult::ok && handled_type == BMC_TYPE, errorcount);
+
+    Serial.print(F("Dispatching view of message with compile-time fields: "));
+    handled_type = 0;
+    result = UnitTestDispatcher::dispatch_view(utcm.get_ptr(), utcm.size, handler);
+    unittest_message(result == ByteMessageDispatchResult::ok && handled_type == BMC_TYPE, errorcount);
+
+    Serial.print(F("Checking that dispatcher rejects unknown type: "));
+    handled_type = 0;
+    memcpy(view_buffer, utcm.get_ptr(), BMC_SIZE);
+    view_buffer[0] = 200;
+    result = UnitTestDispatcher::dispatch(view_buffer, BMC_SIZE, handler);
+    unittest_message(result == ByteMessageDispatchResult::unknown_type && handled_type == 0, errorcount);
+
+    Serial.print(F("Checking that dispatcher rejects wrong size: "));
+    result = UnitTestDispatcher::dispatch(utcm.get_ptr(), utcm.size-1, handler);
+    unittest_message(result == ByteMessageDispatchResult::size_mismatch && handled_type == 0, errorcount);
+
+    Serial.print(F("Checking that dispatcher rejects wrong checksum: "));
+    memcpy(view_buffer, utcm.get_ptr(), BMC_SIZE);
+    view_buffer[1] ^= 0x01;
+    result = UnitTestDispatcher::dispatch(view_buffer, BMC_SIZE, handler);
+    unittest_message(result == ByteMessageDispatchResult::checksum_mismatch && handled_type == 0, errorcount);
+
+    Serial.print(F("Checking that dispatcher rejects wrong classic checksum: "));
+    uint8_t classic_buffer[BM_SIZE];
+    memcpy(classic_buffer, utm.get_ptr(), BM_SIZE);
+    classic_buffer[1] ^= 0x01;
+    result = UnitTestDispatcher::dispatch(classic_buffer, BM_SIZE, handler);
+    unittest_message(result == ByteMessageDispatchResult::checksum_mismatch && handled_type == 0, errorcount);
+
+    Serial.print(F("Checking that checksum verification can be skipped: "));
+    result = UnitTestDispatcher::dispatch(view_buffer, BMC_SIZE, handler, false);
+    unittest_message(result == ByteMessageDispatchResult::ok && handled_type == BMC_TYPE, errorcount);
+
+    Serial.print(F("Verifying messages without handler: "));
+    unittest_message(UnitTestDispatcher::verify(utcm.get_ptr(), utcm.size) == ByteMessageDispatchResult::ok &&
+                     UnitTestDispatcher::verify(utm.get_ptr(), utm.size) == ByteMessageDispatchResult::ok &&
+                     UnitTestDispatcher::verify(view_buffer, BMC_SIZE) == ByteMessageDispatchResult::checksum_mismatch &&
+                     UnitTestDispatcher::verify(classic_buffer, BM_SIZE) == ByteMessageDispatchResult::checksum_mismatch &&
+                     UnitTestDispatcher::verify(utcm.get_ptr(), utcm.size-1) == ByteMessageDispatchResult::size_mismatch, errorcount);
+
+    /* ---- ByteMessageStreamDecoder ---- */
+
+    Serial.println(F("\n### Running unit tests for ByteMessageStreamDecoder class ###\n"));
+
+    // stream: 2 garbage bytes, valid compact frame, corrupted classic frame, valid classic frame
+    uint8_t stream[2 + BMC_SIZE + 2*BM_SIZE];
+    size_t stream_length = 0;
+    stream[stream_length++] = 200;
+    stream[stream_length++] = 201;
+    memcpy(stream+stream_length, utcm.get_ptr(), BMC_SIZE);
+    stream_length += BMC_SIZE;
+    memcpy(stream+stream_length, classic_buffer, BM_SIZE);
+    stream_length += BM_SIZE;
+    memcpy(stream+stream_length, utm.get_ptr(), BM_SIZE);
+    stream_length += BM_SIZE;
+
+    handled_count = 0;
+    UnitTestHandler counting_handler{handled_type, handled_count};
+
+    ByteMessageStreamDecoder<UnitTestDispatcher> decoder;
+    Serial.print(F("Decoding stream byte by byte: "));
+    for (size_t i=0; i<stream_length; ++i) {
+        decoder.put(stream[i], counting_handler);
+    }
+    unittest_message(handled_count == 2 && handled_type == BM_TYPE && decoder.frames() == 2 &&
+                     decoder.checksum_errors() >= 1 && decoder.pending() == 0, errorcount);
+
+    Serial.print(F("Decoding stream in chunks: "));
+    ByteMessageStreamDecoder<UnitTestDispatcher> decoder2;
+    handled_count = 0;
+    size_t chunk_frames = 0;
+    chunk_frames += decoder2.write(stream, 7, counting_handler);
+    chunk_frames += decoder2.write(stream+7, stream_length-7, counting_handler);
+    unittest_message(chunk_frames == 2 && handled_count == 2 && decoder2.frames() == 2, errorcount);
+
+    Serial.print(F("Checking that partial frame is kept until complete: "));
+    handled_count = 0;
+    decoder2.write(utcm.get_ptr(), BMC_SIZE-1, counting_handler);
+    bool partial_ok = (decoder2.pending() == BMC_SIZE-1 && handled_count == 0);
+    decoder2.put(utcm.get_ptr()[BMC_SIZE-1], counting_handler);
+    unittest_message(partial_ok && handled_count == 1 && decoder2.pending() == 0, errorcount);
+
+    Serial.print(F("Decoding repeated stream with frames wrapping around the ring buffer: "));
+    ByteMessageStreamDecoder<UnitTestDispatcher> decoder3;
+    handled_count = 0;
+    for (uint8_t repeat=0; repeat<5; ++repeat) {
+        for (size_t i=0; i<stream_length; ++i) {
+            decoder3.put(stream[i], counting_handler);
+        }
+    }
+    unittest_message(handled_count == 10 && decoder3.frames() == 10 && decoder3.checksum_errors() == 5*decoder.checksum_errors() && 
+                     decoder3.pending() == 0, errorcount);
+
+    /* ---- ByteMessageScanner ---- */
+
+    Serial.println(F("\n### Running unit tests for ByteMessageScanner class ###\n"));
+
+    // same stream as above: 2 garbage bytes, valid compact frame, corrupted classic frame, valid classic frame
+    ByteMessageScanEntry scan_entries[4];
+    ByteMessageScanner<UnitTestDispatcher> scanner;
+
+    Serial.print(F("Indexing all frames in buffer: "));
+    size_t scanned = scanner.scan(stream, stream_length, scan_entries, 4);
+    unittest_message(scanned == 3 && scanner.consumed() == stream_length && scanner.frames() == 3 && 
+                     scanner.discarded() == 2 && scanner.checksum_errors() == 1 &&
+                     scan_entries[0].offset == 2 && scan_entries[0].type == BMC_TYPE && scan_entries[0].checksum_ok &&
+                     scan_entries[1].offset == 2+BMC_SIZE && scan_entries[1].type == BM_TYPE && !scan_entries[1].checksum_ok &&
+                     scan_entries[2].offset == 2+BMC_SIZE+BM_SIZE && scan_entries[2].type == BM_TYPE && scan_entries[2].checksum_ok, errorcount);
+
+    Serial.print(F("Accessing indexed frame through view: "));
+    const ByteMessageView<const UnitTestCompactMessage> scan_view = scanner.view<UnitTestCompactMessage>(stream, scan_entries[0]);
+    unittest_message(scan_view.valid() && scan_view.get(UnitTestCompactMessage::foo) == utcm.get(utcm.foo) &&
+                     !scanner.view<UnitTestCompactMessage>(stream, scan_entries[2]).valid(), errorcount);
+
+    Serial.print(F("Skipping frames of unwanted types: "));
+    ByteMessageScanner<UnitTestDispatcher> filtered_scanner;
+    filtered_scanner.ignore(BM_TYPE);
+    scanned = filtered_scanner.scan(stream, stream_length, scan_entries, 4);
+    unittest_message(scanned == 1 && scan_entries[0].type == BMC_TYPE && filtered_scanner.frames() == 3 && 
+                     filtered_scanner.checksum_errors() == 0 && !filtered_scanner.wanted(BM_TYPE) && 
+                     filtered_scanner.wanted(BMC_TYPE) && !filtered_scanner.wanted(200), errorcount);
+
+    Serial.print(F("Selecting single type after ignoring all: "));
+    filtered_scanner.ignore_all();
+    filtered_scanner.want(BM_TYPE);
+    scanned = filtered_scanner.scan(stream, stream_length, scan_entries, 4, false);
+    unittest_message(scanned == 2 && scan_entries[0].type == BM_TYPE && scan_entries[0].checksum_ok && scan_entries[1].checksum_ok, errorcount);
+
+    Serial.print(F("Stopping in front of incomplete frame and full index: "));
+    scanned = scanner.scan(stream, stream_length-1, scan_entries, 4);
+    bool scan_partial_ok = (scanned == 2 && scanner.consumed() == 2+BMC_SIZE+BM_SIZE);
+    scanned = scanner.scan(stream, stream_length, scan_entries, 1);
+    unittest_message(scan_partial_ok && scanned == 1 && scanner.consumed() == 2+BMC_SIZE, errorcount);
+
+#if !defined(ARDUINO) || defined(BM_HOST)
+    /* ---- ByteMessageParallelVerifier ---- */
+
+    Serial.println(F("\n### Running unit tests for ByteMessageParallelVerifier class ###\n"));
+
+    // log: the stream from above 50 times, followed by an incomplete frame
+    constexpr size_t log_repetitions = 50;
+    static uint8_t log_buffer[log_repetitions*sizeof(stream) + 3];
+    for (size_t i=0; i<log_repetitions; ++i) {
+        memcpy(log_buffer + i*stream_length, stream, stream_length);
+    }
+    const size_t log_length = log_repetitions*stream_length + 3;
+    memcpy(log_buffer + log_repetitions*stream_length, utm.get_ptr(), 3);
+
+    Serial.print(F("Verifying log with 4 threads and small chunks: "));
+    ByteMessageParallelVerifier<UnitTestDispatcher> verifier{4, 64};
+    size_t log_bad = verifier.verify(log_buffer, log_length);
+    bool log_offsets_ok = verifier.bad_offsets().size() == log_repetitions;
+    for (size_t i=0; log_offsets_ok && i<log_repetitions; ++i) {
+        log_offsets_ok = verifier.bad_offsets()[i] == i*stream_length + 2 + BMC_SIZE;
+    }
+    unittest_message(log_bad == log_repetitions && log_offsets_ok && verifier.threads() == 4 &&
+                     verifier.frames() == 3*log_repetitions && verifier.frames(BM_TYPE) == 2*log_repetitions &&
+                     verifier.frames(BMC_TYPE) == log_repetitions && verifier.checksum_errors(BM_TYPE) == log_repetitions &&
+                     verifier.checksum_errors(BMC_TYPE) == 0 && verifier.checksum_errors() == log_repetitions &&
+                     verifier.discarded() == 2*log_repetitions && verifier.consumed() == log_repetitions*stream_length, errorcount);
+
+    Serial.print(F("Getting same results with a single thread: "));
+    ByteMessageParallelVerifier<UnitTestDispatcher> single_verifier{1};
+    unittest_message(single_verifier.verify(log_buffer, log_length) == log_bad && single_verifier.frames() == verifier.frames() &&
+                     single_verifier.bad_offsets() == verifier.bad_offsets() && single_verifier.discarded() == verifier.discarded(), errorcount);
+
+    Serial.print(F("Verifying empty log and log without bad frames: "));
+    bool log_empty_ok = verifier.verify(log_buffer, 0) == 0 && verifier.frames() == 0 && verifier.consumed() == 0;
+    unittest_message(log_empty_ok && verifier.verify(log_buffer + 2, BMC_SIZE) == 0 && verifier.frames(BMC_TYPE) == 1, errorcount);
+
+    /* ---- ByteMessageLogWriter and ByteMessageLogReader ---- */
+
+    Serial.println(F("\n### Running unit tests for ByteMessageLogWriter and ByteMessageLogReader classes ###\n"));
+
+    const char * log_path = "bm_unittest.bmlog";
+    remove(log_path);
+    UnitTestCompactMessage log_msg;
+
+    Serial.print(F("Writing 9 frames of 2 types in blocks of 4 frames: "));
+    ByteMessageLogWriter log_writer{4};
+    bool log_write_ok = log_writer.open(log_path) && log_writer.is_open();
+    for (uint32_t i=0; i<9; ++i) {
+        if (i % 3 == 1) {
+            log_write_ok = log_writer.append(utm.get_ptr(), BM_SIZE) && log_write_ok;
+        }
+        else {
+            log_msg.set(log_msg.foo, i);
+            log_msg.update(log_msg.checksum);
+            log_write_ok = log_writer.append(log_msg) && log_write_ok;
+        }
+    }
+    log_write_ok = log_write_ok && log_writer.pending() == 1;
+    unittest_message(log_write_ok && log_writer.close() && !log_writer.is_open() && !log_writer.append(log_msg), errorcount);
+
+    Serial.print(F("Mapping log and counting frames per type: "));
+    ByteMessageLogReader log_reader;
+    unittest_message(log_reader.open(log_path) && log_reader.blocks() == 3 && log_reader.frames() == 9 &&
+                     log_reader.frames(BMC_TYPE) == 6 && log_reader.frames(BM_TYPE) == 3 && log_reader.frames(0) == 0 &&
+                     log_reader.frames_per_block() == 4 && log_reader.valid_size() == log_reader.size(), errorcount);
+
+    Serial.print(F("Visiting all frames of one type as views, in order of appending: "));
+    uint32_t log_expected_foo = 0;
+    bool log_views_ok = true;
+    uint64_t log_visited = log_reader.for_each_view<UnitTestCompactMessage>([&](ByteMessageView<const UnitTestCompactMessage> v) {
+        log_views_ok = log_views_ok && v.valid() && v.check(UnitTestCompactMessage::checksum) && 
+                       v.get(UnitTestCompactMessage::foo) == log_expected_foo;
+        log_expected_foo += (log_expected_foo % 3 == 0) ? 2 : 1;
+    });
+    size_t log_raw_sizes = 0;
+    uint64_t log_raw = log_reader.for_each(BM_TYPE, [&](const uint8_t * frame, size_t frame_size) {
+        log_raw_sizes += (frame_size == BM_SIZE && memcmp(frame, utm.get_ptr(), BM_SIZE) == 0) ? 1 : 0;
+    });
+    unittest_message(log_visited == 6 && log_views_ok && log_raw == 3 && log_raw_sizes == 3, errorcount);
+
+    Serial.print(F("Ignoring a torn block at the end of the log: "));
+    const size_t log_intact_size = log_reader.size();
+    FILE * log_file = fopen(log_path, "ab");
+    fwrite(log_buffer, 1, 30, log_file); // starts with a frame, not with a block header
+    fclose(log_file);
+    bool log_torn_ok = log_reader.open(log_path) && log_reader.size() == log_intact_size + 30 &&
+                       log_reader.valid_size() == log_intact_size && log_reader.blocks() == 3;
+    unittest_message(log_torn_ok, errorcount);
+
+    Serial.print(F("Cutting off the torn block and appending to the log: "));
+    log_reader.close();
+    bool log_append_ok = log_writer.open(log_path) && log_writer.append(log_msg) && log_writer.close();
+    unittest_message(log_append_ok && log_reader.open(log_path) && log_reader.blocks() == 4 && 
+                     log_reader.frames(BMC_TYPE) == 7 && log_reader.valid_size() == log_reader.size(), errorcount);
+
+    Serial.print(F("Reading a log in memory and stopping at a damaged index: "));
+    std::vector<uint8_t> log_copy(log_reader.get_ptr(), log_reader.get_ptr() + log_reader.size());
+    log_reader.close();
+    ByteMessageLogReader log_memory;
+    bool log_memory_ok = log_memory.open(log_copy.data(), log_copy.size()) && log_memory.frames() == 10;
+    log_copy[log_intact_size + 20 + 4] ^= 0x01; // group type in index of last block
+    log_memory_ok = log_memory_ok && log_memory.open(log_copy.data(), log_copy.size()) && log_memory.blocks() == 3 &&
+                    log_memory.frames() == 9 && log_memory.valid_size() == log_intact_size;
+    unittest_message(log_memory_ok, errorcount);
+
+    Serial.print(F("Rejecting files which are not logs: "));
+    log_copy[0] = 'X';
+    bool log_reject_ok = !log_memory.open(log_copy.data(), log_copy.size()) && !log_memory.is_open() &&
+                         !log_memory.open(log_copy.data(), 10);
+    log_file = fopen(log_path, "wb");
+    fwrite(log_copy.data(), 1, log_copy.size(), log_file);
+    fclose(log_file);
+    log_reject_ok = log_reject_ok && !log_reader.open(log_path) && !log_writer.open(log_path);
+    remove(log_path);
+    unittest_message(log_reject_ok && !log_reader.open(log_path), errorcount);
+
+#if defined(__unix__) || defined(__APPLE__)
+    Serial.print(F("Refusing frames after a block could not be written completely: "));
+    // limit file size so that the second block is torn
+    bool log_fail_ok = log_writer.open(log_path);
+    for (uint32_t i=0; i<4; ++i) {
+        log_fail_ok = log_writer.append(log_msg) && log_fail_ok;
+    }
+    struct stat log_stat;
+    stat(log_path, &log_stat);
+    const size_t log_good_size = static_cast<size_t>(log_stat.st_size);
+    struct rlimit log_saved_limit;
+    getrlimit(RLIMIT_FSIZE, &log_saved_limit);
+    struct rlimit log_limit = log_saved_limit;
+    log_limit.rlim_cur = log_good_size + 30;
+    void (*log_saved_handler)(int) = signal(SIGXFSZ, SIG_IGN);
+    setrlimit(RLIMIT_FSIZE, &log_limit);
+    bool log_refused = log_writer.append(log_msg) && log_writer.append(log_msg) && log_writer.append(log_msg);
+    log_refused = log_refused && !log_writer.append(log_msg);  // writes the second block, which is torn
+    log_refused = log_refused && !log_writer.append(log_msg) && !log_writer.flush() && !log_writer.close();
+    setrlimit(RLIMIT_FSIZE, &log_saved_limit);
+    signal(SIGXFSZ, log_saved_handler);
+    unittest_message(log_fail_ok && log_refused && log_reader.open(log_path) && log_reader.blocks() == 1 &&
+                     log_reader.valid_size() == log_good_size && log_reader.size() == log_good_size + 30, errorcount);
+
+    Serial.print(F("Appending again after opening the log again: "));
+    log_reader.close();
+    bool log_reopen_ok = log_writer.open(log_path) && log_writer.append(log_msg) && log_writer.close();
+    unittest_message(log_reopen_ok && log_reader.open(log_path) && log_reader.blocks() == 2 && 
+                     log_reader.frames(BMC_TYPE) == 5 && log_reader.valid_size() == log_reader.size(), errorcount);
+    log_reader.close();
+    remove(log_path);
+#endif
+#endif
+
+    /* ---- ByteMessageBitField ---- */
+
+    Serial.println(F("\n### Running unit tests for ByteMessageBitField class ###\n"));
+
+    UnitTestBitFieldMessage utbm;
+    const uint8_t* utbm_ptr = utbm.get_ptr();
+
+    Serial.print(F("Checking that bit fields span the correct bytes: "));
+    unittest_message(utbm.mode.size == 1 && utbm.offset.size == 2 && utbm.counter.size == 2 && 
+                     sizeof(UnitTestBitFieldMessage) == sizeof(ByteMessage<BMB_TYPE, BMB_SIZE>), errorcount);
+
+    Serial.print(F("Setting two bit fields sharing one byte: "));
+    utbm.set(utbm.mode, 5);
+    utbm.set(utbm.level, 19);
+    unittest_message(utbm_ptr[1] == 0xB3 && utbm.get(utbm.mode) == 5 && utbm.get(utbm.level) == 19, errorcount);
+
+    Serial.print(F("Checking that too wide values are truncated and other bits are preserved: "));
+    utbm.set(utbm.mode, 0xFF);
+    unittest_message(utbm.get(utbm.mode) == 7 && utbm.get(utbm.level) == 19 && utbm_ptr[1] == 0xF3, errorcount);
+
+    Serial.print(F("Setting and getting signed bit field across byte boundary: "));
+    utbm.set(utbm.offset, -3);
+    bool bitfield_ok = (utbm.get(utbm.offset) == -3 && utbm_ptr[2] == 0xFF && (utbm_ptr[3] & 0xC0) == 0x40);
+    utbm.set(utbm.offset, -512);
+    bitfield_ok = bitfield_ok && (utbm.get(utbm.offset) == -512);
+    utbm.set(utbm.offset, 511);
+    unittest_message(bitfield_ok && utbm.get(utbm.offset) == 511, errorcount);
+
+    Serial.print(F("Setting and getting bool and 12 bit field in the same bytes: "));
+    utbm.set(utbm.enabled, true);
+    utbm.set(utbm.counter, 0xABC);
+    unittest_message(utbm.get(utbm.enabled) && utbm.get(utbm.counter) == 0xABC && utbm.get(utbm.offset) == 511 && 
+                     utbm_ptr[3] == 0xF5 && utbm_ptr[4] == 0x78, errorcount);
+
+    Serial.print(F("Setting bit field and patching checksum: "));
+    utbm.update(utbm.checksum);
+    utbm.set(utbm.counter, 0x123, utbm.checksum);
+    unittest_message(utbm.get(utbm.counter) == 0x123 && utbm.get(utbm.enabled) && utbm.check(utbm.checksum), errorcount);
+
+    Serial.print(F("Accessing bit fields through a view: "));
+    ByteMessageView<const UnitTestBitFieldMessage> bmbv{utbm.get_ptr(), BMB_SIZE};
+    unittest_message(bmbv.get(UnitTestBitFieldMessage::mode) == 7 && bmbv.get(UnitTestBitFieldMessage::offset) == 511, errorcount);
+
+#if (__cplusplus >= 201402L)
+    Serial.print(F("Checking that constant frame with bit fields matches message built at run time: "));
+    constexpr auto bitfield_frame = ByteMessageConstant<UnitTestBitFieldMessage>{}
+        .set(UnitTestBitFieldMessage::mode, 0xFF)
+        .set(UnitTestBitFieldMessage::level, 19)
+        .set(UnitTestBitFieldMessage::offset, 511)
+        .set(UnitTestBitFieldMessage::enabled, true)
+        .set(UnitTestBitFieldMessage::counter, 0x123)
+        .update(UnitTestBitFieldMessage::checksum);
+    static_assert(bitfield_frame[1] == 0xF3, "bit fields of constant frame");
+    unittest_message(memcmp(bitfield_frame.get_ptr(), utbm.get_ptr(), BMB_SIZE) == 0, errorcount);
+#endif
+
+    /* ---- ByteMessageVariable ---- */
+
+    Serial.println(F("\n### Running unit tests for ByteMessageVariable class ###\n"));
+
+    Serial.print(F("Encoding varints: "));
+    uint8_t varint_buffer[10];
+    bool varint_ok = (bm_varint_encode(varint_buffer, uint16_t{300}) == 2 && varint_buffer[0] == 0xAC && varint_buffer[1] == 0x02);
+    varint_ok = varint_ok && (bm_varint_encode(varint_buffer, UINT64_MAX) == 10 && varint_buffer[9] == 0x01);
+    unittest_message(varint_ok && bm_varint_size(uint32_t{127}) == 1 && bm_varint_size(uint32_t{128}) == 2, errorcount);
+
+    Serial.print(F("Decoding varints, rejecting truncated and too long varints: "));
+    uint16_t varint_value = 0;
+    const uint8_t varint_long[4] = {0x80, 0x80, 0x80, 0x01};
+    unittest_message(bm_varint_decode(varint_buffer, 10, varint_value) == 0 && varint_value == 0 &&
+                     bm_varint_decode(varint_long, 3, varint_value) == 0 && bm_varint_decode(varint_long, 4, varint_value) == 0 &&
+                     bm_varint_decode(varint_long+2, 2, varint_value) == 2 && varint_value == 128, errorcount);
+
+    Serial.print(F("Zigzag encoding of signed values: "));
+    unittest_message(ByteMessageVarintCodec<int16_t>::to_wire(0) == 0 && ByteMessageVarintCodec<int16_t>::to_wire(-1) == 1 &&
+                     ByteMessageVarintCodec<int16_t>::to_wire(1) == 2 && ByteMessageVarintCodec<int16_t>::to_wire(-32768) == 0xFFFF &&
+                     ByteMessageVarintCodec<int64_t>::from_wire(ByteMessageVarintCodec<int64_t>::to_wire(INT64_MIN)) == INT64_MIN, errorcount);
+
+    UnitTestVariableMessage utvm;
+    const uint8_t* utvm_ptr = utvm.get_ptr();
+
+    Serial.print(F("Checking that new variable message has minimum length: "));
+    unittest_message(utvm.length() == 7 && utvm.min_size == 7 && utvm_ptr[0] == BMV_TYPE && utvm.get(utvm.counter) == 0, errorcount);
+
+    Serial.print(F("Setting varint fields changes length: "));
+    utvm.set(utvm.node, 9);
+    varint_ok = utvm.set(utvm.timestamp, 1000) && utvm.set(utvm.delta, -3) && utvm.set(utvm.counter, 5);
+    unittest_message(varint_ok && utvm.length() == 8 && utvm_ptr[2] == 0xE8 && utvm_ptr[3] == 0x07 && utvm_ptr[4] == 0x05 && utvm_ptr[5] == 0x05, errorcount);
+
+    Serial.print(F("Getting varint fields: "));
+    unittest_message(utvm.get(utvm.node) == 9 && utvm.get(utvm.timestamp) == 1000 && utvm.get(utvm.delta) == -3 && utvm.get(utvm.counter) == 5, errorcount);
+
+    Serial.print(F("Growing a varint field moves all following fields: "));
+    varint_ok = utvm.set(utvm.timestamp, 0xFFFFFFFF);
+    unittest_message(varint_ok && utvm.length() == 11 && utvm.get(utvm.timestamp) == 0xFFFFFFFF && 
+                     utvm.get(utvm.delta) == -3 && utvm.get(utvm.counter) == 5, errorcount);
+
+    Serial.print(F("Setting varint field fails if frame would exceed maximum size: "));
+    varint_ok = utvm.set(utvm.delta, INT16_MIN) && !utvm.set(utvm.counter, UINT64_MAX);
+    unittest_message(varint_ok && utvm.length() == 13 && utvm.get(utvm.counter) == 5 && utvm.get(utvm.delta) == INT16_MIN, errorcount);
+
+    Serial.print(F("Shrinking a varint field: "));
+    varint_ok = utvm.set(utvm.timestamp, 0);
+    unittest_message(varint_ok && utvm.length() == 9 && utvm.get(utvm.timestamp) == 0 && 
+                     utvm.get(utvm.delta) == INT16_MIN && utvm.get(utvm.counter) == 5, errorcount);
+
+    Serial.print(F("Updating and checking trailer checksum: "));
+    utvm.update(utvm.checksum);
+    varint_ok = utvm.check(utvm.checksum) && utvm.calc(utvm.checksum) == internet_checksum(utvm_ptr, utvm.length()-2);
+    utvm.set(utvm.counter, 6);
+    unittest_message(varint_ok && !utvm.check(utvm.checksum), errorcount);
+
+    Serial.print(F("Populating variable message with correct length: "));
+    utvm.set(utvm.counter, 1ULL << 40);
+    utvm.update(utvm.checksum);
+    UnitTestVariableMessage utvm2;
+    unittest_message(utvm2.populate(utvm.get_ptr(), utvm.length()) && utvm2.length() == utvm.length() &&
+                     utvm2.get(utvm2.counter) == (1ULL << 40) && utvm2.check(utvm2.checksum), errorcount);
+
+    Serial.print(F("Populating uninitialized variable message: "));
+    UnitTestVariableMessage utvm_uninit{bm_uninitialized};
+    unittest_message(utvm_uninit.length() == utvm_uninit.min_size && utvm_uninit.get(utvm_uninit.counter) == 0 &&
+                     utvm_uninit.populate(utvm.get_ptr(), utvm.length()) && utvm_uninit.get(utvm_uninit.counter) == (1ULL << 40), errorcount);
+
+    Serial.print(F("Populating variable message fails for wrong length or truncated varint: "));
+    uint8_t variable_raw[BMV_MAXSIZE+1] = {0};
+    memcpy(variable_raw, utvm.get_ptr(), utvm.length());
+    varint_ok = !utvm2.populate(variable_raw, utvm.length()+1) && !utvm2.populate(variable_raw, utvm.length()-1);
+    variable_raw[utvm.length()-3] |= 0x80; // last byte of counter says "more bytes follow"
+    varint_ok = varint_ok && !utvm2.populate(variable_raw, utvm.length()) && !utvm2.populate(variable_raw, BMV_MAXSIZE+1);
+    variable_raw[0] = BMV_TYPE + 1;
+    unittest_message(varint_ok && !utvm2.populate(variable_raw, 7) && utvm2.get(utvm2.counter) == (1ULL << 40), errorcount);
+
+    Serial.print(F("Copy construction and assignment of variable messages: "));
+    UnitTestVariableMessage utvm3{utvm};
+    UnitTestVariableMessage utvm4;
+    utvm4 = utvm;
+    unittest_message(utvm3.length() == utvm.length() && memcmp(utvm3.get_ptr(), utvm_ptr, utvm.length()) == 0 && 
+                     utvm4.length() == utvm.length() && memcmp(utvm4.get_ptr(), utvm_ptr, utvm.length()) == 0, errorcount);
+
+    Serial.print(F("Test out-of-bounds read-access through subscript operator: "));
+    bool utvm_subscript_ok = utvm[utvm.length()-1] == utvm_ptr[utvm.length()-1];
+#if !defined(BM_DEBUG_BOUNDS)
+    utvm_subscript_ok = utvm_subscript_ok && utvm[utvm.length()] == 0; // out-of-bounds indices abort with BM_DEBUG_BOUNDS
+#endif
+    unittest_message(utvm_subscript_ok, errorcount);
+
+    Serial.print(F("Test unchecked span covers current length only: "));
+    unittest_message(utvm.span().data() == utvm_ptr && utvm.span().size() == utvm.length() && 
+                     utvm.span().end() == utvm_ptr + utvm.length(), errorcount);
+
+    Serial.print(F("New length-prefixed blob is empty: "));
+    UnitTestLogMessage utlm;
+    unittest_message(utlm.length() == 5 && utlm.length(utlm.text) == 0, errorcount);
+
+    Serial.print(F("Setting length-prefixed blob adds only the bytes used: "));
+    const uint8_t log_text[] = "sensor ok";
+    uint8_t log_read[20] = {0};
+    utlm.set(utlm.timestamp, 200);
+    size_t log_copied = utlm.set(utlm.text, log_text, 9);
+    utlm.update(utlm.checksum);
+    unittest_message(log_copied == 9 && utlm.length() == 2+2+1+9+1 && utlm.length(utlm.text) == 9 && utlm[4] == 9 &&
+                     utlm.get(utlm.text, log_read, sizeof(log_read)) == 9 && memcmp(log_read, log_text, 9) == 0 && 
+                     utlm.get(utlm.timestamp) == 200 && utlm.check(utlm.checksum), errorcount);
+
+    Serial.print(F("Setting length-prefixed blob is clipped at maximum length and frame size: "));
+    const uint8_t log_long[30] = {0};
+    log_copied = utlm.set(utlm.text, log_long, 30);
+    bool log_ok = (log_copied == 16 && utlm.length() == 22 && !utlm.set(utlm.timestamp, 0xFFFFFFFF));
+    utlm.set(utlm.text, log_text, 9);
+    log_ok = log_ok && utlm.set(utlm.timestamp, 0xFFFFFFFF);
+    log_copied = utlm.set(utlm.text, log_long, 30);
+    unittest_message(log_ok && log_copied == 15 && utlm.length() == BML_MAXSIZE && utlm.get(utlm.timestamp) == 0xFFFFFFFF, errorcount);
+
+    Serial.print(F("Populating message with length-prefixed blob: "));
+    utlm.set(utlm.text, log_text, 9);
+    utlm.update(utlm.checksum);
+    UnitTestLogMessage utlm2;
+    log_ok = utlm2.populate(utlm.get_ptr(), utlm.length()) && utlm2.length(utlm2.text) == 9 && 
+             memcmp(utlm2.get_ptr(utlm2.text), log_text, 9) == 0 && utlm2.check(utlm2.checksum);
+    memcpy(variable_raw, utlm.get_ptr(), utlm.length());
+    variable_raw[7] = 10; // blob length does not fit
+    unittest_message(log_ok && !utlm2.populate(variable_raw, utlm.length()), errorcount);
+
+    /* ---- ByteMessagePool ---- */
+
+    Serial.println(F("\n### Running unit tests for ByteMessagePool class ###\n"));
+
+    ByteMessagePool<UnitTestCompactMessage, 3> pool;
+    UnitTestCompactMessage * pool_msgs[4];
+
+    Serial.print(F("Acquiring all messages from pool: "));
+    pool_msgs[0] = pool.acquire();
+    pool_msgs[1] = pool.acquire(bm_uninitialized);
+    pool_msgs[2] = pool.acquire(utcm.get_ptr(), BMC_SIZE);
+    pool_msgs[3] = pool.acquire();
+    unittest_message(pool_msgs[0] && pool_msgs[1] && pool_msgs[2] && !pool_msgs[3] && pool.available() == 0 &&
+                     pool_msgs[0] != pool_msgs[1] && pool_msgs[1] != pool_msgs[2] && pool.owns(pool_msgs[2]), errorcount);
+
+    Serial.print(F("Checking contents of acquired messages: "));
+    unittest_message((*pool_msgs[0])[0] == BMC_TYPE && (*pool_msgs[0])[1] == 0 && (*pool_msgs[1])[0] == BMC_TYPE && 
+                     memcmp(pool_msgs[2]->get_ptr(), utcm.get_ptr(), BMC_SIZE) == 0, errorcount);
+
+    Serial.print(F("Releasing messages: "));
+    bool pool_ok = pool.release(pool_msgs[1]) && pool.available() == 1;
+    pool_ok = pool_ok && !pool.release(pool_msgs[1]) && !pool.release(&utcm) && pool.available() == 1;
+    pool_msgs[3] = pool.acquire();
+    unittest_message(pool_ok && pool_msgs[3] == pool_msgs[1] && pool.available() == 0, errorcount);
+
+    Serial.print(F("Acquiring message from invalid raw data returns slot to pool: "));
+    pool.release(pool_msgs[0]);
+    unittest_message(pool.acquire(utcm.get_ptr(), BMC_SIZE-1) == nullptr && pool.available() == 1, errorcount);
+
+    Serial.print(F("Pool with classic message objects: "));
+    ByteMessagePool<UnitTestMessage, 2> classic_pool;
+    UnitTestMessage * classic_msg = classic_pool.acquire();
+    classic_msg->foo.set(0xDEADBEEF);
+    classic_msg->checksum.update();
+    UnitTestMessage * classic_copy = classic_pool.acquire(classic_msg->get_ptr(), BM_SIZE);
+    unittest_message(classic_copy && classic_copy->foo.get() == 0xDEADBEEF && classic_copy->checksum.check() && 
+                     classic_pool.release(classic_msg) && classic_pool.release(classic_copy) && classic_pool.available() == 2, errorcount);
+
+    /* ---- ByteMessageRing ---- */
+
+    Serial.println(F("\n### Running unit tests for ByteMessageRing class ###\n"));
+
+    ByteMessageRing<UnitTestDispatcher::max_size, 4> ring;
+    size_t ring_length = 0;
+
+    Serial.print(F("Checking that new ring is empty: "));
+    unittest_message(ring.empty() && !ring.full() && ring.count() == 0 && ring.overflows() == 0 &&
+                     ring.consume_begin(ring_length) == nullptr && ring_length == 0, errorcount);
+
+    Serial.print(F("Pushing frames of different sizes: "));
+    utcm.update(utcm.checksum);
+    utm.checksum.update();
+    bool ring_ok = ring.push(utcm) && ring.push(utm) && ring.push(utcm.get_ptr(), BMC_SIZE);
+    unittest_message(ring_ok && ring.count() == 3 && !ring.push(classic_buffer, UnitTestDispatcher::max_size+1), errorcount);
+
+    Serial.print(F("Checking that full ring drops frames and counts overflows: "));
+    ring_ok = ring.push(utm) && ring.full();
+    unittest_message(ring_ok && !ring.push(utcm) && ring.produce_begin() == nullptr && ring.overflows() == 2 && ring.count() == 4, errorcount);
+
+    Serial.print(F("Consuming frame in place: "));
+    const uint8_t * ring_frame = ring.consume_begin(ring_length);
+    ring_ok = ring_frame != nullptr && ring_length == BMC_SIZE && memcmp(ring_frame, utcm.get_ptr(), BMC_SIZE) == 0;
+    ring.consume_commit();
+    unittest_message(ring_ok && ring.count() == 3, errorcount);
+
+    Serial.print(F("Checking that view of frame with other type is detached and frame is kept: "));
+    ByteMessageView<const UnitTestCompactMessage> ring_cview = ring.consume_view<UnitTestCompactMessage>();
+    unittest_message(!ring_cview.valid() && ring.count() == 3, errorcount);
+
+    Serial.print(F("Dispatching frame from ring: "));
+    handled_type = 0;
+    ring_frame = ring.consume_begin(ring_length);
+    result = UnitTestDispatcher::dispatch(ring_frame, ring_length, handler);
+    ring.consume_commit();
+    unittest_message(result == ByteMessageDispatchResult::ok && handled_type == BM_TYPE, errorcount);
+
+    Serial.print(F("Popping frame into buffer, frame too large for buffer is kept: "));
+    memset(view_buffer, 0, BMC_SIZE);
+    ring_ok = ring.pop(view_buffer, BMC_SIZE) == BMC_SIZE && memcmp(view_buffer, utcm.get_ptr(), BMC_SIZE) == 0;
+    unittest_message(ring_ok && ring.pop(view_buffer, BM_SIZE-1) == 0 && ring.count() == 1, errorcount);
+    ring.consume_commit();
+
+    Serial.print(F("Producing message in place through view (with wrap-around): "));
+    ring_ok = true;
+    for (uint8_t i = 0; i < 6; i++) {
+        ByteMessageView<UnitTestCompactMessage> ring_view = ring.produce_view<UnitTestCompactMessage>();
+        ring_view.set(UnitTestCompactMessage::foo, 0x1000u + i);
+        ring_view.set(UnitTestCompactMessage::bar, 0);
+        ring_view.set(UnitTestCompactMessage::baz, 0.0f);
+        ring_view.set(UnitTestCompactMessage::flag, false);
+        ring_view.update(UnitTestCompactMessage::checksum);
+        ring.produce_commit(ring_view);
+        ring_cview = ring.consume_view<UnitTestCompactMessage>();
+        ring_ok = ring_ok && ring_view.valid() && ring_cview.valid() && ring_cview.get_ptr() == ring_view.get_ptr() &&
+                  ring_cview.get(UnitTestCompactMessage::foo) == 0x1000u + i && ring_cview.check(UnitTestCompactMessage::checksum);
+        ring.consume_commit();
+    }
+    unittest_message(ring_ok && ring.empty() && ring.overflows() == 2, errorcount);
+
+    /* ---- ByteMessageGather ---- */
+
+    Serial.println(F("\n### Running unit tests for ByteMessageGather class ###\n"));
+
+    const uint8_t gather_payload[10] = {0x10, 0x21, 0x32, 0x43, 0x54, 0x65, 0x76, 0x87, 0x98, 0xA9};
+    UnitTestChunkMessage chunk_msg;
+    chunk_msg.set(chunk_msg.chunk, 0x0102);
+    chunk_msg.set(chunk_msg.flags, 0x5A);
+    UnitTestChunkMessage chunk_ref{chunk_msg};
+    chunk_ref.payload.set(gather_payload, sizeof(gather_payload));
+    chunk_ref.update(chunk_ref.checksum);
+    ByteMessageGather gather;
+    uint8_t gather_buffer[BMG_SIZE+2];
+
+    Serial.print(F("Building segments without copying payload: "));
+    bool gather_ok = gather.build(chunk_msg, chunk_msg.payload, gather_payload, sizeof(gather_payload), UnitTestChunkMessage::checksum);
+    unittest_message(gather_ok && gather.count() == 4 && gather.length() == BMG_SIZE && gather[0].data == chunk_msg.get_ptr() && 
+                     gather[0].length == 3 && gather[1].data == gather_payload && gather[3].data == chunk_msg.get_ptr()+15 &&
+                     gather[4].data == nullptr && gather[4].length == 0, errorcount);
+
+    Serial.print(F("Checking checksum calculated across segments (with delta function): "));
+    gather_ok = gather.get(gather_buffer, sizeof(gather_buffer)) == BMG_SIZE && memcmp(gather_buffer, chunk_ref.get_ptr(), BMG_SIZE) == 0;
+    unittest_message(gather_ok && !chunk_msg.check(chunk_msg.checksum), errorcount);
+
+    Serial.print(F("Checking that a copy keeps its own checksum when the original is built again: "));
+    ByteMessageGather gather_copy{gather};
+    ByteMessageGather gather_assigned;
+    gather_assigned = gather;
+    gather.build(chunk_msg, chunk_msg.payload, gather_payload, 4, UnitTestChunkMessage::checksum);
+    gather_ok = gather_copy.get(gather_buffer, sizeof(gather_buffer)) == BMG_SIZE && memcmp(gather_buffer, chunk_ref.get_ptr(), BMG_SIZE) == 0;
+    gather_ok = gather_ok && gather_assigned.get(gather_buffer, sizeof(gather_buffer)) == BMG_SIZE && memcmp(gather_buffer, chunk_ref.get_ptr(), BMG_SIZE) == 0;
+    unittest_message(gather_ok && gather_copy[3].data == chunk_msg.get_ptr()+15 && gather_copy[2].data != gather_assigned[2].data, errorcount);
+
+    Serial.print(F("Checking checksum calculated across segments (streamed, no delta function): "));
+    constexpr ByteMessageChecksum<uint16_t, 13, &fletcher16_checksum> gather_fletcher{};
+    gather_ok = gather.build(chunk_msg.get_ptr(), BMG_SIZE, 3, gather_payload, sizeof(gather_payload), gather_fletcher);
+    gather.get(gather_buffer, sizeof(gather_buffer));
+    unittest_message(gather_ok && gather_fletcher.check(gather_buffer) && memcmp(gather_buffer+3, gather_payload, 10) == 0, errorcount);
+
+    Serial.print(F("Checking checksum calculated across segments (neither delta nor streaming function): "));
+    constexpr ByteMessageChecksum<uint16_t, 13, &crc16_checksum> gather_crc{};
+    gather_ok = gather.build(chunk_msg.get_ptr(), BMG_SIZE, 3, gather_payload, sizeof(gather_payload), gather_crc);
+    gather.get(gather_buffer, sizeof(gather_buffer));
+    unittest_message(gather_ok && gather_crc.check(gather_buffer), errorcount);
+
+    Serial.print(F("Building segments with payload shorter than blob: "));
+    chunk_ref.payload.set(gather_payload, 4);
+    chunk_ref.update(chunk_ref.checksum);
+    gather_ok = gather.build(chunk_msg, chunk_msg.payload, gather_payload, 4, UnitTestChunkMessage::checksum) && gather.count() == 5;
+    unittest_message(gather_ok && gather.get(gather_buffer, BMG_SIZE) == BMG_SIZE && memcmp(gather_buffer, chunk_ref.get_ptr(), BMG_SIZE) == 0, errorcount);
+
+    Serial.print(F("Checking that payload longer than blob and foreign blob are rejected: "));
+    gather_ok = !gather.build(chunk_msg, chunk_msg.payload, gather_payload, 11, UnitTestChunkMessage::checksum) && gather.count() == 0;
+    unittest_message(gather_ok && !gather.build(chunk_ref, chunk_msg.payload, gather_payload, 10) && gather.length() == 0, errorcount);
+
+    Serial.print(F("Checking that payload overlapping checksum is rejected: "));
+    unittest_message(!gather.build(chunk_msg.get_ptr(), BMG_SIZE, 9, gather_payload, 5, UnitTestChunkMessage::checksum), errorcount);
+
+    Serial.print(F("Building segments without checksum: "));
+    gather_ok = gather.build(chunk_msg, chunk_msg.payload, gather_payload, 10) && gather.count() == 3;
+    unittest_message(gather_ok && gather.get(gather_buffer, 5) == 5 && gather_buffer[4] == gather_payload[1], errorcount);
+
+    Serial.println(F("\nChecksum of a frame wrapped around the end of a circular buffer:"));
+    {
+        UnitTestCompactMessage wrapped_msg;
+        wrapped_msg.set(wrapped_msg.foo, 0xDEADBEEF);
+        wrapped_msg.set(wrapped_msg.bar, -1234);
+        wrapped_msg.update(wrapped_msg.checksum);
+        constexpr ByteMessageChecksum<uint16_t, 13, &fletcher16_checksum> wrapped_fletcher{};
+        constexpr ByteMessageChecksum<uint16_t, 13, &crc16_checksum> wrapped_crc{};
+        uint8_t circular[24];
+        const size_t starts[] = {9, 10, 11, 16, 23};
+        for (size_t i=0; i<sizeof(starts)/sizeof(starts[0]); ++i) {
+            const size_t first_length = sizeof(circular) - starts[i];
+            for (size_t j=0; j<BMC_SIZE; ++j) {
+                circular[(starts[i]+j) % sizeof(circular)] = wrapped_msg[j];
+            }
+            Serial.print(F("first part = "));
+            Serial.print(first_length, DEC);
+            Serial.print(F(" bytes: "));
+            const uint8_t * first = circular + starts[i];
+            bool wrapped_ok = UnitTestCompactMessage::checksum.check(first, first_length, circular);
+            wrapped_ok = wrapped_ok && wrapped_fletcher.calc(first, first_length, circular) == wrapped_fletcher.calc(wrapped_msg.get_ptr());
+            wrapped_ok = wrapped_ok && wrapped_crc.calc(first, first_length, circular) == wrapped_crc.calc(wrapped_msg.get_ptr());
+            circular[(starts[i]+5) % sizeof(circular)] ^= 0x01;
+            unittest_message(wrapped_ok && !UnitTestCompactMessage::checksum.check(first, first_length, circular), errorcount);
+        }
+    }
+
+    /* ---- ByteMessageSchema ---- */
+
+    Serial.println(F("\n### Running unit tests for ByteMessageSchema ###\n"));
+
+    Serial.print(F("Checking positions and size calculated from schema: "));
+    unittest_message(UnitTestSchemaMessage::size == 14 && UnitTestSchemaMessage::type == 7 && UnitTestSchema::count == 6 &&
+                     UnitTestSchema::field<0>::pos == 1 && UnitTestSchema::field<1>::pos == 3 && UnitTestSchemaMessage::reserved.size == 3 &&
+                     UnitTestSchemaMessage::valid.pos == 10 && UnitTestSchemaMessage::checksum.pos == 11 && 
+                     UnitTestSchemaMessage::sequence.pos == 13, errorcount);
+#if __cplusplus >= 201402L
+    static_assert(UnitTestSchema::pos<0> == 1 && UnitTestSchema::pos<5> == 13, "pos<I> is the position of entry I");
+#endif
+
+    Serial.print(F("Setting and getting fields of schema message: "));
+    UnitTestSchemaMessage schema_msg;
+    schema_msg.set(schema_msg.id, 0xBEEF);
+    schema_msg.set(schema_msg.value, -123456);
+    schema_msg.set(schema_msg.valid, true);
+    schema_msg.update(schema_msg.checksum);
+    schema_msg.set(schema_msg.sequence, 42);
+    unittest_message(schema_msg.get(schema_msg.id) == 0xBEEF && schema_msg.get(schema_msg.value) == -123456 &&
+                     schema_msg.get(schema_msg.valid) && schema_msg.check(schema_msg.checksum) && 
+                     schema_msg[1] == 0xBE && schema_msg[13] == 42 && sizeof(schema_msg) == sizeof(UnitTestSchema::message), errorcount);
+
+    Serial.print(F("Setting and getting fields of little-endian schema message: "));
+    UnitTestOrderMessage order_msg;
+    order_msg.set(order_msg.counter, 0xA1B2C3D4);
+    order_msg.set(order_msg.offset, -300);
+    order_msg.set(order_msg.value, pi_float);
+    order_msg.set(order_msg.valid, true);
+    order_msg.update(order_msg.checksum);
+    const uint16_t order_checksum = fletcher16_checksum(order_msg.get_ptr(), order_msg.checksum.pos);
+    unittest_message(UnitTestOrderMessage::size == 14 && UnitTestOrderMessage::checksum.pos == 12 &&
+                     order_msg[1] == 0xD4 && order_msg[4] == 0xA1 && order_msg[5] == 0xD4 && order_msg[6] == 0xFE && order_msg[11] == 1 &&
+                     order_msg[12] == (order_checksum >> 8) && order_msg[13] == (order_checksum & 0xFF) &&
+                     order_msg.get(order_msg.counter) == 0xA1B2C3D4 && order_msg.get(order_msg.offset) == -300 &&
+                     order_msg.get(order_msg.value) == pi_float && order_msg.check(order_msg.checksum), errorcount);
+
+    Serial.print(F("Patching checksum when setting little-endian field: "));
+    order_msg.set(order_msg.counter, 7, order_msg.checksum);
+    unittest_message(order_msg[1] == 7 && order_msg[4] == 0 && order_msg.check(order_msg.checksum), errorcount);
+
+    Serial.print(F("Verifying valid layouts: "));
+    static_assert(bm_layout_valid<UnitTestCompactMessage>(UnitTestCompactMessage::foo, UnitTestCompactMessage::bar, UnitTestCompactMessage::baz,
+                                                          UnitTestCompactMessage::flag, UnitTestCompactMessage::checksum), "valid layout rejected");
+    static_assert(bm_layout_valid<UnitTestSchemaMessage>(UnitTestSchemaMessage::id, UnitTestSchemaMessage::value, UnitTestSchemaMessage::reserved,
+                                                         UnitTestSchemaMessage::valid, UnitTestSchemaMessage::checksum, UnitTestSchemaMessage::sequence), 
+                  "valid layout rejected");
+    // bit fields sharing bytes do not overlap
+    constexpr bool bitfields_ok = bm_layout_valid<UnitTestBitFieldMessage>(UnitTestBitFieldMessage::mode, UnitTestBitFieldMessage::level, 
+                                                                           UnitTestBitFieldMessage::offset, UnitTestBitFieldMessage::enabled, 
+                                                                           UnitTestBitFieldMessage::counter, UnitTestBitFieldMessage::checksum);
+    unittest_message(bitfields_ok, errorcount);
+
+    Serial.print(F("Rejecting overlaps, type byte and overruns: "));
+    {
+        constexpr ByteMessageField<uint16_t, 1> f1{};
+        constexpr ByteMessageField<uint8_t, 2> f2{};
+        constexpr ByteMessageField<uint8_t, 0> f3{};
+        constexpr ByteMessageChecksum<uint16_t, 14, &internet_checksum> f4{};
+        constexpr ByteMessageBitField<3, 2, 4> f5{};
+        constexpr ByteMessageBitField<3, 5, 3> f6{};
+        constexpr bool rejected = !bm_layout_valid<UnitTestCompactMessage>(f1, f2) && !bm_layout_valid<UnitTestCompactMessage>(f3) &&
+                                  !bm_layout_valid<UnitTestCompactMessage>(f4) && !bm_layout_valid<UnitTestCompactMessage>(f5, f6) &&
+                                  bm_layout_valid<UnitTestCompactMessage>(f1, f5);
+        unittest_message(rejected, errorcount);
+    }
+
+    /* ---- ByteMessageBatch ---- */
+
+    Serial.println(F("\n### Running unit tests for ByteMessageBatch class ###\n"));
+
+    constexpr size_t BATCH_COUNT = 3;
+    UnitTestMessage batch_msgs[BATCH_COUNT];
+    UnitTestCompactMessage batch_cmsgs[BATCH_COUNT];
+    const uint32_t batch_foo[BATCH_COUNT] = {1, 0x12345678, 0xFFFFFFFF};
+    const int16_t  batch_bar[BATCH_COUNT] = {-1, 0, 12345};
+    for (size_t i=0; i<BATCH_COUNT; ++i) {
+        batch_msgs[i].foo.set(batch_foo[i]);
+        batch_cmsgs[i].set(batch_cmsgs[i].foo, batch_foo[i]);
+        batch_cmsgs[i].set(batch_cmsgs[i].bar, batch_bar[i]);
+    }
+    uint8_t batch_buffer[BATCH_COUNT*BM_SIZE];
+    bool batch_results[BATCH_COUNT];
+
+    Serial.print(F("Encoding array of messages with classic fields: "));
+    bool batch_ok = ByteMessageBatch<UnitTestMessage>::encode(batch_msgs, BATCH_COUNT, batch_buffer, sizeof(batch_buffer));
+    for (size_t i=0; i<BATCH_COUNT; ++i) {
+        batch_ok = batch_ok && batch_msgs[i].checksum.check() && (memcmp(batch_buffer+i*BM_SIZE, batch_msgs[i].get_ptr(), BM_SIZE) == 0);
+    }
+    unittest_message(batch_ok, errorcount);
+
+    Serial.print(F("Checking that encoding into too small buffer fails: "));
+    unittest_message(!ByteMessageBatch<UnitTestMessage>::encode(batch_msgs, BATCH_COUNT, batch_buffer, sizeof(batch_buffer)-1), errorcount);
+
+    Serial.print(F("Verifying frames with classic checksums: "));
+    unittest_message(ByteMessageBatch<UnitTestMessage>::verify(batch_buffer, BATCH_COUNT) == BATCH_COUNT, errorcount);
+
+    Serial.print(F("Encoding array of messages with compile-time fields: "));
+    batch_ok = ByteMessageBatch<UnitTestCompactMessage>::encode(batch_cmsgs, BATCH_COUNT, batch_buffer, sizeof(batch_buffer));
+    for (size_t i=0; i<BATCH_COUNT; ++i) {
+        batch_ok = batch_ok && batch_cmsgs[i].check(batch_cmsgs[i].checksum) && (memcmp(batch_buffer+i*BMC_SIZE, batch_cmsgs[i].get_ptr(), BMC_SIZE) == 0);
+    }
+    unittest_message(batch_ok, errorcount);
+
+    Serial.print(F("Encoding columns of field values: "));
+    uint8_t column_buffer[BATCH_COUNT*BMC_SIZE];
+    batch_ok = ByteMessageBatch<UnitTestCompactMessage>::encode_columns(column_buffer, sizeof(column_buffer), BATCH_COUNT, 
+                                                                       bm_column(UnitTestCompactMessage::foo, batch_foo),
+                                                                       bm_column(UnitTestCompactMessage::bar, batch_bar));
+    unittest_message(batch_ok && memcmp(column_buffer, batch_buffer, sizeof(column_buffer)) == 0, errorcount);
+
+    Serial.print(F("Verifying frames with compile-time checksums: "));
+    unittest_message(ByteMessageBatch<UnitTestCompactMessage>::verify(column_buffer, BATCH_COUNT, batch_results) == BATCH_COUNT && 
+                     batch_results[0] && batch_results[1] && batch_results[2], errorcount);
+    
+    Serial.print(F("Checking that verification finds corrupted frames: "));
+    column_buffer[BMC_SIZE+1] ^= 0x01;
+    column_buffer[2*BMC_SIZE] = BMC_TYPE + 1;
+    unittest_message(ByteMessageBatch<UnitTestCompactMessage>::verify(column_buffer, BATCH_COUNT, batch_results) == 1 && 
+                     batch_results[0] && !batch_results[1] && !batch_results[2], errorcount);
+
+#if (__cplusplus >= 201402L)
+    /* ---- ByteMessageConstant objects ---- */
+
+    Serial.println(F("\n### Running unit tests for ByteMessageConstant class ###\n"));
+
+    constexpr auto constant_frame = ByteMessageConstant<UnitTestCompactMessage>{}
+        .set(UnitTestCompactMessage::foo, 0xAABBCCDD)
+        .set(UnitTestCompactMessage::bar, -5555)
+#if defined(BM_HAS_CONSTEXPR_BIT_CAST)
+        .set(UnitTestCompactMessage::baz, pi_float)
+#endif
+        .set(UnitTestCompactMessage::flag, true)
+        .update(UnitTestCompactMessage::checksum);
+    static_assert(constant_frame.check(UnitTestCompactMessage::checksum), "checksum of constant frame");
+
+    UnitTestCompactMessage utcm_constant;
+    utcm_constant.set(utcm_constant.foo, 0xAABBCCDD);
+    utcm_constant.set(utcm_constant.bar, -5555);
+#if defined(BM_HAS_CONSTEXPR_BIT_CAST)
+    utcm_constant.set(utcm_constant.baz, pi_float);
+#endif
+    utcm_constant.set(utcm_constant.flag, true);
+    utcm_constant.update(utcm_constant.checksum);
+
+    Serial.print(F("Checking that constant frame matches message built at run time: "));
+    unittest_message(memcmp(constant_frame.get_ptr(), utcm_constant.get_ptr(), BMC_SIZE) == 0, errorcount);
+
+    Serial.print(F("Checking that constant frame can be used to populate a message: "));
+    UnitTestCompactMessage utcm_from_constant;
+    unittest_message(utcm_from_constant.populate(constant_frame.get_ptr(), constant_frame.size) && 
+                     utcm_from_constant.check(utcm_from_constant.checksum), errorcount);
+
+    Serial.print(F("Testing read-only subscript operator for ByteMessageConstant object: "));
+    unittest_message(constant_frame[0] == BMC_TYPE && constant_frame[1] == 0xAA && constant_frame[BMC_SIZE] == 0, errorcount);
+
+    Serial.print(F("Checking that little-endian constant frame matches message built at run time: "));
+    constexpr auto order_frame = ByteMessageConstant<UnitTestOrderMessage>{}
+        .set(UnitTestOrderMessage::counter, 0xA1B2C3D4)
+        .set(UnitTestOrderMessage::offset, -300)
+        .set(UnitTestOrderMessage::valid, true)
+        .update(UnitTestOrderMessage::checksum);
+    static_assert(order_frame[1] == 0xD4 && order_frame[5] == 0xD4 && order_frame[6] == 0xFE, "byte order of constant frame");
+    UnitTestOrderMessage order_constant;
+    order_constant.set(order_constant.counter, 0xA1B2C3D4);
+    order_constant.set(order_constant.offset, -300);
+    order_constant.set(order_constant.valid, true);
+    order_constant.update(order_constant.checksum);
+    unittest_message(memcmp(order_frame.get_ptr(), order_constant.get_ptr(), UnitTestOrderMessage::size) == 0, errorcount);
+#endif
+
+    /* ---- ByteMessageStats ---- */
+
+    Serial.println(F("\n### Running unit tests for ByteMessageStats class ###\n"));
+
+    // all counters stay zero unless BM_STATS is defined
+    const uint32_t stats_one = ByteMessageStats::enabled ? 1 : 0;
+
+    Serial.print(F("Checking that all counters are zero after reset: "));
+    ByteMessageStats::reset();
+    ByteMessageStatsSnapshot stats = ByteMessageStats::snapshot();
+    unittest_message(stats.populate_ok == 0 && stats.checksum_passes == 0 && stats.checksum_failures == 0 && stats.cycles == 0, errorcount);
+
+    Serial.print(F("Counting accepted and rejected frames in populate(): "));
+    UnitTestCompactMessage stats_msg;
+    uint8_t stats_frame[BMC_SIZE];
+    memcpy(stats_frame, stats_msg.get_ptr(), BMC_SIZE);
+    stats_msg.populate(stats_frame, BMC_SIZE);
+    stats_msg.populate(stats_frame, BMC_SIZE-1);
+    stats_frame[0] = BM_TYPE;
+    stats_msg.populate(stats_frame, BMC_SIZE);
+    stats = ByteMessageStats::snapshot(BMC_TYPE);
+    unittest_message(stats.populate_ok == stats_one && stats.populate_size_rejects == stats_one && 
+                     stats.populate_type_rejects == stats_one && ByteMessageStats::snapshot(BM_TYPE).populate_type_rejects == 0, errorcount);
+
+    Serial.print(F("Counting checksum updates, passes and failures: "));
+    stats_msg.update(stats_msg.checksum);
+    bool stats_check_ok = stats_msg.check(stats_msg.checksum);
+    stats_msg.set(stats_msg.bar, 77);
+    stats_check_ok = stats_check_ok && !stats_msg.check(stats_msg.checksum);
+    stats = ByteMessageStats::snapshot(BMC_TYPE);
+    unittest_message(stats_check_ok && stats.checksum_updates == stats_one && stats.checksum_passes == stats_one && 
+                     stats.checksum_failures == stats_one, errorcount);
+
+    Serial.print(F("Sampling cycles of checksum functions (if available): "));
+    unittest_message(stats.cycle_samples == (ByteMessageStats::cycles_enabled ? 3 : 0) && 
+                     (ByteMessageStats::cycles_enabled || stats.cycles == 0), errorcount);
+
+    Serial.print(F("Adding up counters of all types: "));
+    stats = ByteMessageStats::snapshot();
+    unittest_message(stats.populate_ok == stats_one && stats.populate_size_rejects == stats_one && 
+                     stats.checksum_failures == stats_one && ByteMessageStats::snapshot(255).populate_ok == 0, errorcount);
 
     /* ---- final evaluation ---- */
         
@@ -0,0 +1,182 @@
+/**
+ * @file    bm_checksum_benchmark.cpp
+ * @brief   Host-side micro-benchmark for all checksum functions
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_bm_checksum_benchmark_cpp License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Host-side micro-benchmark for all checksum functions, based on Google Benchmark 
+ * (https://github.com/google/benchmark). This file is not part of the Arduino 
+ * library and is not compiled by the Arduino IDE. For the Arduino counterpart 
+ * see examples/ByteMessage_benchmark.
+ *
+ * Build and run from the root directory of the library, e.g.
+ *
+ *   g++ -std=c++17 -O2 -Isrc extras/benchmark/bm_checksum_benchmark.cpp src/bm_checksum_*.cpp \
+ *       -lbenchmark -lpthread -o bm_checksum_benchmark
+ *   ./bm_checksum_benchmark
+ *
+ * Add e.g. -mavx2, -DBM_CHECKSUM_NO_SIMD or -DBM_CHECKSUM_NO_WORDWISE to compare
+ * the different implementations of the bulk checksum functions. Add -msse4.2 
+ * (x86) or -march=armv8-a+crc (ARM) to benchmark the hardware CRC functions.
+ *
+ * For every function and message length (4 bytes to 4 KB), the "Time" column 
+ * is the time per message in ns. The "cycles/byte" counter is only reported on 
+ * x86 and is based on the time stamp counter, which counts at a constant 
+ * reference frequency (not necessarily the actual core frequency).
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <stdint.h> // needed for fixed-size data types
+#include <stddef.h> // needed for size_t data type
+#include <vector>
+#include <random>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h> // needed for __rdtsc()
+    #define BM_BENCHMARK_HAS_TSC
+#endif
+
+// checksum functions
+#include "bm_checksum_fletcher.h"
+#include "bm_checksum_luhn.h"
+#include "bm_checksum_onesum.h"
+#include "bm_checksum_twosum.h"
+#include "bm_checksum_xor.h"
+#include "bm_checksum_crc.h"
+
+namespace {
+
+// Luhn's checksum takes an additional base parameter
+// wrap it to get the common checksum function signature
+uint8_t luhn10_checksum(const uint8_t* data, size_t length) {
+    return luhn_checksum(data, length, 10);
+}
+
+uint8_t luhn10_checksum_textbook(const uint8_t* data, size_t length) {
+    return luhn_checksum_textbook(data, length, 10);
+}
+
+// benchmark one checksum function for one message length (given by state.range(0))
+template <typename T, T (*FUNC)(const uint8_t*, size_t)>
+void bm_benchmark_checksum(benchmark::State& state) {
+    const size_t length = static_cast<size_t>(state.range(0));
+    std::vector<uint8_t> buffer(length);
+    std::mt19937 rng{42};
+    for (uint8_t &b : buffer) {
+        b = static_cast<uint8_t>(rng());
+    }
+#if defined(BM_BENCHMARK_HAS_TSC)
+    // read the time stamp counter outside of the loop
+    // reading it inside would add its overhead to every message
+    const uint64_t start = __rdtsc();
+#endif
+    for (auto _ : state) {
+        T result = FUNC(buffer.data(), length);
+        benchmark::DoNotOptimize(result);
+    }
+#if defined(BM_BENCHMARK_HAS_TSC)
+    const uint64_t cycles = __rdtsc() - start;
+    const double bytes = static_cast<double>(state.iterations()) * static_cast<double>(length);
+    state.counters["cycles/byte"] = benchmark::Counter(static_cast<double>(cycles) / bytes);
+#endif
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(length));
+}
+
+// register a benchmark for all message lengths from 4 bytes to 4 KB
+template <typename T, T (*FUNC)(const uint8_t*, size_t)>
+void bm_register_checksum(const char* name) {
+    benchmark::RegisterBenchmark(name, &bm_benchmark_checksum<T, FUNC>)
+        ->RangeMultiplier(4)
+        ->Range(4, 4096)
+        ->Unit(benchmark::kNanosecond);
+}
+
+} // end anonymous namespace
+
+int main(int argc, char** argv) {
+    /* ---- XOR checksums ---- */
+    bm_register_checksum<uint8_t,  &xor8_checksum>("xor8_checksum");
+    bm_register_checksum<uint16_t, &xor16_checksum>("xor16_checksum");
+    bm_register_checksum<uint32_t, &xor32_checksum>("xor32_checksum");
+    bm_register_checksum<uint64_t, &xor64_checksum>("xor64_checksum");
+
+    /* ---- two's complement checksums ---- */
+    bm_register_checksum<uint8_t,  &sum8_checksum>("sum8_checksum");
+    bm_register_checksum<uint16_t, &sum16_checksum>("sum16_checksum");
+    bm_register_checksum<uint32_t, &sum32_checksum>("sum32_checksum");
+    bm_register_checksum<uint64_t, &sum64_checksum>("sum64_checksum");
+
+    /* ---- one's complement checksums ---- */
+    bm_register_checksum<uint8_t,  &onesum8_checksum>("onesum8_checksum");
+    bm_register_checksum<uint8_t,  &onesum8_checksum_textbook>("onesum8_checksum_textbook");
+    bm_register_checksum<uint16_t, &onesum16_checksum>("onesum16_checksum");
+    bm_register_checksum<uint16_t, &onesum16_checksum_textbook>("onesum16_checksum_textbook");
+    bm_register_checksum<uint32_t, &onesum32_checksum>("onesum32_checksum");
+    bm_register_checksum<uint32_t, &onesum32_checksum_textbook>("onesum32_checksum_textbook");
+
+    /* ---- Fletcher's checksums ---- */
+    bm_register_checksum<uint8_t,  &fletcher8_checksum>("fletcher8_checksum");
+    bm_register_checksum<uint16_t, &fletcher16_checksum>("fletcher16_checksum");
+    bm_register_checksum<uint32_t, &fletcher32_checksum>("fletcher32_checksum");
+
+    /* ---- Luhn's checksums ---- */
+    bm_register_checksum<uint8_t,  &luhn10_checksum>("luhn_checksum");
+    bm_register_checksum<uint8_t,  &luhn10_checksum_textbook>("luhn_checksum_textbook");
+    bm_register_checksum<uint8_t,  &luhn256_checksum>("luhn256_checksum");
+
+    /* ---- cyclic redundancy checks ---- */
+    bm_register_checksum<uint8_t,  &crc8_checksum_bitwise>("crc8_checksum_bitwise");
+    bm_register_checksum<uint8_t,  &crc8_checksum_table>("crc8_checksum_table");
+    bm_register_checksum<uint8_t,  &crc8_checksum_slicing8>("crc8_checksum_slicing8");
+    bm_register_checksum<uint16_t, &crc16_checksum_bitwise>("crc16_checksum_bitwise");
+    bm_register_checksum<uint16_t, &crc16_checksum_table>("crc16_checksum_table");
+    bm_register_checksum<uint16_t, &crc16_checksum_slicing8>("crc16_checksum_slicing8");
+    bm_register_checksum<uint32_t, &crc32_checksum_bitwise>("crc32_checksum_bitwise");
+    bm_register_checksum<uint32_t, &crc32_checksum_table>("crc32_checksum_table");
+    bm_register_checksum<uint32_t, &crc32_checksum_slicing8>("crc32_checksum_slicing8");
+#if defined(BM_CHECKSUM_CRC32_HW)
+    bm_register_checksum<uint32_t, &crc32_checksum_hw>("crc32_checksum_hw");
+#endif
+    bm_register_checksum<uint32_t, &crc32c_checksum_bitwise>("crc32c_checksum_bitwise");
+    bm_register_checksum<uint32_t, &crc32c_checksum_table>("crc32c_checksum_table");
+    bm_register_checksum<uint32_t, &crc32c_checksum_slicing8>("crc32c_checksum_slicing8");
+#if defined(BM_CHECKSUM_CRC32C_HW)
+    bm_register_checksum<uint32_t, &crc32c_checksum_hw>("crc32c_checksum_hw");
+#endif
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -36,6 +36,10 @@
 #include <stdint.h> // needed for fixed-size data types
 #include <stddef.h> // needed for size_t data type
 
+#include "ByteMessageField.h" // needed for ByteMessageUninitialized
+#include "ByteMessageSpan.h"  // needed for span()
+#include "ByteMessageStats.h" // used internally (BM_STATS)
+
 /* Note: This header file also includes the complete implementation from ByteMessage.hpp! */
 
 /* 
@@ -46,44 +50,97 @@
  * - We do NOT derive from a common base class because this has no advantages:
  *   We do a *composition* with ByteMessageFields, thus we cannot access member
  *   variables in derived classes from pointers of base classes.
- * - The copy constructor only copies the array.
- * - The assignment operator does nothing. Members in derived classes
- *   are responsible for data copies.
+ * - The default constructor sets all bytes to zero. ByteMessage(bm_uninitialized)
+ *   only sets the type byte, for messages which are populated right away.
+ * - The copy constructor and the assignment operator are defaulted: they
+ *   copy the array, which compiles to a single memcpy(). Pointers of 
+ *   classic fields are never copied, they keep pointing to the array of
+ *   their own message. There are no move operations: moving a message is
+ *   copying its array.
+ * - ByteMessage<TYPE, SIZE> has a virtual destructor, so every object 
+ *   carries a vtable pointer. ByteMessagePlain<TYPE, SIZE> (i.e. VIRTUAL 
+ *   == false) does not: the object is just the array. It is standard-layout
+ *   and trivially copyable, and so is a derived class with compile-time
+ *   fields only. Such messages can be copied with memcpy() into DMA 
+ *   buffers, or placed on top of them. Never delete a derived message 
+ *   through a pointer to ByteMessagePlain.
+ * - Compile-time fields and checksums (i.e. ByteMessageField<T, POS>
+ *   and ByteMessageChecksum<T, POS, FUNC>) have no data members. They
+ *   are accessed through the templated member functions get(), set(),
+ *   calc(), update() and check(), which hand msgarr to them. Checks for
+ *   out-of-bounds positions are done at compile time.
+ * - set(field, value, checksum) patches the checksum in O(field size)
+ *   where the checksum algorithm allows it (see ByteMessageChecksumDelta.h).
+ * - operator[] checks the index, span() does not (see ByteMessageSpan.h).
+ *   Out-of-bounds indices of operator[] return a reference to the shared
+ *   constant bm_zero_byte, so there is no per-object sentinel.
  */
  
 
+/** @cond class_message_destructor */
+// Base class of ByteMessage: empty, or with a public virtual destructor
+template <bool VIRTUAL>
+class ByteMessageDestructor {};
+
+template <>
+class ByteMessageDestructor<true> {
+    public:
+        virtual ~ByteMessageDestructor() = default;
+};
+/** @endcond */
+
 /**
  * @class   ByteMessage
  * @brief   Templated base class for all ByteMessages.
  * @details This class is not meant to be instantiated directly, but to
  *          be derived from. It offers only basic functionality.
+ *          With VIRTUAL == false (see ByteMessagePlain), the class has 
+ *          no virtual destructor and no vtable pointer.
  */
-template <uint8_t TYPE, size_t SIZE>
-class ByteMessage {
+template <uint8_t TYPE, size_t SIZE, bool VIRTUAL = true>
+class ByteMessage : public ByteMessageDestructor<VIRTUAL> {
 
     public:
         ByteMessage(void);                              // default constructor
-        ByteMessage(const ByteMessage &bm);             // copy constructor
-        virtual ~ByteMessage() = default;               // default public virtual destructor
-        ByteMessage& operator= (const ByteMessage& bm); // assignment operator
+        explicit ByteMessage(ByteMessageUninitialized); // constructor without initialization, e.g. before populate()
+        ByteMessage(const ByteMessage &bm) = default;   // copy constructor, copies the whole array
+        ByteMessage& operator= (const ByteMessage& bm) = default; // assignment operator, copies the whole array
         const uint8_t& operator[](size_t index) const;  // read-only subscript operator
 
         static constexpr uint8_t type = TYPE;           ///< The numeric type of the message.
         static constexpr size_t  size = SIZE;           ///< The size of the underlying array.
 
         // return pointer to constant value(s)
-        virtual const uint8_t* get_ptr(void) const final; 
+        const uint8_t* get_ptr(void) const; 
+
+        // return unchecked read-only span of the whole array
+        ByteMessageSpan<const uint8_t> span(void) const;
 
         // populate message from raw byte array
-        virtual bool populate(const uint8_t * raw_message, size_t message_size) final; 
+        bool populate(const uint8_t * raw_message, size_t message_size); 
+
+        // access compile-time fields
+        template <class FIELD> typename FIELD::value_type get(const FIELD &field) const;
+        template <class FIELD> void set(const FIELD &field, typename FIELD::value_type value);
+        template <class FIELD, class CHECKSUM> void set(const FIELD &field, typename FIELD::value_type value, const CHECKSUM &checksum);
+
+        // access compile-time checksums
+        template <class CHECKSUM> typename CHECKSUM::value_type calc(const CHECKSUM &checksum) const;
+        template <class CHECKSUM> void update(const CHECKSUM &checksum);
+        template <class CHECKSUM> bool check(const CHECKSUM &checksum) const;
             
     protected:
         uint8_t msgarr[SIZE];                           ///< The underlying array to hold the actual message data.
-    
-    private:
-        const uint8_t blackhole = 0;                    ///< constant to return if operator[] is used with out-of-bounds index
 };
 
+/**
+ * @brief   Non-polymorphic base class for messages.
+ * @details Same as ByteMessage, but without virtual destructor. Example:
+ *          class Point3DPlain : public ByteMessagePlain<24, 14> { ... };
+ */
+template <uint8_t TYPE, size_t SIZE>
+using ByteMessagePlain = ByteMessage<TYPE, SIZE, false>;
+
 // include implementation file
 #include "ByteMessage.hpp"
 
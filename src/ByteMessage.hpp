@@ -37,40 +37,22 @@
  * @brief  The default constructor.
  * @note   Sets type automatically.
  */
-template <uint8_t TYPE, size_t SIZE>
-ByteMessage<TYPE, SIZE>::ByteMessage(void)
-    : msgarr{0}, blackhole{0} {
+template <uint8_t TYPE, size_t SIZE, bool VIRTUAL>
+ByteMessage<TYPE, SIZE, VIRTUAL>::ByteMessage(void)
+    : msgarr{0} {
     msgarr[0] = TYPE;
 }
 
-// implement copy constructor
+// implement constructor without initialization
 /**
- * @brief  The copy constructor
- * @param  bm
- *         A reference to a ByteMessage object.
- * @note   Copies the whole array msgarr.
+ * @brief  Constructor which leaves the underlying array uninitialized.
+ * @note   Sets type automatically. All other bytes have unspecified 
+ *         values until they are written, e.g. with populate(). Derived 
+ *         classes get this constructor with "using ByteMessage::ByteMessage;".
  */
-template <uint8_t TYPE, size_t SIZE>
-ByteMessage<TYPE, SIZE>::ByteMessage(const ByteMessage<TYPE, SIZE>& bm) {
-    memcpy(msgarr, bm.msgarr, SIZE);
-}
-
-// implement assignment operator
-// assignment operator does nothing! The real assignment must happen on
-// the level of the members (ByteMessageField, ByteMessageChecksum, and
-// ByteMessageFieldBlob).
-/**
- * @brief  The copy-assignment operator 
- * @param  bm
- *         A reference to a ByteMessage object.
- * @return A reference to a ByteMessage object.
- * @note   The copy-assignment operator really does nothing. There is @b
- *         no copying of the underlying array. Data must be copied by the
- *         data members in the derived class(es).
- */
-template <uint8_t TYPE, size_t SIZE>
-ByteMessage<TYPE, SIZE>& ByteMessage<TYPE, SIZE>::operator= (const ByteMessage<TYPE, SIZE>&) { // note: no named parameter to prevent compiler warning
-    return *this;
+template <uint8_t TYPE, size_t SIZE, bool VIRTUAL>
+ByteMessage<TYPE, SIZE, VIRTUAL>::ByteMessage(ByteMessageUninitialized) {
+    msgarr[0] = TYPE;
 }
 
 // implement read-only subscript operator
@@ -87,14 +69,11 @@ ByteMessage<TYPE, SIZE>& ByteMessage<TYPE, SIZE>::operator= (const ByteMessage<T
  *          The index into the underlying array.
  * @return  A constant reference to the element in the underlying array.
  */
-template <uint8_t TYPE, size_t SIZE>
-const uint8_t& ByteMessage<TYPE, SIZE>::operator[] (size_t index) const {
-    if (index < SIZE) {
-        return msgarr[index];
-    }
-    else {
-        return blackhole;
-    }
+template <uint8_t TYPE, size_t SIZE, bool VIRTUAL>
+const uint8_t& ByteMessage<TYPE, SIZE, VIRTUAL>::operator[] (size_t index) const {
+    BM_ASSERT_INDEX(index, SIZE);
+    // select the address instead of branching
+    return *((index < SIZE) ? msgarr + index : &bm_zero_byte);
 }
 
 // implement get_ptr()
@@ -103,11 +82,24 @@ const uint8_t& ByteMessage<TYPE, SIZE>::operator[] (size_t index) const {
  * @return A pointer to the underlying array. Note that the pointer is 
  *         read-only, you cannot change the data in the array through it.
  */
-template <uint8_t TYPE, size_t SIZE>
-const uint8_t* ByteMessage<TYPE, SIZE>::get_ptr(void) const {
+template <uint8_t TYPE, size_t SIZE, bool VIRTUAL>
+const uint8_t* ByteMessage<TYPE, SIZE, VIRTUAL>::get_ptr(void) const {
     return msgarr;
 }
 
+// implement span()
+/**
+ * @brief  Get an unchecked read-only span of the underlying array.
+ * @details Use this for loops over many bytes. The subscript operator of
+ *         the span does not check the index (unless BM_DEBUG_BOUNDS is
+ *         defined), and range-based for loops work.
+ * @return A span of all SIZE bytes, including the type byte.
+ */
+template <uint8_t TYPE, size_t SIZE, bool VIRTUAL>
+ByteMessageSpan<const uint8_t> ByteMessage<TYPE, SIZE, VIRTUAL>::span(void) const {
+    return ByteMessageSpan<const uint8_t>{msgarr, SIZE};
+}
+
 // implement populate()
 /**
  * @brief  Populate the a ByteMessage with data from an array.
@@ -123,14 +115,124 @@ const uint8_t* ByteMessage<TYPE, SIZE>::get_ptr(void) const {
  *         bytes expected for this type of message AND if the first byte
  *         in raw_message reflects the correct type.
  */
-template <uint8_t TYPE, size_t SIZE>
-bool ByteMessage<TYPE, SIZE>::populate(const uint8_t * raw_message, size_t message_size) {
+template <uint8_t TYPE, size_t SIZE, bool VIRTUAL>
+bool ByteMessage<TYPE, SIZE, VIRTUAL>::populate(const uint8_t * raw_message, size_t message_size) {
     // only allow population of internal array if type and size are both correct
-    if ( (SIZE != message_size) || (*raw_message != TYPE) ) {
+    if (SIZE != message_size) {
+        bm_stats_count(TYPE, &ByteMessageStatsSnapshot::populate_size_rejects);
+        return false;
+    }
+    else if (*raw_message != TYPE) {
+        bm_stats_count(TYPE, &ByteMessageStatsSnapshot::populate_type_rejects);
         return false;
     }
     else {
         memcpy(msgarr, raw_message, SIZE);
+        bm_stats_count(TYPE, &ByteMessageStatsSnapshot::populate_ok);
         return true;
     }
 }
+
+// implement get() for compile-time fields
+/**
+ * @brief  Get the value of a compile-time field (or checksum).
+ * @param  field
+ *         A ByteMessageField<T, POS> or ByteMessageChecksum<T, POS, FUNC>,
+ *         usually a static constexpr member of the derived class.
+ * @return The value stored in the message for this field.
+ * @note   Fields which do not fit into the message (or overlap with
+ *         the type byte) are rejected at compile time.
+ */
+template <uint8_t TYPE, size_t SIZE, bool VIRTUAL>
+template <class FIELD>
+typename FIELD::value_type ByteMessage<TYPE, SIZE, VIRTUAL>::get(const FIELD &) const {
+    static_assert(FIELD::pos > 0 && FIELD::pos + FIELD::size <= SIZE, "field does not fit into the message");
+    return FIELD::get(msgarr);
+}
+
+// implement set() for compile-time fields
+/**
+ * @brief  Set the value of a compile-time field.
+ * @param  field
+ *         A ByteMessageField<T, POS>, usually a static constexpr member
+ *         of the derived class.
+ * @param  value
+ *         The value to write to the message.
+ * @note   Fields which do not fit into the message (or overlap with
+ *         the type byte) are rejected at compile time.
+ */
+template <uint8_t TYPE, size_t SIZE, bool VIRTUAL>
+template <class FIELD>
+void ByteMessage<TYPE, SIZE, VIRTUAL>::set(const FIELD &, typename FIELD::value_type value) {
+    static_assert(FIELD::pos > 0 && FIELD::pos + FIELD::size <= SIZE, "field does not fit into the message");
+    FIELD::set(msgarr, value);
+}
+
+// implement set() for compile-time fields, with checksum patch
+/**
+ * @brief  Set the value of a compile-time field and patch a checksum.
+ * @param  field
+ *         A ByteMessageField<T, POS>, usually a static constexpr member
+ *         of the derived class.
+ * @param  value
+ *         The value to write to the message.
+ * @param  checksum
+ *         A ByteMessageChecksum<T, POS, FUNC> whose stored value is
+ *         valid before the call. It is adjusted to the new field value.
+ * @note   For XOR, two's complement and one's complement checksums the
+ *         cost is O(field size) instead of O(message size).
+ */
+template <uint8_t TYPE, size_t SIZE, bool VIRTUAL>
+template <class FIELD, class CHECKSUM>
+void ByteMessage<TYPE, SIZE, VIRTUAL>::set(const FIELD &, typename FIELD::value_type value, const CHECKSUM &) {
+    static_assert(FIELD::pos > 0 && FIELD::pos + FIELD::size <= SIZE, "field does not fit into the message");
+    static_assert(CHECKSUM::pos > 0 && CHECKSUM::pos + CHECKSUM::size <= SIZE, "checksum does not fit into the message");
+    uint8_t old_data[FIELD::size];
+    memcpy(old_data, msgarr+FIELD::pos, FIELD::size);
+    FIELD::set(msgarr, value);
+    CHECKSUM::patch(msgarr, FIELD::pos, old_data, FIELD::size);
+}
+
+// implement calc() for compile-time checksums
+/**
+ * @brief  Calculate a compile-time checksum, but do not store it.
+ * @param  checksum
+ *         A ByteMessageChecksum<T, POS, FUNC>, usually a static constexpr 
+ *         member of the derived class.
+ * @return The calculated checksum.
+ */
+template <uint8_t TYPE, size_t SIZE, bool VIRTUAL>
+template <class CHECKSUM>
+typename CHECKSUM::value_type ByteMessage<TYPE, SIZE, VIRTUAL>::calc(const CHECKSUM &) const {
+    static_assert(CHECKSUM::pos > 0 && CHECKSUM::pos + CHECKSUM::size <= SIZE, "checksum does not fit into the message");
+    return CHECKSUM::calc(msgarr);
+}
+
+// implement update() for compile-time checksums
+/**
+ * @brief  Calculate a compile-time checksum and store it.
+ * @param  checksum
+ *         A ByteMessageChecksum<T, POS, FUNC>, usually a static constexpr 
+ *         member of the derived class.
+ */
+template <uint8_t TYPE, size_t SIZE, bool VIRTUAL>
+template <class CHECKSUM>
+void ByteMessage<TYPE, SIZE, VIRTUAL>::update(const CHECKSUM &) {
+    static_assert(CHECKSUM::pos > 0 && CHECKSUM::pos + CHECKSUM::size <= SIZE, "checksum does not fit into the message");
+    CHECKSUM::update(msgarr);
+}
+
+// implement check() for compile-time checksums
+/**
+ * @brief  Check if the (re-)calculated checksum matches the stored checksum.
+ * @param  checksum
+ *         A ByteMessageChecksum<T, POS, FUNC>, usually a static constexpr 
+ *         member of the derived class.
+ * @return true if calculated and stored checksum match exacly, false otherwise.
+ */
+template <uint8_t TYPE, size_t SIZE, bool VIRTUAL>
+template <class CHECKSUM>
+bool ByteMessage<TYPE, SIZE, VIRTUAL>::check(const CHECKSUM &) const {
+    static_assert(CHECKSUM::pos > 0 && CHECKSUM::pos + CHECKSUM::size <= SIZE, "checksum does not fit into the message");
+    return CHECKSUM::check(msgarr);
+}
@@ -0,0 +1,127 @@
+/**
+ * @file    ByteMessageBatch.h
+ * @brief   Header file for the ByteMessageBatch class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageBatch_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ByteMessageBatch_h
+#define ByteMessageBatch_h
+
+#include <stdint.h> // needed for fixed-size data types
+#include <stddef.h> // needed for size_t data type
+
+#include "ByteMessageTraits.h" // used internally
+
+/* Note: This header file also includes the complete implementation from ByteMessageBatch.hpp! */
+
+/* 
+ * Important points:
+ * - ByteMessageBatch<MSG> serializes and verifies many messages of the 
+ *   same type at once. Frames are stored back to back in one buffer, 
+ *   i.e. frame i starts at buffer + i*MSG::size.
+ * - All functions are static. The checksum of MSG is found at compile 
+ *   time (see ByteMessageTraits.h), so there is no function call through 
+ *   a pointer per message for compile-time checksums, and the same checksum
+ *   kernel runs for all messages in a tight loop.
+ * - encode() takes an array of message objects, updates their checksums 
+ *   and copies them into the buffer.
+ * - encode_columns() builds frames directly from arrays of field values 
+ *   ("structure of arrays"), without any message object. This only works 
+ *   with compile-time fields and checksums (or no checksum at all).
+ *   Bytes not covered by any column are zero.
+ * - verify() checks type and checksum of frames in a buffer.
+ */
+
+/**
+ * @struct  ByteMessageColumn
+ * @brief   Array of values for one compile-time field, see bm_column().
+ */
+template <class FIELD>
+struct ByteMessageColumn {
+    using field_type = FIELD;                   ///< type of the compile-time field
+    const typename FIELD::value_type * values;  ///< one value per message
+};
+
+/**
+ * @brief  Create a column for ByteMessageBatch::encode_columns().
+ * @param  field
+ *         A compile-time field ByteMessageField<T, POS>.
+ * @param  values
+ *         Array with one value per message.
+ * @return A ByteMessageColumn referring to values.
+ */
+template <class FIELD>
+constexpr ByteMessageColumn<FIELD> bm_column(const FIELD &, const typename FIELD::value_type * values) {
+    return ByteMessageColumn<FIELD>{values};
+}
+
+/** @cond batch_helpers */
+// check that the fields of all columns fit into a message of SIZE bytes
+template <size_t SIZE, class... COLUMNS>
+struct ByteMessageColumnsFit {
+    static constexpr bool value = true;
+};
+template <size_t SIZE, class FIRST, class... REST>
+struct ByteMessageColumnsFit<SIZE, FIRST, REST...> {
+    static constexpr bool value = FIRST::field_type::pos > 0 && FIRST::field_type::pos + FIRST::field_type::size <= SIZE && 
+                                  ByteMessageColumnsFit<SIZE, REST...>::value;
+};
+/** @endcond */
+
+/**
+ * @class   ByteMessageBatch
+ * @brief   Serialize and verify arrays of messages of type MSG.
+ * @details MSG must be a class derived from ByteMessage. Usage:
+ * 
+ *              SensorData msgs[100];
+ *              uint8_t txbuffer[100*SensorData::size];
+ *              ByteMessageBatch<SensorData>::encode(msgs, 100, txbuffer, sizeof(txbuffer));
+ */
+template <class MSG>
+class ByteMessageBatch {
+
+    public:
+        static constexpr uint8_t type = MSG::type;  ///< The numeric type of the messages.
+        static constexpr size_t  size = MSG::size;  ///< The size of one frame.
+
+        // update checksums of messages and copy them into buffer
+        static bool encode(MSG * msgs, size_t count, uint8_t * buffer, size_t buffer_size);
+
+        // build frames from arrays of field values
+        template <class... COLUMNS> 
+        static bool encode_columns(uint8_t * buffer, size_t buffer_size, size_t count, const COLUMNS &... columns);
+
+        // check type and checksum of frames, return number of correct frames
+        static size_t verify(const uint8_t * buffer, size_t count, bool * results = nullptr);
+};
+
+// include implementation file
+#include "ByteMessageBatch.hpp"
+
+#endif
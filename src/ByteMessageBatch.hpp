@@ -0,0 +1,124 @@
+/**
+ * @file    ByteMessageBatch.hpp
+ * @brief   Implementation file for the ByteMessageBatch class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageBatch_hpp License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h> // needed for memcpy() and memset()
+
+// implement encode()
+/**
+ * @brief  Update checksums of messages and copy them into buffer.
+ * @param  msgs
+ *         Array of count message objects.
+ * @param  count
+ *         The number of messages.
+ * @param  buffer
+ *         The output buffer.
+ * @param  buffer_size
+ *         The number of bytes in buffer.
+ * @return true if all messages were copied into buffer, false otherwise.
+ *         If false, nothing was changed.
+ * @note   buffer must be able to hold count*size bytes. The checksum of 
+ *         every message object is updated as well.
+ */
+template <class MSG>
+bool ByteMessageBatch<MSG>::encode(MSG * msgs, size_t count, uint8_t * buffer, size_t buffer_size) {
+    if (buffer_size / size < count) {
+        return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+        ByteMessageTraits<MSG>::update(msgs[i]);
+        memcpy(buffer, msgs[i].get_ptr(), size);
+        buffer += size;
+    }
+    return true;
+}
+
+// implement encode_columns()
+/**
+ * @brief  Build frames from arrays of field values.
+ * @param  buffer
+ *         The output buffer.
+ * @param  buffer_size
+ *         The number of bytes in buffer.
+ * @param  count
+ *         The number of frames to build.
+ * @param  columns
+ *         Any number of columns, created with bm_column(MSG::field, values).
+ *         Every array of values must hold count elements.
+ * @return true if all frames were built, false otherwise.
+ *         If false, nothing was changed.
+ * @note   Only compile-time fields can be used. The checksum of every 
+ *         frame is updated. Bytes not covered by any column are zero.
+ */
+template <class MSG>
+template <class... COLUMNS>
+bool ByteMessageBatch<MSG>::encode_columns(uint8_t * buffer, size_t buffer_size, size_t count, const COLUMNS &... columns) {
+    static_assert(ByteMessageColumnsFit<size, COLUMNS...>::value, "field does not fit into message");
+    if (buffer_size / size < count) {
+        return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+        buffer[0] = type;
+        memset(buffer+1, 0, size-1);
+        // set all columns in order (a fold expression would need C++17)
+        const bool done[] = { true, (COLUMNS::field_type::set(buffer, columns.values[i]), true)... };
+        (void)done;
+        ByteMessageTraits<MSG>::update(buffer);
+        buffer += size;
+    }
+    return true;
+}
+
+// implement verify()
+/**
+ * @brief  Check type and checksum of frames in a buffer.
+ * @param  buffer
+ *         Buffer with count frames, stored back to back.
+ * @param  count
+ *         The number of frames in buffer.
+ * @param  results
+ *         Optional array of count bools. If given, results[i] is set to
+ *         true if frame i is correct and to false otherwise.
+ * @return The number of correct frames, i.e. count if all frames are correct.
+ */
+template <class MSG>
+size_t ByteMessageBatch<MSG>::verify(const uint8_t * buffer, size_t count, bool * results) {
+    size_t correct = 0;
+    for (size_t i = 0; i < count; i++) {
+        const bool ok = (buffer[0] == type) && ByteMessageTraits<MSG>::check(buffer);
+        if (results != nullptr) {
+            results[i] = ok;
+        }
+        correct += ok ? 1 : 0;
+        buffer += size;
+    }
+    return correct;
+}
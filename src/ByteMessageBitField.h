@@ -0,0 +1,123 @@
+/**
+ * @file    ByteMessageBitField.h
+ * @brief   Header file for the ByteMessageBitField class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageBitField_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ByteMessageBitField_h
+#define ByteMessageBitField_h
+
+#include <stdint.h> // needed for fixed-size data types
+#include <stddef.h> // needed for size_t data type
+
+/* Note: This header file also includes the complete implementation from ByteMessageBitField.hpp! */
+
+/** @cond bitfield_internals */
+// set() and get() are constexpr from C++14 on (needed by ByteMessageConstant only)
+#if (__cplusplus >= 201402L)
+    #define BM_BITFIELD_CONSTEXPR constexpr
+#else
+    #define BM_BITFIELD_CONSTEXPR
+#endif
+/** @endcond */
+
+/* 
+ * Important points:
+ * - ByteMessageBitField<OFFSET, BITPOS, WIDTH, T> stores a value of type T
+ *   in WIDTH bits. Several bit fields can share the same byte(s), e.g. a
+ *   3 bit mode and a 5 bit level in one byte.
+ * - Bits are numbered in network order: bit 0 is the most significant bit
+ *   of the byte at index OFFSET, bit 8 is the most significant bit of the 
+ *   byte at OFFSET+1, and so on. The value is stored most significant bit
+ *   first in bits BITPOS ... BITPOS+WIDTH-1. BITPOS must be smaller than 8.
+ *   A field may cross byte boundaries, but must not span more than 8 bytes.
+ * - Like the compile-time ByteMessageField<T, POS>, bit fields have no data
+ *   members. Declare them as "static constexpr" members of a message and 
+ *   access them with msg.set(msg.field, value) and msg.get(msg.field), 
+ *   through a ByteMessageView or in a ByteMessageConstant.
+ * - Masks and shifts are compile-time constants. Only the bytes spanned by 
+ *   the field are read and written, all other bits are preserved.
+ * - T can be an unsigned or signed integer type, bool or an enumeration 
+ *   with a fixed underlying type. Signed values are stored in two's 
+ *   complement and sign-extended when read. Bits of a value which do not 
+ *   fit into WIDTH bits are silently discarded.
+ */
+
+/** @cond bitfield_internals */
+// smallest unsigned integer type holding BYTES bytes
+template <size_t BYTES> struct ByteMessageBitFieldWord                  { using type = uint64_t; };
+template <>             struct ByteMessageBitFieldWord<1>               { using type = uint8_t;  };
+template <>             struct ByteMessageBitFieldWord<2>               { using type = uint16_t; };
+template <>             struct ByteMessageBitFieldWord<3>               { using type = uint32_t; };
+template <>             struct ByteMessageBitFieldWord<4>               { using type = uint32_t; };
+/** @endcond */
+
+/**
+ * @class   ByteMessageBitField
+ * @brief   Templated class for sub-byte data fields in ByteMessage objects.
+ * @details Usage:
+ * 
+ *              static constexpr ByteMessageBitField<1, 0, 3> mode{};  // index 1, upper 3 bits
+ *              static constexpr ByteMessageBitField<1, 3, 5> level{}; // index 1, lower 5 bits
+ */
+template <size_t OFFSET, size_t BITPOS, size_t WIDTH, class T = uint8_t>
+class ByteMessageBitField final {
+
+    static_assert(BITPOS < 8, "BITPOS must be smaller than 8, increase OFFSET instead");
+    static_assert(WIDTH > 0 && WIDTH <= 8*sizeof(T), "WIDTH must be between 1 and the number of bits in T");
+    static_assert(BITPOS + WIDTH <= 64, "bit field must not span more than 8 bytes");
+
+    public:
+        using value_type = T;                                          ///< The data type of the field.
+        static constexpr size_t pos    = OFFSET;                       ///< Index of the first byte spanned by the field.
+        static constexpr size_t size   = (BITPOS + WIDTH + 7) / 8;     ///< Number of bytes spanned by the field.
+        static constexpr size_t bitpos = BITPOS;                       ///< Position of the most significant bit within the first byte.
+        static constexpr size_t width  = WIDTH;                        ///< Number of bits.
+
+        // set value of field in message starting at msg
+        static BM_BITFIELD_CONSTEXPR void set(uint8_t * msg, T value);
+        // get value of field from message starting at msg
+        static BM_BITFIELD_CONSTEXPR T get(const uint8_t * msg);
+
+    private:
+        using word_type = typename ByteMessageBitFieldWord<size>::type;
+        static constexpr size_t    shift     = 8*size - BITPOS - WIDTH;                                               // position of least significant bit within word
+        static constexpr word_type value_mask = (WIDTH == 8*sizeof(word_type)) ? static_cast<word_type>(~word_type{0}) 
+                                                                               : static_cast<word_type>((word_type{1} << WIDTH) - 1);
+        static constexpr word_type word_mask  = static_cast<word_type>(value_mask << shift);                          // bits of field within word
+        static constexpr bool      is_signed  = static_cast<T>(-1) < static_cast<T>(0);
+
+        static BM_BITFIELD_CONSTEXPR word_type load(const uint8_t * ptr);
+        static BM_BITFIELD_CONSTEXPR void      store(uint8_t * ptr, word_type word);
+};
+
+// include implementation
+#include "ByteMessageBitField.hpp"
+
+#endif
@@ -0,0 +1,95 @@
+/**
+ * @file    ByteMessageBitField.hpp
+ * @brief   Implementation file for the ByteMessageBitField class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageBitField_hpp License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/** @cond bitfield_internals */
+// read the bytes spanned by the field as big-endian word
+template <size_t OFFSET, size_t BITPOS, size_t WIDTH, class T>
+BM_BITFIELD_CONSTEXPR typename ByteMessageBitField<OFFSET, BITPOS, WIDTH, T>::word_type ByteMessageBitField<OFFSET, BITPOS, WIDTH, T>::load(const uint8_t * ptr) {
+    word_type word = ptr[0];
+    for (size_t i = 1; i < size; i++) {
+        word = static_cast<word_type>((word << 8) | ptr[i]);
+    }
+    return word;
+}
+
+// write big-endian word to the bytes spanned by the field
+template <size_t OFFSET, size_t BITPOS, size_t WIDTH, class T>
+BM_BITFIELD_CONSTEXPR void ByteMessageBitField<OFFSET, BITPOS, WIDTH, T>::store(uint8_t * ptr, word_type word) {
+    for (size_t i = size; i > 0; i--) {
+        ptr[i-1] = static_cast<uint8_t>(word);
+        word = static_cast<word_type>(word >> 8);
+    }
+}
+/** @endcond */
+
+/**
+ * @brief      Set value of a ByteMessageBitField.
+ * @param      msg
+ *             Pointer to the beginning of the message array. The value 
+ *             is written to the bytes msg+OFFSET ... msg+OFFSET+size-1.
+ *             Bits outside of the field are not changed.
+ * @param      value
+ *             The value to write. Bits which do not fit into WIDTH bits
+ *             are discarded.
+ * @note       Usually not called directly, but through ByteMessage::set().
+ */
+template <size_t OFFSET, size_t BITPOS, size_t WIDTH, class T>
+BM_BITFIELD_CONSTEXPR void ByteMessageBitField<OFFSET, BITPOS, WIDTH, T>::set(uint8_t * msg, T value) {
+    const word_type bits = static_cast<word_type>((static_cast<word_type>(value) & value_mask) << shift);
+    if (size == 1 && word_mask == 0xFF) {
+        // field covers complete byte, no need to preserve anything
+        msg[OFFSET] = bits;
+    }
+    else {
+        const word_type word = load(msg+OFFSET);
+        store(msg+OFFSET, static_cast<word_type>((word & static_cast<word_type>(~word_mask)) | bits));
+    }
+}
+
+/**
+ * @brief      Get value of a ByteMessageBitField.
+ * @param      msg
+ *             Pointer to the beginning of the message array. The value 
+ *             is read from the bytes msg+OFFSET ... msg+OFFSET+size-1.
+ * @return     The decoded value, sign-extended for signed types.
+ * @note       Usually not called directly, but through ByteMessage::get().
+ */
+template <size_t OFFSET, size_t BITPOS, size_t WIDTH, class T>
+BM_BITFIELD_CONSTEXPR T ByteMessageBitField<OFFSET, BITPOS, WIDTH, T>::get(const uint8_t * msg) {
+    word_type raw = static_cast<word_type>((load(msg+OFFSET) >> shift) & value_mask);
+    if (is_signed && WIDTH < 8*sizeof(word_type)) {
+        if (raw & static_cast<word_type>(word_type{1} << (WIDTH-1))) {
+            raw = static_cast<word_type>(raw | static_cast<word_type>(~value_mask));
+        }
+    }
+    return static_cast<T>(raw);
+}
@@ -35,8 +35,12 @@
 
 #include <stdint.h> // needed for fixed-size data types
 #include <stddef.h> // needed for size_t data type
+#include <string.h> // needed for memcpy()
 
-#include "ByteMessageField.h" // used internally
+#include "ByteMessageField.h"          // used internally
+#include "ByteMessageChecksumDelta.h"  // used for patch()
+#include "ByteMessageChecksumStream.h" // used for messages split into two parts
+#include "ByteMessageStats.h"          // used internally (BM_STATS)
 
 /* 
  * Note: All function definitions are included in the header file.
@@ -59,18 +63,69 @@
  * @brief   Templated class for all checksum fields in ByteMessage objects.
  * @details This class is meant to be used in a composition in a class
  *          derived from ByteMessage, i.e. as a data member.
- *          It facilitates calculation, of a checksum. The checksum
- *          function must be specified in the constructor.
+ *          It facilitates calculation, of a checksum. 
+ *          The class comes in two flavors:
+ *          - ByteMessageChecksum<T>: Position and checksum function must
+ *            be specified in the constructor.
+ *            ByteMessageChecksum<T, BM_RUNTIME_POSITION, FUNC> (or the
+ *            alias ByteMessageBoundChecksum<T, FUNC>) binds the checksum
+ *            function at compile time. Only the position is given in 
+ *            the constructor, no function pointer is stored and calls
+ *            to FUNC are direct. FUNC is only inlined if its definition
+ *            is visible, not for the library functions in .cpp files 
+ *            (unless with link-time optimization).
+ *          - ByteMessageChecksum<T, POS, FUNC>: Position and checksum 
+ *            function are fixed at compile time. Instances have no
+ *            data members. They operate on the array of the owning
+ *            message (or view) which is handed to the static member
+ *            functions.
  */
-template <class T>
-class ByteMessageChecksum final {
+template <class T, size_t POS = BM_RUNTIME_POSITION, T (*FUNC)(const uint8_t*, size_t) = nullptr>
+class ByteMessageChecksum;
+
+/** @cond class_checksum_function_storage */
+/*
+ * Storage for the checksum function of the run-time flavor. If FUNC is
+ * nullptr, the function pointer given in the constructor is stored.
+ * Otherwise, this class is empty and FUNC is called directly. 
+ * Note: Specialized over BOUND, as a specialization for FUNC == nullptr
+ * cannot be written (type of FUNC depends on T).
+ */
+template <class T, T (*FUNC)(const uint8_t*, size_t), bool BOUND = bm_function_bound<T (*)(const uint8_t*, size_t), FUNC>::value>
+class ByteMessageChecksumFunction {
+    protected:
+        constexpr ByteMessageChecksumFunction(T (*checksumFunctionPtr)(const uint8_t*, size_t)) 
+            : checksum_function{checksumFunctionPtr} {}
+        T call_function(const uint8_t * data, size_t length) const { return checksum_function(data, length); }
+        T (*get_function(void) const)(const uint8_t*, size_t) { return checksum_function; }
+    private:
+        // A function pointer to a function returning T and two function parameters: uint8_t* and size_t.
+        // All checksum functions take a data array as a uint8_t* and a length as size_t.
+        T (*checksum_function)(const uint8_t*, size_t);
+};
+
+template <class T, T (*FUNC)(const uint8_t*, size_t)>
+class ByteMessageChecksumFunction<T, FUNC, true> {
+    protected:
+        constexpr ByteMessageChecksumFunction(T (*)(const uint8_t*, size_t)) {}
+        static T call_function(const uint8_t * data, size_t length) { return FUNC(data, length); }
+        static constexpr T (*get_function(void))(const uint8_t*, size_t) { return FUNC; }
+};
+/** @endcond */
+
+/** @cond class_specialization_runtime */
+template <class T, T (*FUNC)(const uint8_t*, size_t)>
+class ByteMessageChecksum<T, BM_RUNTIME_POSITION, FUNC> final : private ByteMessageChecksumFunction<T, FUNC> {
     public:
         // number of bytes for data type T
         static constexpr size_t size = sizeof(T); ///< Size of the checksum value in bytes
 
-        // constructor - there is constructor without arguments
+        // constructor with checksum function given at run time (FUNC == nullptr only)
         ByteMessageChecksum(uint8_t* baseptr, size_t position, T (*checksumFunctionPtr)(const uint8_t*, size_t));
 
+        // constructor with checksum function bound at compile time (FUNC != nullptr only)
+        ByteMessageChecksum(uint8_t* baseptr, size_t position);
+
         // delete copy constructor
         ByteMessageChecksum(const ByteMessageChecksum &copy) = delete;
         
@@ -92,6 +147,9 @@ class ByteMessageChecksum final {
         // check if calculaded checksum matches stored checksum
         bool check(void) const;
 
+        // adjust stored checksum after bytes at ptr have changed
+        void patch(const uint8_t * ptr, const uint8_t * old_data, size_t length);
+
     private:
         // variables
         uint8_t* const bptr; // the base pointer, starting address for the checksum
@@ -100,13 +158,59 @@ class ByteMessageChecksum final {
         // Also the length of the checksum calculation.
         const size_t pos;    
         
-        // A function pointer to a function returning T and two function parameters: uint8_t* and size_t.
-        // All checksum functions take a data array as a uint8_t* and a length as size_t.
-        T (*checksum_function)(const uint8_t*, size_t);
-        
         // internal ByteMessageField to handle interface to array.
         ByteMessageField<T> bmf;
 };
+/** @endcond */
+
+/**
+ * @brief   Alias for a checksum with run-time position, but with the
+ *          checksum function bound at compile time.
+ * @details Example: ByteMessageBoundChecksum<uint16_t, &fletcher16_checksum> checksum{msgarr, 13};
+ */
+template <class T, T (*FUNC)(const uint8_t*, size_t)>
+using ByteMessageBoundChecksum = ByteMessageChecksum<T, BM_RUNTIME_POSITION, FUNC>;
+
+/*
+ * Compile-time flavor: no data members. Declare instances as 
+ * "static constexpr" members of the message class and access them 
+ * through the message, e.g. p.update(p.checksum) and p.check(p.checksum).
+ */
+template <class T, size_t POS, T (*FUNC)(const uint8_t*, size_t)>
+class ByteMessageChecksum final {
+    static_assert(bm_function_bound<T (*)(const uint8_t*, size_t), FUNC>::value, "compile-time checksums need a checksum function");
+
+    public:
+        using value_type = T;                     ///< The data type of the checksum.
+        static constexpr size_t size = sizeof(T); ///< Size of the checksum value in bytes
+        static constexpr size_t pos  = POS;       ///< Position of the checksum, also the number of bytes covered.
+        static constexpr T (*function)(const uint8_t*, size_t) = FUNC; ///< The checksum function.
+
+        // calculate checksum over msg and return it without storing it
+        static T calc(const uint8_t * msg);
+
+        // return checksum stored in msg without calculating it
+        static T get(const uint8_t * msg);
+
+        // calculate checksum over msg and store it in msg
+        static void update(uint8_t * msg);
+
+        // check if calculaded checksum matches checksum stored in msg
+        static bool check(const uint8_t * msg);
+
+        // adjust checksum stored in msg after bytes at msg+offset have changed
+        static void patch(uint8_t * msg, size_t offset, const uint8_t * old_data, size_t length);
+
+        // calculate and check checksum of a message split into two parts, e.g. wrapped around a circular buffer
+        static T calc(const uint8_t * first, size_t first_length, const uint8_t * second);
+        static T get(const uint8_t * first, size_t first_length, const uint8_t * second);
+        static bool check(const uint8_t * first, size_t first_length, const uint8_t * second);
+
+    private:
+        // calc() for two non-empty parts, with and without streaming functions
+        static T calc(const uint8_t * first, size_t first_length, const uint8_t * second, bm_bool_tag<true>);
+        static T calc(const uint8_t * first, size_t first_length, const uint8_t * second, bm_bool_tag<false>);
+};
 
 // include implementation
 #include "ByteMessageChecksum.hpp"
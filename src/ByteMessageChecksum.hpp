@@ -54,13 +54,40 @@
  *         array access the same limitation for usable data types apply.
  *         However, this should not be a problem. Checksum functions 
  *         should return unsigned integers, and those are usable.
+ * @note   Only available if no checksum function is bound at compile time.
  */
-template <class T>
-ByteMessageChecksum<T>::ByteMessageChecksum(uint8_t* baseptr, size_t position, T (*checksumFunctionPtr)(const uint8_t*, size_t))
-    : bptr{baseptr}, 
+template <class T, T (*FUNC)(const uint8_t*, size_t)>
+ByteMessageChecksum<T, BM_RUNTIME_POSITION, FUNC>::ByteMessageChecksum(uint8_t* baseptr, size_t position, T (*checksumFunctionPtr)(const uint8_t*, size_t))
+    : ByteMessageChecksumFunction<T, FUNC>{checksumFunctionPtr},
+      bptr{baseptr}, 
       pos{position}, 
-      checksum_function{checksumFunctionPtr}, 
-      bmf{baseptr, position} {} // empty body
+      bmf{baseptr, position} {
+    static_assert(!bm_function_bound<T (*)(const uint8_t*, size_t), FUNC>::value, 
+                  "the checksum function is bound at compile time, use the other constructor");
+}
+
+// constructor
+/**
+ * @brief  The constructor for checksums with a checksum function bound at compile time
+ * @param  baseptr
+ *         A pointer to the beginning on an array of bytes. The checksum 
+ *         value is written to and read from this array.
+ * @param  position
+ *         A position into the array given by messagepointer. The checksum
+ *         is calculated from baseptr up to but not including baseptr+position.
+ * @note   Only available if a checksum function FUNC is given as template
+ *         parameter. The instance does not store a function pointer and
+ *         FUNC is called directly.
+ */
+template <class T, T (*FUNC)(const uint8_t*, size_t)>
+ByteMessageChecksum<T, BM_RUNTIME_POSITION, FUNC>::ByteMessageChecksum(uint8_t* baseptr, size_t position)
+    : ByteMessageChecksumFunction<T, FUNC>{FUNC},
+      bptr{baseptr}, 
+      pos{position}, 
+      bmf{baseptr, position} {
+    static_assert(bm_function_bound<T (*)(const uint8_t*, size_t), FUNC>::value, 
+                  "there is no checksum function, use the other constructor");
+}
 
 // assignment operator
 // Delegates some work to assignment operator of ByteMessageField.
@@ -73,8 +100,8 @@ ByteMessageChecksum<T>::ByteMessageChecksum(uint8_t* baseptr, size_t position, T
  * @return A reference to a ByteMessageChecksum object.
  * @note   Copies the underlying ByteMessageField.
  */
-template <class T>
-ByteMessageChecksum<T>& ByteMessageChecksum<T>::operator= (const ByteMessageChecksum<T> &bmcs) {
+template <class T, T (*FUNC)(const uint8_t*, size_t)>
+ByteMessageChecksum<T, BM_RUNTIME_POSITION, FUNC>& ByteMessageChecksum<T, BM_RUNTIME_POSITION, FUNC>::operator= (const ByteMessageChecksum<T, BM_RUNTIME_POSITION, FUNC> &bmcs) {
     if (this == &bmcs) return *this;
     bmf = bmcs.bmf;
     return *this;
@@ -85,9 +112,9 @@ ByteMessageChecksum<T>& ByteMessageChecksum<T>::operator= (const ByteMessageChec
  * @brief  Calculate the checksum, but do not store it.
  * @return The calculated checksum.
  */
-template <class T>
-T ByteMessageChecksum<T>::calc(void) const {
-    return checksum_function(bptr, pos);
+template <class T, T (*FUNC)(const uint8_t*, size_t)>
+T ByteMessageChecksum<T, BM_RUNTIME_POSITION, FUNC>::calc(void) const {
+    return this->call_function(bptr, pos);
 }
 
 // get()
@@ -95,8 +122,8 @@ T ByteMessageChecksum<T>::calc(void) const {
  * @brief  Get the stored checksum, do not (re-)calculate it.
  * @return The stored checksum.
  */
-template <class T>
-T ByteMessageChecksum<T>::get(void) const {
+template <class T, T (*FUNC)(const uint8_t*, size_t)>
+T ByteMessageChecksum<T, BM_RUNTIME_POSITION, FUNC>::get(void) const {
     return bmf.get();
 }
 
@@ -104,17 +131,209 @@ T ByteMessageChecksum<T>::get(void) const {
 /**
  * @brief  Calculate the checksum and store it.
  */
-template <class T>
-void ByteMessageChecksum<T>::update(void)  {
-    bmf.set( calc() );
+template <class T, T (*FUNC)(const uint8_t*, size_t)>
+void ByteMessageChecksum<T, BM_RUNTIME_POSITION, FUNC>::update(void)  {
+    bm_stats_count(bptr[0], &ByteMessageStatsSnapshot::checksum_updates);
+    bmf.set( bm_stats_timed(bptr[0], [this] { return calc(); }) );
+}
+
+// check()
+/**
+ * @brief  Check if the (re-)calculated checksum matches the stored checksum.
+ * @return true if calculated and stored checksum match exacly, false otherwise.
+ */
+template <class T, T (*FUNC)(const uint8_t*, size_t)>
+bool ByteMessageChecksum<T, BM_RUNTIME_POSITION, FUNC>::check(void) const {
+    return bm_stats_check(bptr[0], bm_stats_timed(bptr[0], [this] { return calc(); }) == get());
+}
+
+// patch()
+/**
+ * @brief  Adjust the stored checksum after some bytes have changed.
+ * @details If a delta function exists for the checksum function (XOR,
+ *         two's complement sum, one's complement sum), the new checksum 
+ *         is derived from the stored checksum and the old and new values 
+ *         of the changed bytes. Otherwise, the checksum is recalculated.
+ * @param  ptr
+ *         Pointer to the first changed byte in the array. The bytes must 
+ *         already contain their new values.
+ * @param  old_data
+ *         Pointer to a copy of the old values of the changed bytes.
+ * @param  length
+ *         Number of changed bytes.
+ * @note   The stored checksum must be valid before the change. Changed
+ *         bytes not covered by the checksum are ignored.
+ */
+template <class T, T (*FUNC)(const uint8_t*, size_t)>
+void ByteMessageChecksum<T, BM_RUNTIME_POSITION, FUNC>::patch(const uint8_t * ptr, const uint8_t * old_data, size_t length) {
+    if (ptr < bptr || ptr >= bptr+pos) return; // not covered by checksum
+    const size_t offset = ptr - bptr;
+    if (length > pos - offset) length = pos - offset;
+    const auto delta_function = ByteMessageChecksumDelta<T>::find(this->get_function());
+    if (delta_function == nullptr) {
+        update();
+        return;
+    }
+    bmf.set( delta_function(bmf.get(), offset, old_data, ptr, length) );
+}
+
+/* member function definitions for compile-time flavor */
+
+// calc()
+/**
+ * @brief  Calculate the checksum over bytes 0 to POS-1 of msg, but do not store it.
+ * @param  msg
+ *         Pointer to the beginning of the message array.
+ * @return The calculated checksum.
+ */
+template <class T, size_t POS, T (*FUNC)(const uint8_t*, size_t)>
+T ByteMessageChecksum<T, POS, FUNC>::calc(const uint8_t * msg) {
+    return FUNC(msg, POS);
+}
+
+// get()
+/**
+ * @brief  Get the checksum stored at msg+POS, do not (re-)calculate it.
+ * @param  msg
+ *         Pointer to the beginning of the message array.
+ * @return The stored checksum.
+ */
+template <class T, size_t POS, T (*FUNC)(const uint8_t*, size_t)>
+T ByteMessageChecksum<T, POS, FUNC>::get(const uint8_t * msg) {
+    return ByteMessageFieldCodec<T>::decode(msg+POS);
+}
+
+// update()
+/**
+ * @brief  Calculate the checksum and store it at msg+POS.
+ * @param  msg
+ *         Pointer to the beginning of the message array.
+ */
+template <class T, size_t POS, T (*FUNC)(const uint8_t*, size_t)>
+void ByteMessageChecksum<T, POS, FUNC>::update(uint8_t * msg) {
+    bm_stats_count(msg[0], &ByteMessageStatsSnapshot::checksum_updates);
+    ByteMessageFieldCodec<T>::encode(msg+POS, bm_stats_timed(msg[0], [msg] { return calc(msg); }));
 }
 
 // check()
 /**
  * @brief  Check if the (re-)calculated checksum matches the stored checksum.
+ * @param  msg
+ *         Pointer to the beginning of the message array.
  * @return true if calculated and stored checksum match exacly, false otherwise.
  */
-template <class T>
-bool ByteMessageChecksum<T>::check(void) const {
-    return calc() == get();
+template <class T, size_t POS, T (*FUNC)(const uint8_t*, size_t)>
+bool ByteMessageChecksum<T, POS, FUNC>::check(const uint8_t * msg) {
+    return bm_stats_check(msg[0], bm_stats_timed(msg[0], [msg] { return calc(msg); }) == get(msg));
+}
+
+// patch()
+/**
+ * @brief  Adjust the checksum stored at msg+POS after some bytes have changed.
+ * @details The delta function for FUNC is looked up at compile time. If
+ *         there is none, the checksum is recalculated.
+ * @param  msg
+ *         Pointer to the beginning of the message array. The changed 
+ *         bytes must already contain their new values.
+ * @param  offset
+ *         Position of the first changed byte within the message.
+ * @param  old_data
+ *         Pointer to a copy of the old values of the changed bytes.
+ * @param  length
+ *         Number of changed bytes.
+ * @note   The stored checksum must be valid before the change. Changed
+ *         bytes not covered by the checksum are ignored.
+ */
+template <class T, size_t POS, T (*FUNC)(const uint8_t*, size_t)>
+void ByteMessageChecksum<T, POS, FUNC>::patch(uint8_t * msg, size_t offset, const uint8_t * old_data, size_t length) {
+    constexpr auto delta_function = ByteMessageChecksumDelta<T>::template find<FUNC>();
+    if (offset >= POS) return; // not covered by checksum
+    if (length > POS - offset) length = POS - offset;
+    if (!ByteMessageChecksumDelta<T>::template has<FUNC>()) {
+        update(msg);
+    }
+    else {
+        ByteMessageFieldCodec<T>::encode(msg+POS, delta_function(get(msg), offset, old_data, msg+offset, length));
+    }
+}
+
+// calc() for messages split into two parts
+/**
+ * @brief  Calculate the checksum over a message split into two parts.
+ * @details Use this for a frame which wraps around the end of a circular
+ *         buffer. Checksums with streaming functions (see 
+ *         ByteMessageChecksumStream) are calculated in place, all others
+ *         over a copy of the first POS bytes on the stack.
+ * @param  first
+ *         Pointer to the first part of the message.
+ * @param  first_length
+ *         Number of bytes in the first part, may be 0.
+ * @param  second
+ *         Pointer to the rest of the message.
+ * @return The checksum, identical to calc() over the contiguous message.
+ */
+template <class T, size_t POS, T (*FUNC)(const uint8_t*, size_t)>
+T ByteMessageChecksum<T, POS, FUNC>::calc(const uint8_t * first, size_t first_length, const uint8_t * second) {
+    if (first_length >= POS) return FUNC(first, POS);
+    if (first_length == 0) return FUNC(second, POS);
+    return calc(first, first_length, second, bm_bool_tag<ByteMessageChecksumStream<T, FUNC>::supported>{});
+}
+
+// calc() for messages split into two parts, with streaming functions
+template <class T, size_t POS, T (*FUNC)(const uint8_t*, size_t)>
+T ByteMessageChecksum<T, POS, FUNC>::calc(const uint8_t * first, size_t first_length, const uint8_t * second, bm_bool_tag<true>) {
+    using stream = ByteMessageChecksumStream<T, FUNC>;
+    typename stream::context_type ctx;
+    stream::init(ctx);
+    stream::update(ctx, first, first_length);
+    stream::update(ctx, second, POS - first_length);
+    return stream::final(ctx);
+}
+
+// calc() for messages split into two parts, without streaming functions
+template <class T, size_t POS, T (*FUNC)(const uint8_t*, size_t)>
+T ByteMessageChecksum<T, POS, FUNC>::calc(const uint8_t * first, size_t first_length, const uint8_t * second, bm_bool_tag<false>) {
+    uint8_t covered[POS];
+    memcpy(covered, first, first_length);
+    memcpy(covered+first_length, second, POS - first_length);
+    return FUNC(covered, POS);
+}
+
+// get() for messages split into two parts
+/**
+ * @brief  Get the checksum stored in a message split into two parts.
+ * @param  first
+ *         Pointer to the first part of the message.
+ * @param  first_length
+ *         Number of bytes in the first part, may be 0.
+ * @param  second
+ *         Pointer to the rest of the message.
+ * @return The stored checksum. Its bytes may be split between both parts.
+ */
+template <class T, size_t POS, T (*FUNC)(const uint8_t*, size_t)>
+T ByteMessageChecksum<T, POS, FUNC>::get(const uint8_t * first, size_t first_length, const uint8_t * second) {
+    if (first_length >= POS + sizeof(T)) return get(first);
+    if (first_length <= POS) return ByteMessageFieldCodec<T>::decode(second + (POS - first_length));
+    uint8_t stored[sizeof(T)];
+    const size_t split = first_length - POS;
+    memcpy(stored, first+POS, split);
+    memcpy(stored+split, second, sizeof(T) - split);
+    return ByteMessageFieldCodec<T>::decode(stored);
+}
+
+// check() for messages split into two parts
+/**
+ * @brief  Check the checksum of a message split into two parts.
+ * @param  first
+ *         Pointer to the first part of the message.
+ * @param  first_length
+ *         Number of bytes in the first part, may be 0.
+ * @param  second
+ *         Pointer to the rest of the message.
+ * @return true if calculated and stored checksum match exactly, false otherwise.
+ */
+template <class T, size_t POS, T (*FUNC)(const uint8_t*, size_t)>
+bool ByteMessageChecksum<T, POS, FUNC>::check(const uint8_t * first, size_t first_length, const uint8_t * second) {
+    const uint8_t type = (first_length > 0) ? first[0] : second[0];
+    return bm_stats_check(type, bm_stats_timed(type, [=] { return calc(first, first_length, second); }) == get(first, first_length, second));
 }
@@ -0,0 +1,194 @@
+/**
+ * @file    ByteMessageChecksumDelta.h
+ * @brief   Header file for the ByteMessageChecksumDelta helper
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageChecksumDelta_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef ByteMessageChecksumDelta_h
+#define ByteMessageChecksumDelta_h
+
+#include <stdint.h> // needed for fixed-size data types
+#include <stddef.h> // needed for size_t data type
+
+#include "ByteMessageField.h" // needed for bm_same_function
+#include "bm_checksum_xor.h"
+#include "bm_checksum_twosum.h"
+#include "bm_checksum_onesum.h"
+
+/* 
+ * Important points:
+ * - Some checksums can be updated from the old checksum and the old and
+ *   new values of the changed bytes alone: XOR, two's complement sum and
+ *   one's complement sum. Cost is O(number of changed bytes) instead of
+ *   O(message size).
+ * - ByteMessageChecksumDelta<T>::find() maps a checksum function to its
+ *   delta function. find(f) takes the function at run time, find<F>() 
+ *   as template argument. The compile-time flavor of ByteMessageChecksum
+ *   uses find<F>() and has<F>(), which are constant expressions with 
+ *   every compiler option (GCC with -fsanitize=undefined does not fold
+ *   comparisons of function pointers).
+ * - Checksums without a delta function (Fletcher, Luhn, user supplied
+ *   functions) map to nullptr. Callers fall back to a full recalculation.
+ */
+
+/**
+ * @struct  ByteMessageChecksumDelta
+ * @brief   Maps checksum functions to their delta update functions.
+ * @details A delta function calculates the new checksum from the old 
+ *          checksum, the position of the changed bytes and their old and
+ *          new values. The signature of all delta functions is
+ *          T delta(T checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length).
+ */
+template <class T>
+struct ByteMessageChecksumDelta {
+    using checksum_function_type = T (*)(const uint8_t*, size_t);                         ///< type of a checksum function
+    using delta_function_type = T (*)(T, size_t, const uint8_t*, const uint8_t*, size_t); ///< type of a delta function
+
+    /**
+     * @brief  Find the delta function for a checksum function.
+     * @return nullptr, there are no delta functions for this data type.
+     */
+    static constexpr delta_function_type find(checksum_function_type) {
+        return nullptr;
+    }
+
+    /**
+     * @brief  Find the delta function for a checksum function given as template argument.
+     * @return nullptr, there are no delta functions for this data type.
+     */
+    template <checksum_function_type F>
+    static constexpr delta_function_type find(void) {
+        return nullptr;
+    }
+
+    /**
+     * @brief  Check if there is a delta function for a checksum function given as template argument.
+     * @return false, there are no delta functions for this data type.
+     */
+    template <checksum_function_type F>
+    static constexpr bool has(void) {
+        return false;
+    }
+};
+
+/** @cond delta_specializations */
+
+template <>
+struct ByteMessageChecksumDelta<uint8_t> {
+    using checksum_function_type = uint8_t (*)(const uint8_t*, size_t);
+    using delta_function_type = uint8_t (*)(uint8_t, size_t, const uint8_t*, const uint8_t*, size_t);
+    static constexpr delta_function_type find(checksum_function_type f) {
+        return (f == &xor8_checksum)    ? &xor8_checksum_delta    :
+               (f == &sum8_checksum)    ? &sum8_checksum_delta    :
+               (f == &onesum8_checksum) ? &onesum8_checksum_delta : nullptr;
+    }
+    template <checksum_function_type F>
+    static constexpr delta_function_type find(void) {
+        return bm_same_function<checksum_function_type, F, &xor8_checksum>::value    ? &xor8_checksum_delta    :
+               bm_same_function<checksum_function_type, F, &sum8_checksum>::value    ? &sum8_checksum_delta    :
+               bm_same_function<checksum_function_type, F, &onesum8_checksum>::value ? &onesum8_checksum_delta : nullptr;
+    }
+    template <checksum_function_type F>
+    static constexpr bool has(void) {
+        return bm_same_function<checksum_function_type, F, &xor8_checksum>::value ||
+               bm_same_function<checksum_function_type, F, &sum8_checksum>::value ||
+               bm_same_function<checksum_function_type, F, &onesum8_checksum>::value;
+    }
+};
+
+template <>
+struct ByteMessageChecksumDelta<uint16_t> {
+    using checksum_function_type = uint16_t (*)(const uint8_t*, size_t);
+    using delta_function_type = uint16_t (*)(uint16_t, size_t, const uint8_t*, const uint8_t*, size_t);
+    static constexpr delta_function_type find(checksum_function_type f) {
+        return (f == &xor16_checksum)    ? &xor16_checksum_delta    :
+               (f == &sum16_checksum)    ? &sum16_checksum_delta    :
+               (f == &onesum16_checksum) ? &onesum16_checksum_delta : nullptr;
+    }
+    template <checksum_function_type F>
+    static constexpr delta_function_type find(void) {
+        return bm_same_function<checksum_function_type, F, &xor16_checksum>::value    ? &xor16_checksum_delta    :
+               bm_same_function<checksum_function_type, F, &sum16_checksum>::value    ? &sum16_checksum_delta    :
+               bm_same_function<checksum_function_type, F, &onesum16_checksum>::value ? &onesum16_checksum_delta : nullptr;
+    }
+    template <checksum_function_type F>
+    static constexpr bool has(void) {
+        return bm_same_function<checksum_function_type, F, &xor16_checksum>::value ||
+               bm_same_function<checksum_function_type, F, &sum16_checksum>::value ||
+               bm_same_function<checksum_function_type, F, &onesum16_checksum>::value;
+    }
+};
+
+template <>
+struct ByteMessageChecksumDelta<uint32_t> {
+    using checksum_function_type = uint32_t (*)(const uint8_t*, size_t);
+    using delta_function_type = uint32_t (*)(uint32_t, size_t, const uint8_t*, const uint8_t*, size_t);
+    static constexpr delta_function_type find(checksum_function_type f) {
+        return (f == &xor32_checksum)    ? &xor32_checksum_delta    :
+               (f == &sum32_checksum)    ? &sum32_checksum_delta    :
+               (f == &onesum32_checksum) ? &onesum32_checksum_delta : nullptr;
+    }
+    template <checksum_function_type F>
+    static constexpr delta_function_type find(void) {
+        return bm_same_function<checksum_function_type, F, &xor32_checksum>::value    ? &xor32_checksum_delta    :
+               bm_same_function<checksum_function_type, F, &sum32_checksum>::value    ? &sum32_checksum_delta    :
+               bm_same_function<checksum_function_type, F, &onesum32_checksum>::value ? &onesum32_checksum_delta : nullptr;
+    }
+    template <checksum_function_type F>
+    static constexpr bool has(void) {
+        return bm_same_function<checksum_function_type, F, &xor32_checksum>::value ||
+               bm_same_function<checksum_function_type, F, &sum32_checksum>::value ||
+               bm_same_function<checksum_function_type, F, &onesum32_checksum>::value;
+    }
+};
+
+template <>
+struct ByteMessageChecksumDelta<uint64_t> {
+    using checksum_function_type = uint64_t (*)(const uint8_t*, size_t);
+    using delta_function_type = uint64_t (*)(uint64_t, size_t, const uint8_t*, const uint8_t*, size_t);
+    static constexpr delta_function_type find(checksum_function_type f) {
+        return (f == &xor64_checksum) ? &xor64_checksum_delta :
+               (f == &sum64_checksum) ? &sum64_checksum_delta : nullptr;
+    }
+    template <checksum_function_type F>
+    static constexpr delta_function_type find(void) {
+        return bm_same_function<checksum_function_type, F, &xor64_checksum>::value ? &xor64_checksum_delta :
+               bm_same_function<checksum_function_type, F, &sum64_checksum>::value ? &sum64_checksum_delta : nullptr;
+    }
+    template <checksum_function_type F>
+    static constexpr bool has(void) {
+        return bm_same_function<checksum_function_type, F, &xor64_checksum>::value ||
+               bm_same_function<checksum_function_type, F, &sum64_checksum>::value;
+    }
+};
+
+/** @endcond */
+
+#endif
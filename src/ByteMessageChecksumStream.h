@@ -0,0 +1,114 @@
+/**
+ * @file    ByteMessageChecksumStream.h
+ * @brief   Header file for the ByteMessageChecksumStream helper
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageChecksumStream_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ByteMessageChecksumStream_h
+#define ByteMessageChecksumStream_h
+
+#include <stdint.h> // needed for fixed-size data types
+#include <stddef.h> // needed for size_t data type
+
+#include "bm_checksum_xor.h"
+#include "bm_checksum_twosum.h"
+#include "bm_checksum_onesum.h"
+#include "bm_checksum_fletcher.h"
+#include "bm_checksum_luhn.h"
+
+/* 
+ * Important points:
+ * - Some checksums can be calculated over several buffers in a row 
+ *   without copying them to one contiguous array: XOR, two's complement
+ *   sum, one's complement sum, Fletcher and Luhn (base 256).
+ * - ByteMessageChecksumStream<T, FUNC> maps a checksum function to its
+ *   context type and its _init(), _update() and _final() functions at 
+ *   compile time. "supported" is false for other checksums (CRC, user 
+ *   supplied functions). Callers fall back to copying the data.
+ * - The result is identical to calling FUNC once over all bytes.
+ */
+
+/**
+ * @struct  ByteMessageChecksumStream
+ * @brief   Maps checksum functions to their streaming functions.
+ * @details Usage:
+ *          using stream = ByteMessageChecksumStream<uint16_t, &fletcher16_checksum>;
+ *          stream::context_type ctx;
+ *          stream::init(ctx);
+ *          stream::update(ctx, first, first_length);
+ *          stream::update(ctx, second, second_length);
+ *          uint16_t result = stream::final(ctx);
+ */
+template <class T, T (*FUNC)(const uint8_t*, size_t)>
+struct ByteMessageChecksumStream {
+    static constexpr bool supported = false; ///< false, there are no streaming functions for FUNC.
+};
+
+/** @cond stream_specializations */
+
+template <class T, class CTX, void (*INIT)(CTX&), void (*UPDATE)(CTX&, const uint8_t*, size_t), T (*FINAL)(const CTX&)>
+struct ByteMessageChecksumStreamImpl {
+    static constexpr bool supported = true;
+    using context_type = CTX;
+    static void init(CTX &ctx) { INIT(ctx); }
+    static void update(CTX &ctx, const uint8_t * data, size_t length) { UPDATE(ctx, data, length); }
+    static T final(const CTX &ctx) { return FINAL(ctx); }
+};
+
+#define BM_CHECKSUM_STREAM(T, NAME) \
+    template <> struct ByteMessageChecksumStream<T, &NAME> \
+        : ByteMessageChecksumStreamImpl<T, NAME##_context, &NAME##_init, &NAME##_update, &NAME##_final> {}
+
+BM_CHECKSUM_STREAM(uint8_t,  xor8_checksum);
+BM_CHECKSUM_STREAM(uint16_t, xor16_checksum);
+BM_CHECKSUM_STREAM(uint32_t, xor32_checksum);
+BM_CHECKSUM_STREAM(uint64_t, xor64_checksum);
+
+BM_CHECKSUM_STREAM(uint8_t,  sum8_checksum);
+BM_CHECKSUM_STREAM(uint16_t, sum16_checksum);
+BM_CHECKSUM_STREAM(uint32_t, sum32_checksum);
+BM_CHECKSUM_STREAM(uint64_t, sum64_checksum);
+
+BM_CHECKSUM_STREAM(uint8_t,  onesum8_checksum);
+BM_CHECKSUM_STREAM(uint16_t, onesum16_checksum);
+BM_CHECKSUM_STREAM(uint32_t, onesum32_checksum);
+
+BM_CHECKSUM_STREAM(uint8_t,  fletcher8_checksum);
+BM_CHECKSUM_STREAM(uint16_t, fletcher16_checksum);
+BM_CHECKSUM_STREAM(uint32_t, fletcher32_checksum);
+
+#undef BM_CHECKSUM_STREAM
+
+template <>
+struct ByteMessageChecksumStream<uint8_t, &luhn256_checksum>
+    : ByteMessageChecksumStreamImpl<uint8_t, luhn_checksum_context, &luhn256_checksum_init, &luhn_checksum_update, &luhn_checksum_final> {};
+
+/** @endcond */
+
+#endif
@@ -0,0 +1,210 @@
+/**
+ * @file    ByteMessageConstant.h
+ * @brief   Header file for the ByteMessageConstant class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageConstant_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef ByteMessageConstant_h
+#define ByteMessageConstant_h
+
+#if (__cplusplus < 201402L)
+    #error "ByteMessageConstant needs C++14 (constexpr functions which modify the frame)"
+#endif
+
+#include <stdint.h> // needed for fixed-size data types
+#include <stddef.h> // needed for size_t data type
+
+#include "ByteMessageField.h"
+#include "ByteMessageSpan.h"  // needed for bm_zero_byte
+#include "ByteMessageBitField.h"
+#include "ByteMessageChecksum.h"
+#include "bm_checksum_constexpr.h"
+#include "bm_checksum_xor.h"
+#include "bm_checksum_twosum.h"
+#include "bm_checksum_onesum.h"
+#include "bm_checksum_fletcher.h"
+#include "bm_checksum_luhn.h"
+#include "bm_checksum_crc.h"
+
+/* Note: This header file also includes the complete implementation from ByteMessageConstant.hpp! */
+
+/* 
+ * Important points:
+ * - ByteMessage objects cannot be constant expressions (their constructors
+ *   are not constexpr, and most have a virtual destructor). ByteMessageConstant<MSG> holds the raw frame of
+ *   a message of type MSG and is a literal type, so a complete frame 
+ *   with fixed field values and checksum can be built at compile time.
+ * - Only compile-time fields and checksums (ByteMessageField<T, POS>,
+ *   ByteMessageBitField and ByteMessageChecksum<T, POS, FUNC>) can be used.
+ * - Checksums are calculated with the constexpr kernels from 
+ *   bm_checksum_constexpr.h. ByteMessageChecksumKernel<T>::find<F>() maps 
+ *   the checksum functions of the library to them (by template argument,
+ *   comparing function pointers is not a constant expression for GCC 
+ *   with -fsanitize=undefined). Other checksum functions must be 
+ *   constexpr themselves.
+ * - Unlike the rest of the library, ByteMessageConstant needs C++14.
+ * - float and double fields need __builtin_bit_cast (GCC >= 11, clang).
+ *   Without it, setting such fields is rejected at compile time.
+ */
+
+/**
+ * @struct  ByteMessageChecksumKernel
+ * @brief   Maps checksum functions to their constexpr versions.
+ * @details find<F>() returns the constexpr version of a library checksum 
+ *          function F, or F itself if there is none.
+ */
+template <class T>
+struct ByteMessageChecksumKernel {
+    using checksum_function_type = T (*)(const uint8_t*, size_t); ///< type of a checksum function
+
+    /**
+     * @brief  Find the constexpr version of a checksum function given as template argument.
+     * @return F itself, there are no library functions for this data type.
+     */
+    template <checksum_function_type F>
+    static constexpr checksum_function_type find(void) {
+        return F;
+    }
+};
+
+/** @cond kernel_specializations */
+
+template <>
+struct ByteMessageChecksumKernel<uint8_t> {
+    using checksum_function_type = uint8_t (*)(const uint8_t*, size_t);
+    template <checksum_function_type F>
+    static constexpr checksum_function_type find(void) {
+        return bm_same_function<checksum_function_type, F, &xor8_checksum>::value      ? &xor8_checksum_constexpr      :
+               bm_same_function<checksum_function_type, F, &sum8_checksum>::value      ? &sum8_checksum_constexpr      :
+               bm_same_function<checksum_function_type, F, &onesum8_checksum>::value   ? &onesum8_checksum_constexpr   :
+               bm_same_function<checksum_function_type, F, &fletcher8_checksum>::value ? &fletcher8_checksum_constexpr :
+               bm_same_function<checksum_function_type, F, &luhn256_checksum>::value   ? &luhn256_checksum_constexpr   :
+               bm_same_function<checksum_function_type, F, &crc8_checksum>::value          ? &crc8_checksum_constexpr :
+               bm_same_function<checksum_function_type, F, &crc8_checksum_bitwise>::value  ? &crc8_checksum_constexpr :
+               bm_same_function<checksum_function_type, F, &crc8_checksum_table>::value    ? &crc8_checksum_constexpr :
+               bm_same_function<checksum_function_type, F, &crc8_checksum_slicing8>::value ? &crc8_checksum_constexpr : F;
+    }
+};
+
+template <>
+struct ByteMessageChecksumKernel<uint16_t> {
+    using checksum_function_type = uint16_t (*)(const uint8_t*, size_t);
+    template <checksum_function_type F>
+    static constexpr checksum_function_type find(void) {
+        return bm_same_function<checksum_function_type, F, &xor16_checksum>::value      ? &xor16_checksum_constexpr      :
+               bm_same_function<checksum_function_type, F, &sum16_checksum>::value      ? &sum16_checksum_constexpr      :
+               bm_same_function<checksum_function_type, F, &onesum16_checksum>::value   ? &onesum16_checksum_constexpr   :
+               bm_same_function<checksum_function_type, F, &fletcher16_checksum>::value ? &fletcher16_checksum_constexpr :
+               bm_same_function<checksum_function_type, F, &crc16_checksum>::value          ? &crc16_checksum_constexpr :
+               bm_same_function<checksum_function_type, F, &crc16_checksum_bitwise>::value  ? &crc16_checksum_constexpr :
+               bm_same_function<checksum_function_type, F, &crc16_checksum_table>::value    ? &crc16_checksum_constexpr :
+               bm_same_function<checksum_function_type, F, &crc16_checksum_slicing8>::value ? &crc16_checksum_constexpr : F;
+    }
+};
+
+template <>
+struct ByteMessageChecksumKernel<uint32_t> {
+    using checksum_function_type = uint32_t (*)(const uint8_t*, size_t);
+    template <checksum_function_type F>
+    static constexpr checksum_function_type find(void) {
+        return bm_same_function<checksum_function_type, F, &xor32_checksum>::value      ? &xor32_checksum_constexpr      :
+               bm_same_function<checksum_function_type, F, &sum32_checksum>::value      ? &sum32_checksum_constexpr      :
+               bm_same_function<checksum_function_type, F, &onesum32_checksum>::value   ? &onesum32_checksum_constexpr   :
+               bm_same_function<checksum_function_type, F, &fletcher32_checksum>::value ? &fletcher32_checksum_constexpr :
+               bm_same_function<checksum_function_type, F, &crc32_checksum>::value           ? &crc32_checksum_constexpr  :
+               bm_same_function<checksum_function_type, F, &crc32_checksum_bitwise>::value   ? &crc32_checksum_constexpr  :
+               bm_same_function<checksum_function_type, F, &crc32_checksum_table>::value     ? &crc32_checksum_constexpr  :
+               bm_same_function<checksum_function_type, F, &crc32_checksum_slicing8>::value  ? &crc32_checksum_constexpr  :
+#if defined(BM_CHECKSUM_CRC32_HW)
+               bm_same_function<checksum_function_type, F, &crc32_checksum_hw>::value        ? &crc32_checksum_constexpr  :
+#endif
+               bm_same_function<checksum_function_type, F, &crc32c_checksum>::value          ? &crc32c_checksum_constexpr :
+               bm_same_function<checksum_function_type, F, &crc32c_checksum_bitwise>::value  ? &crc32c_checksum_constexpr :
+               bm_same_function<checksum_function_type, F, &crc32c_checksum_table>::value    ? &crc32c_checksum_constexpr :
+               bm_same_function<checksum_function_type, F, &crc32c_checksum_slicing8>::value ? &crc32c_checksum_constexpr :
+#if defined(BM_CHECKSUM_CRC32C_HW)
+               bm_same_function<checksum_function_type, F, &crc32c_checksum_hw>::value       ? &crc32c_checksum_constexpr :
+#endif
+               F;
+    }
+};
+
+template <>
+struct ByteMessageChecksumKernel<uint64_t> {
+    using checksum_function_type = uint64_t (*)(const uint8_t*, size_t);
+    template <checksum_function_type F>
+    static constexpr checksum_function_type find(void) {
+        return bm_same_function<checksum_function_type, F, &xor64_checksum>::value ? &xor64_checksum_constexpr :
+               bm_same_function<checksum_function_type, F, &sum64_checksum>::value ? &sum64_checksum_constexpr : F;
+    }
+};
+
+/** @endcond */
+
+/**
+ * @class   ByteMessageConstant
+ * @brief   Raw frame of a message of type MSG which can be built at compile time.
+ * @details MSG must be a class derived from ByteMessage with compile-time
+ *          fields and checksums. All member functions are constexpr. The
+ *          setters return a reference to the object, so calls can be chained:
+ *          constexpr auto frame = ByteMessageConstant<Point3DCompact>{}.set(Point3DCompact::x, 1.0f).update(Point3DCompact::checksum);
+ */
+template <class MSG>
+class ByteMessageConstant {
+
+    public:
+        constexpr ByteMessageConstant(void);                      // create frame with type byte, all other bytes zero
+        constexpr const uint8_t& operator[](size_t index) const;  // read-only subscript operator
+
+        static constexpr uint8_t type = MSG::type;                ///< The numeric type of the message.
+        static constexpr size_t  size = MSG::size;                ///< The size of the frame.
+
+        // return pointer to constant frame data, e.g. for ByteMessage::populate()
+        constexpr const uint8_t* get_ptr(void) const;
+
+        // access compile-time fields
+        template <class FIELD> constexpr ByteMessageConstant& set(const FIELD &field, typename FIELD::value_type value);
+        template <size_t OFFSET, size_t BITPOS, size_t WIDTH, class T>
+        constexpr ByteMessageConstant& set(const ByteMessageBitField<OFFSET, BITPOS, WIDTH, T> &field, typename ByteMessageBitField<OFFSET, BITPOS, WIDTH, T>::value_type value);
+
+        // access compile-time checksums
+        template <class T, size_t POS, T (*FUNC)(const uint8_t*, size_t)> 
+        constexpr T calc(const ByteMessageChecksum<T, POS, FUNC> &checksum) const;
+        template <class CHECKSUM> constexpr ByteMessageConstant& update(const CHECKSUM &checksum);
+        template <class CHECKSUM> constexpr bool check(const CHECKSUM &checksum) const;
+
+    private:
+        uint8_t data[size];                                       // the frame
+};
+
+// include implementation file
+#include "ByteMessageConstant.hpp"
+
+#endif
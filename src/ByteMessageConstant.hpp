@@ -0,0 +1,220 @@
+/**
+ * @file    ByteMessageConstant.hpp
+ * @brief   Implementation file for the ByteMessageConstant class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageConstant_hpp License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/* constexpr encoding of values */
+
+/*
+ * ByteMessageFieldCodec uses memcpy(), which cannot be used in constant
+ * expressions. These overloads encode values big-endian byte by byte, 
+ * which gives exactly the same result. Fields in another byte order 
+ * are reversed afterwards.
+ */
+
+/** @cond constexpr_encoding */
+
+template <class T>
+constexpr void bm_constexpr_encode(uint8_t * ptr, T value) {
+    // all integer types: conversion to uint64_t is modulo 2^64, 
+    // i.e. the lower bytes are the two's complement representation
+    const uint64_t v = static_cast<uint64_t>(value);
+    constexpr size_t n = ByteMessageFieldCodec<T>::size;
+    for (size_t i = 0; i < n; i++) {
+        ptr[i] = static_cast<uint8_t>(v >> (8 * (n - 1 - i)));
+    }
+}
+
+constexpr void bm_constexpr_encode(uint8_t * ptr, bool value) {
+    *ptr = (value) ? 1 : 0;
+}
+
+#if defined(__has_builtin)
+    #if __has_builtin(__builtin_bit_cast)
+        #define BM_HAS_CONSTEXPR_BIT_CAST
+    #endif
+#endif
+
+#if defined(BM_HAS_CONSTEXPR_BIT_CAST)
+constexpr void bm_constexpr_encode(uint8_t * ptr, float value) {
+    static_assert(sizeof(uint32_t) == sizeof(float), "float has 32 bits");
+    bm_constexpr_encode<uint32_t>(ptr, __builtin_bit_cast(uint32_t, value));
+}
+#if (__SIZEOF_DOUBLE__ == 8)
+constexpr void bm_constexpr_encode(uint8_t * ptr, double value) {
+    bm_constexpr_encode<uint64_t>(ptr, __builtin_bit_cast(uint64_t, value));
+}
+#endif
+#else
+// no constexpr way to get the representation of floating point values
+void bm_constexpr_encode(uint8_t * ptr, float value) = delete;
+void bm_constexpr_encode(uint8_t * ptr, double value) = delete;
+#endif
+
+template <class T>
+constexpr T bm_constexpr_decode(const uint8_t * ptr) {
+    uint64_t v = 0;
+    constexpr size_t n = ByteMessageFieldCodec<T>::size;
+    for (size_t i = 0; i < n; i++) {
+        v = (v << 8) | ptr[i];
+    }
+    return static_cast<T>(v);
+}
+
+// reverse the bytes of a big-endian encoded value if byte order ORDER stores it the other way round
+template <class T, class ORDER>
+constexpr void bm_constexpr_reorder(uint8_t * ptr) {
+    if (bm_order_swap<T>(ByteMessageNetworkOrder{}) != bm_order_swap<T>(ORDER{})) {
+        constexpr size_t n = ByteMessageFieldCodec<T, ORDER>::size;
+        for (size_t i = 0; i < n / 2; i++) {
+            const uint8_t b = ptr[i];
+            ptr[i] = ptr[n - 1 - i];
+            ptr[n - 1 - i] = b;
+        }
+    }
+}
+
+/** @endcond */
+
+/* member function definitions */
+
+// implement default constructor
+/**
+ * @brief  The default constructor.
+ * @note   The type byte is set to MSG::type, all other bytes are zero,
+ *         exactly like in a default-constructed ByteMessage.
+ */
+template <class MSG>
+constexpr ByteMessageConstant<MSG>::ByteMessageConstant(void) : data{} {
+    data[0] = type;
+}
+
+// implement operator[]
+/**
+ * @brief  The read-only subscript operator.
+ * @param  index
+ *         The index into the frame.
+ * @return A const reference to the value at index, or to zero if index is out of bounds.
+ */
+template <class MSG>
+constexpr const uint8_t& ByteMessageConstant<MSG>::operator[](size_t index) const {
+    return (index < size) ? data[index] : bm_zero_byte;
+}
+
+// implement get_ptr()
+/**
+ * @brief  Return a pointer to the frame.
+ * @return A pointer to the first byte of the frame.
+ */
+template <class MSG>
+constexpr const uint8_t* ByteMessageConstant<MSG>::get_ptr(void) const {
+    return data;
+}
+
+// implement set() for compile-time fields
+/**
+ * @brief  Set the value of a compile-time field.
+ * @param  field
+ *         A ByteMessageField<T, POS>, usually a static constexpr member of MSG.
+ * @param  value
+ *         The value to write.
+ * @return A reference to this object.
+ */
+template <class MSG>
+template <class FIELD>
+constexpr ByteMessageConstant<MSG>& ByteMessageConstant<MSG>::set(const FIELD &, typename FIELD::value_type value) {
+    static_assert(FIELD::pos > 0 && FIELD::pos + FIELD::size <= size, "field does not fit into the message");
+    bm_constexpr_encode(data + FIELD::pos, value);
+    bm_constexpr_reorder<typename FIELD::value_type, typename FIELD::order>(data + FIELD::pos);
+    return *this;
+}
+
+// implement set() for bit fields
+/**
+ * @brief  Set the value of a bit field.
+ * @param  field
+ *         A ByteMessageBitField<OFFSET, BITPOS, WIDTH, T>, usually a static
+ *         constexpr member of MSG.
+ * @param  value
+ *         The value to write.
+ * @return A reference to this object.
+ */
+template <class MSG>
+template <size_t OFFSET, size_t BITPOS, size_t WIDTH, class T>
+constexpr ByteMessageConstant<MSG>& ByteMessageConstant<MSG>::set(const ByteMessageBitField<OFFSET, BITPOS, WIDTH, T> &, typename ByteMessageBitField<OFFSET, BITPOS, WIDTH, T>::value_type value) {
+    using FIELD = ByteMessageBitField<OFFSET, BITPOS, WIDTH, T>;
+    static_assert(FIELD::pos > 0 && FIELD::pos + FIELD::size <= size, "field does not fit into the message");
+    FIELD::set(data, value);
+    return *this;
+}
+
+// implement calc() for compile-time checksums
+/**
+ * @brief  Calculate a compile-time checksum, but do not store it.
+ * @param  checksum
+ *         A ByteMessageChecksum<T, POS, FUNC>, usually a static constexpr member of MSG.
+ * @return The calculated checksum.
+ */
+template <class MSG>
+template <class T, size_t POS, T (*FUNC)(const uint8_t*, size_t)>
+constexpr T ByteMessageConstant<MSG>::calc(const ByteMessageChecksum<T, POS, FUNC> &) const {
+    static_assert(POS > 0 && POS + sizeof(T) <= size, "checksum does not fit into the message");
+    constexpr auto kernel = ByteMessageChecksumKernel<T>::template find<FUNC>();
+    return kernel(data, POS);
+}
+
+// implement update() for compile-time checksums
+/**
+ * @brief  Calculate a compile-time checksum and store it.
+ * @param  checksum
+ *         A ByteMessageChecksum<T, POS, FUNC>, usually a static constexpr member of MSG.
+ * @return A reference to this object.
+ * @note   Call update() after all fields have been set.
+ */
+template <class MSG>
+template <class CHECKSUM>
+constexpr ByteMessageConstant<MSG>& ByteMessageConstant<MSG>::update(const CHECKSUM &checksum) {
+    bm_constexpr_encode<typename CHECKSUM::value_type>(data + CHECKSUM::pos, calc(checksum));
+    return *this;
+}
+
+// implement check() for compile-time checksums
+/**
+ * @brief  Check if the (re-)calculated checksum matches the stored checksum.
+ * @param  checksum
+ *         A ByteMessageChecksum<T, POS, FUNC>, usually a static constexpr member of MSG.
+ * @return true if calculated and stored checksum match exacly, false otherwise.
+ */
+template <class MSG>
+template <class CHECKSUM>
+constexpr bool ByteMessageConstant<MSG>::check(const CHECKSUM &checksum) const {
+    return calc(checksum) == bm_constexpr_decode<typename CHECKSUM::value_type>(data + CHECKSUM::pos);
+}
@@ -0,0 +1,169 @@
+/**
+ * @file    ByteMessageCriticalSection.h
+ * @brief   Header file for the ByteMessageCriticalSection class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageCriticalSection_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ByteMessageCriticalSection_h
+#define ByteMessageCriticalSection_h
+
+#include <stdint.h> // needed for fixed-size data types
+
+/* 
+ * Note: All function definitions are included in the header file.
+ *
+ * ByteMessageCriticalSection protects short sections of code which must
+ * not be interrupted, e.g. shared data structures which are used from an
+ * interrupt service routine and the main loop. It is a "scope guard": 
+ * The section starts in the constructor and ends in the destructor.
+ * - AVR: interrupts are disabled, the previous state is restored at the
+ *   end (so it is safe to use inside an ISR as well).
+ * - ARM Cortex-M: same, using PRIMASK.
+ * - ESP32: portENTER_CRITICAL_SAFE() on a shared spin lock, which also
+ *   disables interrupts and protects against the other core. Safe inside
+ *   an ISR.
+ * - ESP8266: interrupts are disabled with xt_rsil(), the previous state
+ *   is restored at the end. Safe inside an ISR.
+ * - RISC-V (other Arduino boards, machine mode): same, using the MIE bit 
+ *   of mstatus.
+ * - all other Arduino boards: noInterrupts() and interrupts(). The 
+ *   previous state cannot be saved, interrupts are always enabled at the
+ *   end. Inside an ISR, this enables interrupts before the ISR returns.
+ * - hosts (no Arduino): a spin lock on the flag handed to the 
+ *   constructor. This protects against other threads. Hosts have no 
+ *   interrupt service routines.
+ */
+
+#if defined(__arm__) && ( defined(__ARM_ARCH_6M__) || defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || \
+                          defined(__ARM_ARCH_8M_BASE__) || defined(__ARM_ARCH_8M_MAIN__) )
+    #define BM_CRITICAL_SECTION_PRIMASK
+#endif
+
+#if defined(__AVR__)
+    #include <avr/io.h>        // needed for SREG
+    #include <avr/interrupt.h> // needed for cli()
+#elif defined(BM_CRITICAL_SECTION_PRIMASK)
+    // no header needed
+#elif defined(ARDUINO)
+    #include <Arduino.h>       // needed for noInterrupts() etc. (and the ESP32/ESP8266 primitives)
+    #if defined(ARDUINO_ARCH_ESP32)
+        #define BM_CRITICAL_SECTION_ESP32
+    #elif defined(ARDUINO_ARCH_ESP8266)
+        #define BM_CRITICAL_SECTION_ESP8266
+    #elif defined(__riscv)
+        #define BM_CRITICAL_SECTION_RISCV
+    #else
+        #define BM_CRITICAL_SECTION_ARDUINO
+    #endif
+#endif
+
+/**
+ * @class   ByteMessageCriticalSection
+ * @brief   Scope guard which blocks interrupts (or other threads) while it exists.
+ */
+class ByteMessageCriticalSection final {
+    public:
+        // start critical section, lock_flag is only used for the spin lock on hosts
+        explicit ByteMessageCriticalSection(bool &lock_flag) {
+        #if defined(__AVR__)
+            (void) lock_flag;
+            sreg = SREG;
+            cli();
+        #elif defined(BM_CRITICAL_SECTION_PRIMASK)
+            (void) lock_flag;
+            __asm__ __volatile__ ("mrs %0, primask" : "=r" (primask) :: "memory");
+            __asm__ __volatile__ ("cpsid i" ::: "memory");
+        #elif defined(BM_CRITICAL_SECTION_ESP32)
+            (void) lock_flag;
+            portENTER_CRITICAL_SAFE(&mux());
+        #elif defined(BM_CRITICAL_SECTION_ESP8266)
+            (void) lock_flag;
+            ps = xt_rsil(15);
+        #elif defined(BM_CRITICAL_SECTION_RISCV)
+            (void) lock_flag;
+            __asm__ __volatile__ ("csrrci %0, mstatus, 8" : "=r" (mstatus) :: "memory");
+        #elif defined(BM_CRITICAL_SECTION_ARDUINO)
+            (void) lock_flag;
+            noInterrupts();
+        #else
+            flag = &lock_flag;
+            while (__atomic_test_and_set(flag, __ATOMIC_ACQUIRE)) {
+                // spin
+            }
+        #endif
+        }
+
+        // end critical section
+        ~ByteMessageCriticalSection(void) {
+        #if defined(__AVR__)
+            __asm__ __volatile__ ("" ::: "memory");
+            SREG = sreg;
+        #elif defined(BM_CRITICAL_SECTION_PRIMASK)
+            __asm__ __volatile__ ("msr primask, %0" :: "r" (primask) : "memory");
+        #elif defined(BM_CRITICAL_SECTION_ESP32)
+            portEXIT_CRITICAL_SAFE(&mux());
+        #elif defined(BM_CRITICAL_SECTION_ESP8266)
+            xt_wsr_ps(ps);
+        #elif defined(BM_CRITICAL_SECTION_RISCV)
+            __asm__ __volatile__ ("csrs mstatus, %0" :: "r" (mstatus & 8u) : "memory");
+        #elif defined(BM_CRITICAL_SECTION_ARDUINO)
+            interrupts();
+        #else
+            __atomic_clear(flag, __ATOMIC_RELEASE);
+        #endif
+        }
+
+        // no copies
+        ByteMessageCriticalSection(const ByteMessageCriticalSection &) = delete;
+        ByteMessageCriticalSection& operator= (const ByteMessageCriticalSection &) = delete;
+
+    private:
+    #if defined(__AVR__)
+        uint8_t sreg;   // saved status register (including interrupt flag)
+    #elif defined(BM_CRITICAL_SECTION_PRIMASK)
+        uint32_t primask; // saved interrupt mask
+    #elif defined(BM_CRITICAL_SECTION_ESP32)
+        // the spin lock shared by all critical sections
+        // (a local static of an inline function exists only once, an inline variable would need C++17)
+        static portMUX_TYPE& mux(void) {
+            static portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+            return lock;
+        }
+    #elif defined(BM_CRITICAL_SECTION_ESP8266)
+        uint32_t ps;    // saved processor state (including interrupt level)
+    #elif defined(BM_CRITICAL_SECTION_RISCV)
+        unsigned long mstatus; // saved machine status (including MIE bit)
+    #elif defined(BM_CRITICAL_SECTION_ARDUINO)
+        // nothing to save
+    #else
+        bool * flag;    // the spin lock
+    #endif
+};
+
+#endif
@@ -0,0 +1,146 @@
+/**
+ * @file    ByteMessageDispatcher.h
+ * @brief   Header file for the ByteMessageDispatcher class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageDispatcher_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ByteMessageDispatcher_h
+#define ByteMessageDispatcher_h
+
+#include <stdint.h> // needed for fixed-size data types
+#include <stddef.h> // needed for size_t data type
+
+#include "ByteMessageTraits.h" // used internally
+#include "ByteMessageView.h"   // used internally
+
+#if defined(__AVR__)
+    #include <avr/pgmspace.h>  // keep lookup table in flash on AVR
+#endif
+
+/* Note: This header file also includes the complete implementation from ByteMessageDispatcher.hpp! */
+
+/* 
+ * Important points:
+ * - The list of message classes is a template parameter pack. All 
+ *   tables are built at compile time.
+ * - Routing is done by a 256-entry lookup table keyed on the type byte,
+ *   so the cost does not depend on the number of registered messages.
+ * - Message types within one dispatcher must be unique. This is checked
+ *   at compile time.
+ * - The handler is any callable object which accepts all registered
+ *   message classes, e.g. a struct with one operator() per class
+ *   or a generic lambda (C++14).
+ */
+
+/**
+ * @brief   Result of a call to ByteMessageDispatcher::dispatch().
+ */
+enum class ByteMessageDispatchResult : uint8_t {
+    ok,                ///< message was handed to the handler
+    unknown_type,      ///< type byte does not belong to any registered message
+    size_mismatch,     ///< type is known, but size does not match
+    checksum_mismatch  ///< type and size are correct, but checksum is not
+};
+
+/** @cond dispatcher_table */
+// lookup table from type byte to (1-based) index into list of messages
+struct ByteMessageDispatchTable {
+    uint8_t index[256];  // 0 means "unknown type"
+};
+
+// compile-time helpers, defined outside of the class so they can be
+// used in static member initializers
+template <class... MSGS> constexpr ByteMessageDispatchTable bm_make_dispatch_table(void);
+template <class... MSGS> constexpr bool bm_types_unique(void);
+template <class... MSGS> constexpr size_t bm_max_size(void);
+/** @endcond */
+
+/**
+ * @class   ByteMessageDispatcher
+ * @brief   Compile-time registry of message classes with O(1) routing of raw frames.
+ * @details Usage:
+ * 
+ *              using MyDispatcher = ByteMessageDispatcher<Point3D, TankControl, SensorData>;
+ *              MyDispatcher::dispatch(buffer, length, handler);
+ */
+template <class... MSGS>
+class ByteMessageDispatcher {
+
+    static_assert(sizeof...(MSGS) > 0 && sizeof...(MSGS) < 256, "a dispatcher needs 1 to 255 message classes");
+
+    public:
+        static constexpr size_t count = sizeof...(MSGS);  ///< Number of registered message classes.
+        static constexpr size_t max_size = bm_max_size<MSGS...>(); ///< Size of the largest registered message class.
+
+        // size of message with given type, 0 if type is not registered
+        static size_t size_of(uint8_t type);
+
+        // check if type is registered
+        static bool known(uint8_t type);
+
+        // populate a temporary object of the matching class and hand it to handler
+        template <class HANDLER>
+        static ByteMessageDispatchResult dispatch(const uint8_t * raw_message, size_t message_size, 
+                                                  HANDLER &&handler, bool verify_checksum=true);
+
+        // hand a read-only view of the matching class to handler (no copy)
+        template <class HANDLER>
+        static ByteMessageDispatchResult dispatch_view(const uint8_t * raw_message, size_t message_size, 
+                                                       HANDLER &&handler, bool verify_checksum=true);
+
+        // check type, size and checksum of a raw message without calling a handler
+        static ByteMessageDispatchResult verify(const uint8_t * raw_message, size_t message_size);
+
+    private:
+        /** @cond dispatcher_helpers */
+        // 1-based index of message class for type, 0 if unknown
+        static uint8_t lookup(uint8_t type);
+
+        // one function per message class and handler type
+        template <class MSG, class HANDLER>
+        static ByteMessageDispatchResult handle(const uint8_t * raw_message, HANDLER &handler, bool verify_checksum);
+        template <class MSG, class HANDLER>
+        static ByteMessageDispatchResult handle_view(const uint8_t * raw_message, HANDLER &handler, bool verify_checksum);
+
+        static_assert(bm_types_unique<MSGS...>(), "message types within one dispatcher must be unique");
+
+        static constexpr size_t sizes[count] = { MSGS::size... };
+
+        #if defined(__AVR__)
+        static constexpr ByteMessageDispatchTable table PROGMEM = bm_make_dispatch_table<MSGS...>();
+        #else
+        static constexpr ByteMessageDispatchTable table = bm_make_dispatch_table<MSGS...>();
+        #endif
+        /** @endcond */
+};
+
+// include implementation file
+#include "ByteMessageDispatcher.hpp"
+
+#endif
@@ -0,0 +1,279 @@
+/**
+ * @file    ByteMessageDispatcher.hpp
+ * @brief   Implementation file for the ByteMessageDispatcher class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageDispatcher_hpp License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/** @cond dispatcher_helpers */
+
+/* compile-time helpers */
+
+/* All helpers are single-return recursions, so they are constexpr in C++11. */
+
+// list of indices 0..N-1 (std::index_sequence needs C++14)
+template <size_t... I> struct bm_index_list {};
+template <size_t N, size_t... I> struct bm_make_index_list : bm_make_index_list<N-1, N-1, I...> {};
+template <size_t... I> struct bm_make_index_list<0, I...> { using type = bm_index_list<I...>; };
+
+// 1-based position of type in the list of types, starting with pos; 0 if not in list
+constexpr uint8_t bm_dispatch_index(uint8_t, uint8_t) {
+    return 0;
+}
+template <class... TYPES>
+constexpr uint8_t bm_dispatch_index(uint8_t type, uint8_t pos, uint8_t first, TYPES... rest) {
+    return (type == first) ? pos : bm_dispatch_index(type, static_cast<uint8_t>(pos + 1), rest...);
+}
+
+// one entry per possible type byte
+template <class... MSGS, size_t... I>
+constexpr ByteMessageDispatchTable bm_make_dispatch_table(bm_index_list<I...>) {
+    return ByteMessageDispatchTable{ { bm_dispatch_index(static_cast<uint8_t>(I), 1, MSGS::type...)... } };
+}
+
+// build lookup table: table.index[MSG::type] is the 1-based position of MSG in MSGS
+template <class... MSGS>
+constexpr ByteMessageDispatchTable bm_make_dispatch_table(void) {
+    return bm_make_dispatch_table<MSGS...>(typename bm_make_index_list<256>::type{});
+}
+
+// check that type does not appear in the list of types
+constexpr bool bm_type_absent(uint8_t) {
+    return true;
+}
+template <class... TYPES>
+constexpr bool bm_type_absent(uint8_t type, uint8_t first, TYPES... rest) {
+    return (type != first) && bm_type_absent(type, rest...);
+}
+
+// check that no type appears twice in the list of types
+constexpr bool bm_types_unique(void) {
+    return true;
+}
+template <class... TYPES>
+constexpr bool bm_types_unique(uint8_t first, TYPES... rest) {
+    return bm_type_absent(first, rest...) && bm_types_unique(rest...);
+}
+
+// check that no two message classes share the same type
+template <class... MSGS>
+constexpr bool bm_types_unique(void) {
+    return bm_types_unique(MSGS::type...);
+}
+
+// largest of a list of sizes
+constexpr size_t bm_max_of(size_t a) {
+    return a;
+}
+template <class... SIZES>
+constexpr size_t bm_max_of(size_t a, size_t b, SIZES... rest) {
+    return bm_max_of((a > b) ? a : b, rest...);
+}
+
+// size of the largest message class
+template <class... MSGS>
+constexpr size_t bm_max_size(void) {
+    return bm_max_of(MSGS::size...);
+}
+
+// definitions of the static constexpr members, not needed from C++17 on
+template <class... MSGS> constexpr size_t ByteMessageDispatcher<MSGS...>::count;
+template <class... MSGS> constexpr size_t ByteMessageDispatcher<MSGS...>::max_size;
+template <class... MSGS> constexpr size_t ByteMessageDispatcher<MSGS...>::sizes[];
+#if defined(__AVR__)
+template <class... MSGS> constexpr ByteMessageDispatchTable ByteMessageDispatcher<MSGS...>::table PROGMEM;
+#else
+template <class... MSGS> constexpr ByteMessageDispatchTable ByteMessageDispatcher<MSGS...>::table;
+#endif
+
+/** @endcond */
+
+// implement lookup()
+template <class... MSGS>
+uint8_t ByteMessageDispatcher<MSGS...>::lookup(uint8_t type) {
+    #if defined(__AVR__)
+        return pgm_read_byte(&table.index[type]);
+    #else
+        return table.index[type];
+    #endif
+}
+
+// implement size_of()
+/**
+ * @brief  Get the size of the registered message class with the given type.
+ * @param  type
+ *         The message type (i.e. the first byte of a raw message).
+ * @return The size of the message class, or 0 if type is not registered.
+ */
+template <class... MSGS>
+size_t ByteMessageDispatcher<MSGS...>::size_of(uint8_t type) {
+    const uint8_t i = lookup(type);
+    return (i == 0) ? 0 : sizes[i-1];
+}
+
+// implement known()
+/**
+ * @brief  Check if a message class with the given type is registered.
+ * @param  type
+ *         The message type (i.e. the first byte of a raw message).
+ * @return true if type is registered, false otherwise.
+ */
+template <class... MSGS>
+bool ByteMessageDispatcher<MSGS...>::known(uint8_t type) {
+    return lookup(type) != 0;
+}
+
+// implement dispatch()
+/**
+ * @brief  Route a raw message to the handler for its message class.
+ * @param  raw_message
+ *         A pointer to a uint8_t array holding the message.
+ * @param  message_size
+ *         The number of bytes in raw_message.
+ * @param  handler
+ *         A callable object. It is called with a const reference to an
+ *         object of the matching message class, populated from raw_message.
+ * @param  verify_checksum
+ *         If true, the handler is only called if the checksum of the
+ *         message is correct (see ByteMessageTraits).
+ * @return ByteMessageDispatchResult::ok if handler was called, the 
+ *         reason for rejecting the message otherwise.
+ */
+template <class... MSGS>
+template <class HANDLER>
+ByteMessageDispatchResult ByteMessageDispatcher<MSGS...>::dispatch(const uint8_t * raw_message, size_t message_size, 
+                                                                 HANDLER &&handler, bool verify_checksum) {
+    using handle_function = ByteMessageDispatchResult (*)(const uint8_t*, HANDLER&, bool);
+    static constexpr handle_function handlers[count] = { &handle<MSGS, HANDLER>... };
+    if (message_size == 0) {
+        return ByteMessageDispatchResult::size_mismatch;
+    }
+    const uint8_t i = lookup(*raw_message);
+    if (i == 0) {
+        return ByteMessageDispatchResult::unknown_type;
+    }
+    if (sizes[i-1] != message_size) {
+        return ByteMessageDispatchResult::size_mismatch;
+    }
+    return handlers[i-1](raw_message, handler, verify_checksum);
+}
+
+// implement dispatch_view()
+/**
+ * @brief  Route a raw message to the handler as a read-only view.
+ * @param  raw_message
+ *         A pointer to a uint8_t array holding the message.
+ * @param  message_size
+ *         The number of bytes in raw_message.
+ * @param  handler
+ *         A callable object. It is called with a ByteMessageView<const MSG>
+ *         of raw_message, MSG being the matching message class. 
+ * @param  verify_checksum
+ *         If true, the handler is only called if the checksum of the
+ *         message is correct (see ByteMessageTraits).
+ * @return ByteMessageDispatchResult::ok if handler was called, the 
+ *         reason for rejecting the message otherwise.
+ * @note   Nothing is copied for messages with compile-time checksums. 
+ *         Classic checksums can only be verified on a populated object.
+ */
+template <class... MSGS>
+template <class HANDLER>
+ByteMessageDispatchResult ByteMessageDispatcher<MSGS...>::dispatch_view(const uint8_t * raw_message, size_t message_size, 
+                                                                      HANDLER &&handler, bool verify_checksum) {
+    using handle_function = ByteMessageDispatchResult (*)(const uint8_t*, HANDLER&, bool);
+    static constexpr handle_function handlers[count] = { &handle_view<MSGS, HANDLER>... };
+    if (message_size == 0) {
+        return ByteMessageDispatchResult::size_mismatch;
+    }
+    const uint8_t i = lookup(*raw_message);
+    if (i == 0) {
+        return ByteMessageDispatchResult::unknown_type;
+    }
+    if (sizes[i-1] != message_size) {
+        return ByteMessageDispatchResult::size_mismatch;
+    }
+    return handlers[i-1](raw_message, handler, verify_checksum);
+}
+
+// implement verify()
+/**
+ * @brief  Check a raw message like dispatch() does, but do not call a handler.
+ * @param  raw_message
+ *         A pointer to a uint8_t array holding the message.
+ * @param  message_size
+ *         The number of bytes in raw_message.
+ * @return ByteMessageDispatchResult::ok if type, size and checksum are 
+ *         correct, the reason for rejecting the message otherwise.
+ * @note   Compile-time checksums are checked on raw_message directly. 
+ *         Classic checksums need a temporary object (see ByteMessageTraits).
+ */
+template <class... MSGS>
+ByteMessageDispatchResult ByteMessageDispatcher<MSGS...>::verify(const uint8_t * raw_message, size_t message_size) {
+    using check_function = bool (*)(const uint8_t*);
+    static constexpr check_function checks[count] = { &ByteMessageTraits<MSGS>::check... };
+    if (message_size == 0) {
+        return ByteMessageDispatchResult::size_mismatch;
+    }
+    const uint8_t i = lookup(*raw_message);
+    if (i == 0) {
+        return ByteMessageDispatchResult::unknown_type;
+    }
+    if (sizes[i-1] != message_size) {
+        return ByteMessageDispatchResult::size_mismatch;
+    }
+    return checks[i-1](raw_message) ? ByteMessageDispatchResult::ok : ByteMessageDispatchResult::checksum_mismatch;
+}
+
+/** @cond dispatcher_helpers */
+
+// type and size are already checked when this is called
+template <class... MSGS>
+template <class MSG, class HANDLER>
+ByteMessageDispatchResult ByteMessageDispatcher<MSGS...>::handle(const uint8_t * raw_message, HANDLER &handler, bool verify_checksum) {
+    MSG msg = ByteMessageTraits<MSG>::make_for_populate();
+    msg.populate(raw_message, MSG::size);
+    if (verify_checksum && !ByteMessageTraits<MSG>::check(msg)) {
+        return ByteMessageDispatchResult::checksum_mismatch;
+    }
+    handler(static_cast<const MSG&>(msg));
+    return ByteMessageDispatchResult::ok;
+}
+
+// type and size are already checked when this is called
+template <class... MSGS>
+template <class MSG, class HANDLER>
+ByteMessageDispatchResult ByteMessageDispatcher<MSGS...>::handle_view(const uint8_t * raw_message, HANDLER &handler, bool verify_checksum) {
+    if (verify_checksum && !ByteMessageTraits<MSG>::check(raw_message)) {
+        return ByteMessageDispatchResult::checksum_mismatch;
+    }
+    const ByteMessageView<const MSG> view{raw_message, MSG::size};
+    handler(view);
+    return ByteMessageDispatchResult::ok;
+}
+
+/** @endcond */
@@ -36,24 +36,134 @@
 #include <stdint.h> // needed for uint8_t data type
 #include <stddef.h> // needed for size_t data type
 
+/**
+ * @brief   Marker value for the position template parameter of
+ *          ByteMessageField and ByteMessageChecksum.
+ * @details Using this value (which is also the default) selects the
+ *          classic flavor of those classes, where the position within
+ *          the message is given at run time in the constructor and a
+ *          pointer to the underlying array is stored in each instance.
+ *          Any other value selects the compile-time flavor, which has
+ *          no data members at all.
+ */
+constexpr size_t BM_RUNTIME_POSITION = SIZE_MAX;
+
+/**
+ * @brief   Tag type for constructors which do not initialize the array.
+ * @details Messages and fields constructed with bm_uninitialized leave 
+ *          the bytes of the underlying array as they are (only the type
+ *          byte of a message is set). Use this for objects which are 
+ *          overwritten right away, e.g. by populate(). Reading a field 
+ *          before it was written gives unspecified values.
+ */
+struct ByteMessageUninitialized {};
+
+/** @brief Value of the tag type ByteMessageUninitialized. */
+constexpr ByteMessageUninitialized bm_uninitialized{};
+
+/** @cond function_identity */
+/*
+ * Compare function pointers given as template arguments, e.g. checksum
+ * functions. Comparing them with == or != (e.g. FUNC != nullptr) is not
+ * a constant expression for GCC with -fsanitize=undefined. Matching 
+ * template arguments always is.
+ */
+template <class F, F A, F B>
+struct bm_same_function { static constexpr bool value = false; };
+
+template <class F, F A>
+struct bm_same_function<F, A, A> { static constexpr bool value = true; };
+
+// true if the function pointer FN of type F is not nullptr
+template <class F, F FN>
+struct bm_function_bound { static constexpr bool value = !bm_same_function<F, FN, static_cast<F>(nullptr)>::value; };
+
+/*
+ * Tag for selecting one of two overloads on a compile-time condition.
+ * This does the job of "if constexpr" (which needs C++17).
+ */
+template <bool B>
+struct bm_bool_tag {};
+/** @endcond */
+
+/* byte order tags */
+/**
+ * @brief   Byte order tag: network byte order (big-endian).
+ * @details This is the default for all fields. Messages look the same 
+ *          on the wire regardless of the platform.
+ */
+struct ByteMessageNetworkOrder {};
+
+/**
+ * @brief   Byte order tag: little-endian.
+ * @details Values are swapped on big-endian platforms only. On 
+ *          little-endian platforms (AVR, Cortex-M, x86, ...) reading and
+ *          writing a field is a plain (unaligned) load or store.
+ */
+struct ByteMessageLittleEndian {};
+
+/**
+ * @brief   Byte order tag: native byte order of the platform.
+ * @details Values are never swapped, they are simply copied. Use this 
+ *          only if all communicating devices have the same byte order,
+ *          the bytes on the wire differ between platforms otherwise.
+ */
+struct ByteMessageNativeOrder {};
+
+/* declaration of codec template */
+/**
+ * @class   ByteMessageFieldCodec
+ * @brief   Stateless conversion between values and their encoded bytes.
+ * @details Provides static functions to write a value of type T to a
+ *          byte array in byte order ORDER and to read it back. This is 
+ *          the common backend for all flavors of ByteMessageField.
+ * @note    There is no generic implementation. The codec only exists
+ *          for the following data types: uint8_t, uint16_t, uint32_t,
+ *          uint64_t, int8_t, int16_t, int32_t, int64_t, bool, float,
+ *          double.
+ * @note    ORDER is one of ByteMessageNetworkOrder (default),
+ *          ByteMessageLittleEndian and ByteMessageNativeOrder. bool and
+ *          one-byte types are encoded identically in all byte orders.
+ */
+template <class T, class ORDER = ByteMessageNetworkOrder>
+struct ByteMessageFieldCodec;
+
 /* declaration of class template */
 /**
  * @class   ByteMessageField
  * @brief   Templated class for data fields in ByteMessage objects.
+ * @details The class comes in two flavors, selected by the template
+ *          parameter POS:
+ *          - ByteMessageField<T> (i.e. POS == BM_RUNTIME_POSITION) binds
+ *            to a position in an array given to the constructor and
+ *            stores a pointer to it.
+ *          - ByteMessageField<T, POS> has its position fixed at compile
+ *            time. It has no data members and reads/writes the array
+ *            of the owning message (or a view) which is handed to its
+ *            static member functions.
  * @note    This class can only be instantiated for the following data 
  *          types: uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t,
  *          int32_t, int64_t, bool, float, double.
  * @note    The size field will always have the value of sizeof(T),
  *          except for bool, where it is fixed to one byte.
+ * @note    ORDER selects the byte order of the encoded value, see
+ *          ByteMessageFieldCodec. Default is network byte order.
  */
-template <class T>
-class ByteMessageField final {
+template <class T, size_t POS = BM_RUNTIME_POSITION, class ORDER = ByteMessageNetworkOrder>
+class ByteMessageField;
+
+/** @cond class_specialization_runtime */
+template <class T, class ORDER>
+class ByteMessageField<T, BM_RUNTIME_POSITION, ORDER> final {
     public:
         // number of bytes for data type T
-        static constexpr size_t size = sizeof(T); ///< Size of the message field value in bytes
+        static constexpr size_t size = ByteMessageFieldCodec<T, ORDER>::size; ///< Size of the message field value in bytes
         
         // constructor
         ByteMessageField(uint8_t * messagepointer, size_t pos);
+
+        // constructor, leave array as it is
+        ByteMessageField(uint8_t * messagepointer, size_t pos, ByteMessageUninitialized);
         
         // delete copy constructor
         ByteMessageField(const ByteMessageField &bmf) = delete;
@@ -65,15 +175,39 @@ class ByteMessageField final {
         ByteMessageField& operator= (const ByteMessageField &bmf);
 
         // member function declarations  
-        // Those exist as specialized-only versions, i.e. there is no 
-        // implementation for generic type T.
+        // Those only work for types for which a ByteMessageFieldCodec 
+        // exists, i.e. there is no implementation for generic type T.
         void set(T value); // set value of field
         T get(void) const; // get value from field
 
+        // set value of field and patch a checksum covering it
+        template <class CHECKSUM> void set(T value, CHECKSUM &checksum);
+
     private:
         // const pointer to non-const value
         uint8_t * const msgptr;
 };
+/** @endcond */
+
+/*
+ * Compile-time flavor: no data members, so it does not add anything to
+ * the size of the message containing it. Declare instances as 
+ * "static constexpr" members of the message class and access them 
+ * through the message, e.g. p.set(p.x, 1.0) and p.get(p.x).
+ */
+template <class T, size_t POS, class ORDER>
+class ByteMessageField final {
+    public:
+        using value_type = T;                                                 ///< The data type of the field.
+        using order = ORDER;                                                  ///< The byte order of the encoded value.
+        static constexpr size_t size = ByteMessageFieldCodec<T, ORDER>::size; ///< Size of the message field value in bytes
+        static constexpr size_t pos  = POS;                                   ///< Position of the field within the message.
+
+        // set value of field in message starting at msg
+        static void set(uint8_t * msg, T value);
+        // get value of field from message starting at msg
+        static T get(const uint8_t * msg);
+};
 
 // include implementation
 #include "ByteMessageField.hpp"
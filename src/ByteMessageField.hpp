@@ -37,282 +37,456 @@
  * dependencies.
  */
 
-/* common member function definitions */
+/* codec specializations */
 
-// definition of constructor
-/**
- * @brief  The constructor
- * @param  messagepointer
- *         A pointer to an array of bytes. The encoded value is written 
- *         to and read from this array.
- * @param  pos
- *         A position into the array given by messagepointer. The encoded
- *         value is written to an read from this position in the array.
+/*
+ * All codec functions are defined inside the class specializations.
+ * This makes them implicitly inline, so this header can be included in
+ * more than one translation unit.
  */
-template <class T>
-ByteMessageField<T>::ByteMessageField(uint8_t * messagepointer, size_t pos) 
-    : msgptr{messagepointer+pos} {}; // empty body
 
-// definition of assignment operator
-/**
- * @brief  The copy-assignment operator 
- * @param  bmf
- *         A reference to a ByteMessageField object.
- * @return A reference to a ByteMessageField object.
- * @note   Copies data from one underlying array to the other.
- */
-template <class T>
-ByteMessageField<T>& ByteMessageField<T>::operator= (const ByteMessageField<T> &bmf) {
-    if (this == &bmf) return *this;
-    memcpy(msgptr, bmf.msgptr, sizeof(T));
-    return *this;
-}
+/** @cond codec_specializations */
 
-/**
- * @fn         template <class T> void ByteMessageField::set(T value)
- * @brief      Set value of ByteMessageField.
- * @details    The value is written to the underlying array.
- */
+/* codec for uint8_t */
 
-/**
- * @fn         template <class T> T ByteMessageField::get(void) const
- * @brief      Get value of ByteMessageField.
- * @details    The value is read from the underlying array.
- * @return     The value stored in the ByteMessageField object.
- */
+template <>
+struct ByteMessageFieldCodec<uint8_t> {
+    static constexpr size_t size = sizeof(uint8_t);
+    static void encode(uint8_t * ptr, uint8_t value) {
+        *ptr = value;
+    }
+    static uint8_t decode(const uint8_t * ptr) {
+        return *ptr;
+    }
+};
 
-/** @cond method_specializations */
+/* codec for int8_t */
 
-/* function specializations for uint8_t */
+template <>
+struct ByteMessageFieldCodec<int8_t> {
+    static constexpr size_t size = sizeof(int8_t);
+    static void encode(uint8_t * ptr, int8_t value) {
+        *ptr = static_cast<uint8_t>(value);
+    }
+    static int8_t decode(const uint8_t * ptr) {
+        return static_cast<int8_t>(*ptr);
+    }
+};
 
-template<> void ByteMessageField<uint8_t>::set(uint8_t value) {
-    *msgptr = value;
-}
+/* codec for uint16_t */
 
-template<> uint8_t ByteMessageField<uint8_t>::get(void) const {
-    return *msgptr;
-}
+template <>
+struct ByteMessageFieldCodec<uint16_t> {
+    static constexpr size_t size = sizeof(uint16_t);
+    static void encode(uint8_t * ptr, uint16_t value) {
+    //    htons(value, ptr);
+        #if ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+            value = __builtin_bswap16(value);
+        #endif
+        memcpy(ptr, &value, sizeof(uint16_t));
+    }
+    static uint16_t decode(const uint8_t * ptr) {
+        //return ntohs(ptr);
+        uint16_t v;
+        memcpy(&v, ptr, sizeof(uint16_t));
+        #if ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+            v = __builtin_bswap16(v);
+        #endif
+        return v;
+    }
+};
 
-/* function specializations for int8_t */
+/* codec for int16_t */
 
-template<> void ByteMessageField<int8_t>::set(int8_t value) {
-    *msgptr = static_cast<uint8_t>(value);
-}
+template <>
+struct ByteMessageFieldCodec<int16_t> {
+    static constexpr size_t size = sizeof(int16_t);
+    static void encode(uint8_t * ptr, int16_t value) {
+        ByteMessageFieldCodec<uint16_t>::encode(ptr, static_cast<uint16_t>(value));
+    }
+    static int16_t decode(const uint8_t * ptr) {
+        return static_cast<int16_t>(ByteMessageFieldCodec<uint16_t>::decode(ptr));
+    }
+};
 
-template<> int8_t ByteMessageField<int8_t>::get(void) const {
-    return static_cast<int8_t>(*msgptr);
-}
+/* codec for uint32_t */
 
-/* function specializations for uint16_t */
+template <>
+struct ByteMessageFieldCodec<uint32_t> {
+    static constexpr size_t size = sizeof(uint32_t);
+    static void encode(uint8_t * ptr, uint32_t value) {
+    //    htonl(value, ptr);
+        #if ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+            value = __builtin_bswap32(value);
+        #endif
+        memcpy(ptr, &value, sizeof(uint32_t));
+    }
+    static uint32_t decode(const uint8_t * ptr) {
+    //    return ntohl(ptr);
+        uint32_t v;
+        memcpy(&v, ptr, sizeof(uint32_t));
+        #if ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+            v = __builtin_bswap32(v);
+        #endif
+        return v;
+    }
+};
 
-template<> void ByteMessageField<uint16_t>::set(uint16_t value) {
-//    htons(value, msgptr);
-    #if ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
-        value = __builtin_bswap16(value);
-    #endif
-    memcpy(msgptr, &value, sizeof(uint16_t));
-}
+/* codec for int32_t */
 
-template<> uint16_t ByteMessageField<uint16_t>::get(void) const {
-    //return ntohs(msgptr);
-    uint16_t v;
-    memcpy(&v, msgptr, sizeof(uint16_t));
-    #if ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
-        v = __builtin_bswap16(v);
-    #endif
-    return v;
-}
+template <>
+struct ByteMessageFieldCodec<int32_t> {
+    static constexpr size_t size = sizeof(int32_t);
+    static void encode(uint8_t * ptr, int32_t value) {
+        ByteMessageFieldCodec<uint32_t>::encode(ptr, static_cast<uint32_t>(value));
+    }
+    static int32_t decode(const uint8_t * ptr) {
+        return static_cast<int32_t>(ByteMessageFieldCodec<uint32_t>::decode(ptr));
+    }
+};
 
-/* function specializations for int16_t */
+/* codec for uint64_t */
 
-template<> void ByteMessageField<int16_t>::set(int16_t value) {
-//    htons(static_cast<uint16_t>(value), msgptr);
-    uint16_t v = static_cast<uint16_t>(value);
-    #if ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
-        v = __builtin_bswap16(v);
-    #endif
-    memcpy(msgptr, &v, sizeof(uint16_t));
-}
+template <>
+struct ByteMessageFieldCodec<uint64_t> {
+    static constexpr size_t size = sizeof(uint64_t);
+    static void encode(uint8_t * ptr, uint64_t value) {
+    //    htonll(value, ptr);
+        #if ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+            value = __builtin_bswap64(value);
+        #endif
+        memcpy(ptr, &value, sizeof(uint64_t));
+    }
+    static uint64_t decode(const uint8_t * ptr) {
+    //    return ntohll(ptr);
+        uint64_t v;
+        memcpy(&v, ptr, sizeof(uint64_t));
+        #if ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+            v = __builtin_bswap64(v);
+        #endif
+        return v;
+    }
+};
 
-template<> int16_t ByteMessageField<int16_t>::get(void) const {
-//    return static_cast<int16_t>(ntohs(msgptr));
-    uint16_t v;
-    memcpy(&v, msgptr, sizeof(uint16_t));
-    #if ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
-        v = __builtin_bswap16(v);
-    #endif
-    return static_cast<int16_t>(v);
-}
+/* codec for int64_t */
 
-/* function specializations for uint32_t */
+template <>
+struct ByteMessageFieldCodec<int64_t> {
+    static constexpr size_t size = sizeof(int64_t);
+    static void encode(uint8_t * ptr, int64_t value) {
+        ByteMessageFieldCodec<uint64_t>::encode(ptr, static_cast<uint64_t>(value));
+    }
+    static int64_t decode(const uint8_t * ptr) {
+        return static_cast<int64_t>(ByteMessageFieldCodec<uint64_t>::decode(ptr));
+    }
+};
 
-template<> void ByteMessageField<uint32_t>::set(uint32_t value) {
-//    htonl(value, msgptr);
-    #if ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
-        value = __builtin_bswap32(value);
-    #endif
-    memcpy(msgptr, &value, sizeof(uint32_t));
-}
+/* codec for float */
 
-template<> uint32_t ByteMessageField<uint32_t>::get(void) const {
-//    return ntohl(msgptr);
-    uint32_t v;
-    memcpy(&v, msgptr, sizeof(uint32_t));
-    #if ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
-        v = __builtin_bswap32(v);
-    #endif
-    return v;
+template <>
+struct ByteMessageFieldCodec<float> {
+    static constexpr size_t size = sizeof(float);
+    static void encode(uint8_t * ptr, float value) {
+    //    htonf(value, ptr);
+        static_assert(sizeof(uint32_t) == sizeof(float));
+        #if ( __FLOAT_WORD_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+            // convert to unsigned integer, byte-swap, copy to array
+            uint32_t v;
+            memcpy(&v, &value, sizeof(float));
+            v = __builtin_bswap32(v);
+            memcpy(ptr, &v, sizeof(uint32_t));
+        #elif ( __FLOAT_WORD_ORDER__ == __ORDER_BIG_ENDIAN__ )
+            // direct copy of float to array
+            memcpy(ptr, &value, sizeof(float));
+        #else
+            #error "float word order could not be determined!" 
+        #endif
+    }
+    static float decode(const uint8_t * ptr) {
+    //    return ntohf(ptr);
+        static_assert(sizeof(uint32_t) == sizeof(float));
+        uint32_t v;
+        memcpy(&v, ptr, sizeof(float));
+        #if ( __FLOAT_WORD_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+            v = __builtin_bswap32(v);
+        #endif
+        float f;
+        memcpy(&f, &v, sizeof(float));
+        return f;        
+    }
+};
+
+/* codec for double */
+
+#if (__SIZEOF_DOUBLE__ == 8)
+template <>
+struct ByteMessageFieldCodec<double> {
+    static constexpr size_t size = sizeof(double);
+    static void encode(uint8_t * ptr, double value) {
+    //    htond(value, ptr);
+        static_assert(sizeof(uint64_t) == sizeof(double));
+        #if ( __FLOAT_WORD_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+            // convert to unsigned integer, byte-swap, copy result to array
+            uint64_t v;
+            memcpy(&v, &value, sizeof(double));
+            v = __builtin_bswap64(v);
+            memcpy(ptr, &v, sizeof(uint64_t));
+        #elif ( __FLOAT_WORD_ORDER__ == __ORDER_BIG_ENDIAN__ )
+            // direct copy of double to array
+            memcpy(ptr, &value, sizeof(double));
+        #else
+            #error "float word order could not be determined!" 
+        #endif
+    }
+    static double decode(const uint8_t * ptr) {
+    //    return ntohd(ptr);
+        static_assert(sizeof(uint64_t) == sizeof(double));
+        uint64_t v;
+        memcpy(&v, ptr, sizeof(double));
+        #if ( __FLOAT_WORD_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+            v = __builtin_bswap64(v);
+        #endif
+        double d;
+        memcpy(&d, &v, sizeof(double));
+        return d;        
+    }
+};
+#endif
+
+/* codec for bool */
+
+template <>
+struct ByteMessageFieldCodec<bool> {
+    // Represent bool as one byte in message field, because 
+    // sizeof(bool) is implementation defined and might be larger
+    // than one byte. --> Force it to use only one byte!
+    static constexpr size_t size = 1;
+    // represent 'true' as 1 and 'false' as 0 in a uint8_t
+    static void encode(uint8_t * ptr, bool value) {
+        *ptr = (value) ? 1 : 0;
+    }
+    static bool decode(const uint8_t * ptr) {
+        return static_cast<bool>(*ptr);
+    }
+};
+
+/* codecs for little-endian and native byte order */
+
+/*
+ * Values are copied to and from the array as they are, with the bytes
+ * reversed if the byte order of the platform differs from ORDER. bool 
+ * and one-byte types are never reversed.
+ */
+
+// true if the native representation of T is little-endian
+template <class T>
+constexpr bool bm_native_little(void) {
+    return ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ );
 }
 
-/* function specializations for int32_t */
+template <>
+constexpr bool bm_native_little<float>(void) {
+    return ( __FLOAT_WORD_ORDER__ == __ORDER_LITTLE_ENDIAN__ );
+}
 
-template<> void ByteMessageField<int32_t>::set(int32_t value) {
-//    htonl(static_cast<uint32_t>(value), msgptr);
-    uint32_t v = static_cast<uint32_t>(value);
-    #if ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
-        v = __builtin_bswap32(v);
-    #endif
-    memcpy(msgptr, &v, sizeof(uint32_t));
+template <>
+constexpr bool bm_native_little<double>(void) {
+    return ( __FLOAT_WORD_ORDER__ == __ORDER_LITTLE_ENDIAN__ );
 }
 
-template<> int32_t ByteMessageField<int32_t>::get(void) const {
-//    return static_cast<int32_t>(ntohl(msgptr));
-    uint32_t v;
-    memcpy(&v, msgptr, sizeof(uint32_t));
-    #if ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
-        v = __builtin_bswap32(v);
-    #endif
-    return static_cast<int32_t>(v);
+// true if the bytes of a value of type T have to be reversed for byte order ORDER
+template <class T>
+constexpr bool bm_order_swap(ByteMessageNetworkOrder) {
+    return (sizeof(T) > 1) && bm_native_little<T>();
 }
 
-/* function specializations for uint64_t */
+template <class T>
+constexpr bool bm_order_swap(ByteMessageLittleEndian) {
+    return (sizeof(T) > 1) && !bm_native_little<T>();
+}
 
-template<> void ByteMessageField<uint64_t>::set(uint64_t value) {
-//    htonll(value, msgptr);
-    #if ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
-        value = __builtin_bswap64(value);
-    #endif
-    memcpy(msgptr, &value, sizeof(uint64_t));
+template <class T>
+constexpr bool bm_order_swap(ByteMessageNativeOrder) {
+    return false;
 }
 
-template<> uint64_t ByteMessageField<uint64_t>::get(void) const {
-//    return ntohll(msgptr);
-    uint64_t v;
-    memcpy(&v, msgptr, sizeof(uint64_t));
-    #if ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
-        v = __builtin_bswap64(v);
-    #endif
-    return v;
+// copy S bytes from src to dst, reversing their order
+template <size_t S>
+inline void bm_reverse_copy(uint8_t * dst, const uint8_t * src) {
+    for (size_t i = 0; i < S; i++) {
+        dst[i] = src[S - 1 - i];
+    }
 }
 
-/* function specializations for int64_t */
+template <>
+inline void bm_reverse_copy<2>(uint8_t * dst, const uint8_t * src) {
+    uint16_t v;
+    memcpy(&v, src, sizeof(uint16_t));
+    v = __builtin_bswap16(v);
+    memcpy(dst, &v, sizeof(uint16_t));
+}
 
-template<> void ByteMessageField<int64_t>::set(int64_t value) {
-//    htonll(static_cast<uint64_t>(value), msgptr);
-    uint64_t v = static_cast<uint64_t>(value);
-    #if ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
-        v = __builtin_bswap64(v);
-    #endif
-    memcpy(msgptr, &v, sizeof(uint64_t));
+template <>
+inline void bm_reverse_copy<4>(uint8_t * dst, const uint8_t * src) {
+    uint32_t v;
+    memcpy(&v, src, sizeof(uint32_t));
+    v = __builtin_bswap32(v);
+    memcpy(dst, &v, sizeof(uint32_t));
 }
 
-template<> int64_t ByteMessageField<int64_t>::get(void) const {
-//    return static_cast<int64_t>(ntohll(msgptr));
+template <>
+inline void bm_reverse_copy<8>(uint8_t * dst, const uint8_t * src) {
     uint64_t v;
-    memcpy(&v, msgptr, sizeof(uint64_t));
-    #if ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
-        v = __builtin_bswap64(v);
-    #endif
-    return static_cast<int64_t>(v);
+    memcpy(&v, src, sizeof(uint64_t));
+    v = __builtin_bswap64(v);
+    memcpy(dst, &v, sizeof(uint64_t));
 }
 
-/* function specializations for float */
+// codec copying the representation of T, optionally with reversed bytes
+template <class T, bool SWAP>
+struct ByteMessageFieldCodecCopy {
+    // the network byte order codec decides which types are supported
+    static constexpr size_t size = ByteMessageFieldCodec<T>::size;
+    static_assert(size == sizeof(T), "the codec copies the representation of T");
+    static void encode(uint8_t * ptr, T value) {
+        copy(ptr, reinterpret_cast<const uint8_t*>(&value), bm_bool_tag<SWAP>{});
+    }
+    static T decode(const uint8_t * ptr) {
+        T value;
+        copy(reinterpret_cast<uint8_t*>(&value), ptr, bm_bool_tag<SWAP>{});
+        return value;
+    }
+    private:
+        static void copy(uint8_t * dst, const uint8_t * src, bm_bool_tag<false>) { memcpy(dst, src, size); }
+        static void copy(uint8_t * dst, const uint8_t * src, bm_bool_tag<true>) { bm_reverse_copy<size>(dst, src); }
+};
 
-template<> void ByteMessageField<float>::set(float value) {
-//    htonf(value, msgptr);
-    static_assert(sizeof(uint32_t) == sizeof(float));
-    #if ( __FLOAT_WORD_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
-        // convert to unsigned integer, byte-swap, copy to array
-        uint32_t v;
-        memcpy(&v, &value, sizeof(float));
-        v = __builtin_bswap32(v);
-        memcpy(msgptr, &v, sizeof(uint32_t));
-    #elif ( __FLOAT_WORD_ORDER__ == __ORDER_BIG_ENDIAN__ )
-        // direct copy of float to array
-        memcpy(msgptr, &value, sizeof(float));
-    #else
-        #error "float word order could not be determined!" 
-    #endif
-}
+template <class T>
+struct ByteMessageFieldCodec<T, ByteMessageLittleEndian> 
+    : ByteMessageFieldCodecCopy<T, bm_order_swap<T>(ByteMessageLittleEndian{})> {};
 
-template<> float ByteMessageField<float>::get(void) const {
-//    return ntohf(msgptr);
-    static_assert(sizeof(uint32_t) == sizeof(float));
-    uint32_t v;
-    memcpy(&v, msgptr, sizeof(float));
-    #if ( __FLOAT_WORD_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
-        v = __builtin_bswap32(v);
-    #endif
-    float f;
-    memcpy(&f, &v, sizeof(float));
-    return f;        
-}
+template <class T>
+struct ByteMessageFieldCodec<T, ByteMessageNativeOrder> 
+    : ByteMessageFieldCodecCopy<T, false> {};
 
-/* function specializations for double */
+// bool is always one byte with value 0 or 1
+template <>
+struct ByteMessageFieldCodec<bool, ByteMessageLittleEndian> : ByteMessageFieldCodec<bool> {};
 
-#if (__SIZEOF_DOUBLE__ == 8)
-template<> void ByteMessageField<double>::set(double value) {
-//    htond(value, msgptr);
-    static_assert(sizeof(uint64_t) == sizeof(double));
-    #if ( __FLOAT_WORD_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
-        // convert to unsigned integer, byte-swap, copy result to array
-        uint64_t v;
-        memcpy(&v, &value, sizeof(double));
-        v = __builtin_bswap64(v);
-        memcpy(msgptr, &v, sizeof(uint64_t));
-    #elif ( __FLOAT_WORD_ORDER__ == __ORDER_BIG_ENDIAN__ )
-        // direct copy of double to array
-        memcpy(msgptr, &value, sizeof(double));
-    #else
-        #error "float word order could not be determined!" 
-    #endif
+template <>
+struct ByteMessageFieldCodec<bool, ByteMessageNativeOrder> : ByteMessageFieldCodec<bool> {};
+
+/** @endcond */
+
+/* member function definitions for run-time flavor */
+
+// definition of constructor
+/**
+ * @brief  The constructor
+ * @param  messagepointer
+ *         A pointer to an array of bytes. The encoded value is written 
+ *         to and read from this array.
+ * @param  pos
+ *         A position into the array given by messagepointer. The encoded
+ *         value is written to an read from this position in the array.
+ */
+template <class T, class ORDER>
+ByteMessageField<T, BM_RUNTIME_POSITION, ORDER>::ByteMessageField(uint8_t * messagepointer, size_t pos) 
+    : msgptr{messagepointer+pos} {}; // empty body
+
+// definition of constructor without initialization
+/**
+ * @brief  The constructor for uninitialized messages
+ * @param  messagepointer
+ *         A pointer to an array of bytes.
+ * @param  pos
+ *         A position into the array given by messagepointer.
+ * @note   Same as the other constructor, which does not initialize 
+ *         anything either, except for ByteMessageField<bool>. It exists 
+ *         so that all fields can be constructed the same way.
+ */
+template <class T, class ORDER>
+ByteMessageField<T, BM_RUNTIME_POSITION, ORDER>::ByteMessageField(uint8_t * messagepointer, size_t pos, ByteMessageUninitialized) 
+    : msgptr{messagepointer+pos} {}; // empty body
+
+// definition of assignment operator
+/**
+ * @brief  The copy-assignment operator 
+ * @param  bmf
+ *         A reference to a ByteMessageField object.
+ * @return A reference to a ByteMessageField object.
+ * @note   Copies data from one underlying array to the other.
+ */
+template <class T, class ORDER>
+ByteMessageField<T, BM_RUNTIME_POSITION, ORDER>& ByteMessageField<T, BM_RUNTIME_POSITION, ORDER>::operator= (const ByteMessageField<T, BM_RUNTIME_POSITION, ORDER> &bmf) {
+    if (this == &bmf) return *this;
+    memcpy(msgptr, bmf.msgptr, size);
+    return *this;
 }
 
-template<> double ByteMessageField<double>::get(void) const {
-//    return ntohd(msgptr);
-    static_assert(sizeof(uint64_t) == sizeof(double));
-    uint64_t v;
-    memcpy(&v, msgptr, sizeof(double));
-    #if ( __FLOAT_WORD_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
-        v = __builtin_bswap64(v);
-    #endif
-    double d;
-    memcpy(&d, &v, sizeof(double));
-    return d;        
+/**
+ * @brief      Set value of ByteMessageField.
+ * @details    The value is written to the underlying array.
+ * @param      value
+ *             The value to write.
+ */
+template <class T, class ORDER>
+void ByteMessageField<T, BM_RUNTIME_POSITION, ORDER>::set(T value) {
+    ByteMessageFieldCodec<T, ORDER>::encode(msgptr, value);
 }
-#endif
 
-/** @endcond */
+/**
+ * @brief      Set value of ByteMessageField and patch a checksum.
+ * @details    The value is written to the underlying array. Afterwards
+ *             the stored checksum is adjusted by calling its patch()
+ *             function with the old and new bytes of this field.
+ * @param      value
+ *             The value to write.
+ * @param      checksum
+ *             A ByteMessageChecksum<T> operating on the same array. The
+ *             stored checksum must be valid before the call.
+ * @note       For XOR, two's complement and one's complement checksums
+ *             the cost is O(size) instead of O(message size).
+ */
+template <class T, class ORDER>
+template <class CHECKSUM>
+void ByteMessageField<T, BM_RUNTIME_POSITION, ORDER>::set(T value, CHECKSUM &checksum) {
+    uint8_t old_data[size];
+    memcpy(old_data, msgptr, size);
+    set(value);
+    checksum.patch(msgptr, old_data, size);
+}
+
+/**
+ * @brief      Get value of ByteMessageField.
+ * @details    The value is read from the underlying array.
+ * @return     The value stored in the ByteMessageField object.
+ */
+template <class T, class ORDER>
+T ByteMessageField<T, BM_RUNTIME_POSITION, ORDER>::get(void) const {
+    return ByteMessageFieldCodec<T, ORDER>::decode(msgptr);
+}
 
 /** @cond class_specialization_bool */
-/* complete class specialization for bool - definitions inside! */
-template <>
-class ByteMessageField<bool> final {
+/* class specialization for bool - definitions inside! */
+template <class ORDER>
+class ByteMessageField<bool, BM_RUNTIME_POSITION, ORDER> final {
     public:
-        // Represent bool as one byte in message field, because 
-        // sizeof(bool) is implementation defined and might be larger
-        // than one byte. --> Force it to use only one byte!
-        static constexpr size_t size = 1;
+        static constexpr size_t size = ByteMessageFieldCodec<bool>::size;
         
         // constructor including implementation
-        ByteMessageField<bool>(uint8_t * messagepointer, size_t pos=0) 
+        ByteMessageField(uint8_t * messagepointer, size_t pos=0) 
             : msgptr{messagepointer+pos} { *msgptr = 0; }
+
+        // constructor, leave array as it is
+        ByteMessageField(uint8_t * messagepointer, size_t pos, ByteMessageUninitialized) 
+            : msgptr{messagepointer+pos} {}
             
         // delete copy constructor
         ByteMessageField(const ByteMessageField &bmf) = delete;
         
         // default destructor
-        ~ByteMessageField<bool>() = default;
+        ~ByteMessageField() = default;
         
         // assignment operator
         ByteMessageField& operator= (const ByteMessageField& bmf) {
@@ -321,12 +495,47 @@ class ByteMessageField<bool> final {
             return *this;
         }        
         
-        // represent 'true' as 1 and 'false' as 0 in a uint8_t
-        void set(bool value) { *msgptr = (value) ? 1 : 0; }
-        bool get(void) const { return static_cast<bool>(*msgptr); }
+        void set(bool value) { ByteMessageFieldCodec<bool>::encode(msgptr, value); }
+        bool get(void) const { return ByteMessageFieldCodec<bool>::decode(msgptr); }
+
+        template <class CHECKSUM> 
+        void set(bool value, CHECKSUM &checksum) {
+            const uint8_t old_data = *msgptr;
+            set(value);
+            checksum.patch(msgptr, &old_data, size);
+        }
         
     private:
         // const pointer to non-const value
         uint8_t * const msgptr;
 };
 /** @endcond */
+
+/* member function definitions for compile-time flavor */
+
+/**
+ * @brief      Set value of a compile-time ByteMessageField.
+ * @param      msg
+ *             Pointer to the beginning of the message array. The value 
+ *             is written to msg+POS.
+ * @param      value
+ *             The value to write.
+ * @note       Usually not called directly, but through ByteMessage::set().
+ */
+template <class T, size_t POS, class ORDER>
+void ByteMessageField<T, POS, ORDER>::set(uint8_t * msg, T value) {
+    ByteMessageFieldCodec<T, ORDER>::encode(msg+POS, value);
+}
+
+/**
+ * @brief      Get value of a compile-time ByteMessageField.
+ * @param      msg
+ *             Pointer to the beginning of the message array. The value 
+ *             is read from msg+POS.
+ * @return     The decoded value.
+ * @note       Usually not called directly, but through ByteMessage::get().
+ */
+template <class T, size_t POS, class ORDER>
+T ByteMessageField<T, POS, ORDER>::get(const uint8_t * msg) {
+    return ByteMessageFieldCodec<T, ORDER>::decode(msg+POS);
+}
@@ -0,0 +1,119 @@
+/**
+ * @file    ByteMessageFieldArray.h
+ * @brief   Header file for the ByteMessageFieldArray class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageFieldArray_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ByteMessageFieldArray_h
+#define ByteMessageFieldArray_h
+
+#include <stdint.h> // needed for fixed-size data types
+#include <stddef.h> // needed for size_t data type
+
+#include "ByteMessageField.h" // used internally
+
+/* Note: This header file also includes the complete implementation from ByteMessageFieldArray.hpp! */
+
+/* 
+ * Important points:
+ * - ByteMessageFieldArray<T, N> holds N values of type T, stored back to
+ *   back in network byte order (big-endian), i.e. exactly like N 
+ *   consecutive ByteMessageField<T> objects. But only one pointer is stored.
+ *   ByteMessageFieldArray<T, N, ByteMessageLittleEndian> and 
+ *   ByteMessageFieldArray<T, N, ByteMessageNativeOrder> store the values
+ *   in little-endian and native byte order.
+ * - Elements can be accessed one by one with set(index, value) and 
+ *   get(index), or as whole ranges with set_array() and get_array().
+ * - The range functions use bm_encode_array() / bm_decode_array(), which
+ *   swap the bytes of many values at once: with SSSE3 or AVX2 byte shuffles 
+ *   (pshufb) on x86 and with NEON vrev on ARM. Define BM_FIELD_NO_SIMD to 
+ *   disable. If the byte order of the platform matches, the values are
+ *   simply copied with memcpy().
+ * - T can be any data type for which a ByteMessageFieldCodec exists.
+ */
+
+// write count values in byte order ORDER (default: network byte order) to dst
+template <class T, class ORDER = ByteMessageNetworkOrder> void bm_encode_array(uint8_t * dst, const T * values, size_t count);
+
+// read count values in byte order ORDER (default: network byte order) from src
+template <class T, class ORDER = ByteMessageNetworkOrder> void bm_decode_array(T * values, const uint8_t * src, size_t count);
+
+/**
+ * @class   ByteMessageFieldArray
+ * @brief   Templated class for arrays of values in ByteMessage objects.
+ * @details Usage:
+ * 
+ *              ByteMessageFieldArray<int16_t, 64> samples{msgarr, 1}; // index 1 to 128
+ *              samples.set_array(adc_readings, 64);
+ *              int16_t first = samples.get(0);
+ */
+template <class T, size_t N, class ORDER = ByteMessageNetworkOrder>
+class ByteMessageFieldArray final {
+    public:
+        using value_type = T;                                                         ///< The data type of the elements.
+        using order = ORDER;                                                          ///< The byte order of the encoded elements.
+        static constexpr size_t count = N;                                            ///< Number of elements
+        static constexpr size_t element_size = ByteMessageFieldCodec<T, ORDER>::size; ///< Size of one element in bytes
+        static constexpr size_t size = N * element_size;                              ///< Size of the whole array in bytes
+
+        // constructor
+        ByteMessageFieldArray(uint8_t * messagepointer, size_t pos);
+
+        // delete copy constructor
+        ByteMessageFieldArray(const ByteMessageFieldArray &bmfa) = delete;
+
+        // default destructor
+        ~ByteMessageFieldArray() = default;
+
+        // assignment operator
+        ByteMessageFieldArray& operator= (const ByteMessageFieldArray &bmfa);
+
+        // access single elements
+        void set(size_t index, T value);   // out-of-bounds index is ignored
+        T get(size_t index) const;         // out-of-bounds index returns T{}
+
+        // set element and patch a checksum covering it
+        template <class CHECKSUM> void set(size_t index, T value, CHECKSUM &checksum);
+
+        // access ranges of elements, return number of elements copied
+        size_t set_array(const T * values, size_t n, size_t first = 0);
+        size_t get_array(T * values, size_t n, size_t first = 0) const;
+
+        // return pointer to constant (encoded) data
+        const uint8_t* get_ptr(void) const;
+
+    private:
+        // const pointer to non-const value
+        uint8_t * const msgptr;
+};
+
+// include implementation
+#include "ByteMessageFieldArray.hpp"
+
+#endif
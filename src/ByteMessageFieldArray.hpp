@@ -0,0 +1,346 @@
+/**
+ * @file    ByteMessageFieldArray.hpp
+ * @brief   Implementation file for the ByteMessageFieldArray class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageFieldArray_hpp License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>  // needed for memcpy()
+
+/** @cond field_array_internals */
+
+#if !defined(BM_FIELD_NO_SIMD) && ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+    #if defined(__AVX2__)
+        #define BM_FIELD_AVX2
+    #endif
+    #if defined(__SSSE3__)
+        #define BM_FIELD_SSSE3
+        #include <immintrin.h>
+    #endif
+    #if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define BM_FIELD_NEON
+        #include <arm_neon.h>
+    #endif
+#endif
+
+#if defined(BM_FIELD_SSSE3)
+// shuffle mask reversing the bytes of each S-byte element in a 16-byte chunk
+template <size_t S>
+inline __m128i bm_swap_mask128(void) {
+    uint8_t mask[16];
+    for (size_t j = 0; j < 16; j++) {
+        mask[j] = static_cast<uint8_t>((j / S) * S + (S - 1 - j % S));
+    }
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask));
+}
+#endif
+
+// copy count elements of S bytes each, reversing the byte order within each element
+// Note: src and dst must not overlap.
+template <size_t S>
+inline void bm_swap_copy(uint8_t * dst, const uint8_t * src, size_t count) {
+    size_t length = count * S;
+    #if defined(BM_FIELD_AVX2)
+    if (length >= 32) {
+        // vpshufb shuffles within 16-byte lanes, which always hold complete elements
+        const __m256i mask = _mm256_broadcastsi128_si256(bm_swap_mask128<S>());
+        while (length >= 32) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_shuffle_epi8(v, mask));
+            src += 32;
+            dst += 32;
+            length -= 32;
+        }
+    }
+    #endif
+    #if defined(BM_FIELD_SSSE3)
+    if (length >= 16) {
+        const __m128i mask = bm_swap_mask128<S>();
+        while (length >= 16) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_shuffle_epi8(v, mask));
+            src += 16;
+            dst += 16;
+            length -= 16;
+        }
+    }
+    #endif
+    #if defined(BM_FIELD_NEON)
+    while (length >= 16) {
+        uint8x16_t v = vld1q_u8(src);
+        // S is a constant, all three intrinsics compile for any S
+        if (S == 2) {
+            v = vrev16q_u8(v);
+        }
+        else if (S == 4) {
+            v = vrev32q_u8(v);
+        }
+        else {
+            v = vrev64q_u8(v);
+        }
+        vst1q_u8(dst, v);
+        src += 16;
+        dst += 16;
+        length -= 16;
+    }
+    #endif
+    // remaining elements (or all elements without SIMD)
+    while (length > 0) {
+        for (size_t i = 0; i < S; i++) {
+            dst[i] = src[S - 1 - i];
+        }
+        src += S;
+        dst += S;
+        length -= S;
+    }
+}
+
+// copy count elements of S bytes each, reversing the byte order within each element for bm_bool_tag<true>
+// (tag dispatch instead of "if constexpr", which needs C++17)
+template <size_t S>
+inline void bm_order_copy(uint8_t * dst, const uint8_t * src, size_t count, bm_bool_tag<true>) {
+    bm_swap_copy<S>(dst, src, count);
+}
+
+template <size_t S>
+inline void bm_order_copy(uint8_t * dst, const uint8_t * src, size_t count, bm_bool_tag<false>) {
+    memcpy(dst, src, count * S);
+}
+
+/** @endcond */
+
+/* bulk conversion functions */
+
+// implement bm_encode_array()
+/**
+ * @brief  Write values in byte order ORDER to a byte array.
+ * @param  dst
+ *         The byte array. Must hold count*ByteMessageFieldCodec<T, ORDER>::size bytes.
+ * @param  values
+ *         The values to write.
+ * @param  count
+ *         The number of values.
+ * @note   Gives the same result as calling ByteMessageFieldCodec<T, ORDER>::encode()
+ *         for every value, but works on many values at once. If no bytes
+ *         have to be reversed, this is a single memcpy().
+ */
+template <class T, class ORDER> 
+void bm_encode_array(uint8_t * dst, const T * values, size_t count) {
+    static_assert(ByteMessageFieldCodec<T, ORDER>::size == sizeof(T), "arrays need a codec of sizeof(T) bytes");
+    bm_order_copy<sizeof(T)>(dst, reinterpret_cast<const uint8_t*>(values), count, bm_bool_tag<bm_order_swap<T>(ORDER{})>{});
+}
+
+/** @cond field_array_bool */
+template <>
+inline void bm_encode_array<bool, ByteMessageNetworkOrder>(uint8_t * dst, const bool * values, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        ByteMessageFieldCodec<bool>::encode(dst + i, values[i]);
+    }
+}
+
+template <>
+inline void bm_encode_array<bool, ByteMessageLittleEndian>(uint8_t * dst, const bool * values, size_t count) {
+    bm_encode_array<bool, ByteMessageNetworkOrder>(dst, values, count);
+}
+
+template <>
+inline void bm_encode_array<bool, ByteMessageNativeOrder>(uint8_t * dst, const bool * values, size_t count) {
+    bm_encode_array<bool, ByteMessageNetworkOrder>(dst, values, count);
+}
+/** @endcond */
+
+// implement bm_decode_array()
+/**
+ * @brief  Read values in byte order ORDER from a byte array.
+ * @param  values
+ *         Array to store count values in.
+ * @param  src
+ *         The byte array. Must hold count*ByteMessageFieldCodec<T, ORDER>::size bytes.
+ * @param  count
+ *         The number of values.
+ * @note   Gives the same result as calling ByteMessageFieldCodec<T, ORDER>::decode()
+ *         for every value, but works on many values at once. If no bytes
+ *         have to be reversed, this is a single memcpy().
+ */
+template <class T, class ORDER> 
+void bm_decode_array(T * values, const uint8_t * src, size_t count) {
+    static_assert(ByteMessageFieldCodec<T, ORDER>::size == sizeof(T), "arrays need a codec of sizeof(T) bytes");
+    bm_order_copy<sizeof(T)>(reinterpret_cast<uint8_t*>(values), src, count, bm_bool_tag<bm_order_swap<T>(ORDER{})>{});
+}
+
+/** @cond field_array_bool */
+template <>
+inline void bm_decode_array<bool, ByteMessageNetworkOrder>(bool * values, const uint8_t * src, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        values[i] = ByteMessageFieldCodec<bool>::decode(src + i);
+    }
+}
+
+template <>
+inline void bm_decode_array<bool, ByteMessageLittleEndian>(bool * values, const uint8_t * src, size_t count) {
+    bm_decode_array<bool, ByteMessageNetworkOrder>(values, src, count);
+}
+
+template <>
+inline void bm_decode_array<bool, ByteMessageNativeOrder>(bool * values, const uint8_t * src, size_t count) {
+    bm_decode_array<bool, ByteMessageNetworkOrder>(values, src, count);
+}
+/** @endcond */
+
+/* member function definitions */
+
+// definition of constructor
+/**
+ * @brief  The constructor
+ * @param  messagepointer
+ *         A pointer to an array of bytes. The encoded values are written 
+ *         to and read from this array.
+ * @param  pos
+ *         A position into the array given by messagepointer. The first
+ *         element is written to and read from this position in the array.
+ * @note   There is *NO* error checking to prevent pos+size > sizeof(messagepointer)
+ */
+template <class T, size_t N, class ORDER>
+ByteMessageFieldArray<T, N, ORDER>::ByteMessageFieldArray(uint8_t * messagepointer, size_t pos)
+    : msgptr{messagepointer+pos} {}; // empty body
+
+// definition of assignment operator
+/**
+ * @brief  The copy-assignment operator 
+ * @param  bmfa
+ *         A reference to a ByteMessageFieldArray object.
+ * @return A reference to a ByteMessageFieldArray object.
+ * @note   Copies data from one underlying array to the other.
+ */
+template <class T, size_t N, class ORDER>
+ByteMessageFieldArray<T, N, ORDER>& ByteMessageFieldArray<T, N, ORDER>::operator= (const ByteMessageFieldArray<T, N, ORDER> &bmfa) {
+    if (this == &bmfa) return *this;
+    memcpy(msgptr, bmfa.msgptr, size);
+    return *this;
+}
+
+/**
+ * @brief   Set value of a single element.
+ * @param   index
+ *          The index of the element. Out-of-bounds indices are ignored.
+ * @param   value
+ *          The value to write.
+ */
+template <class T, size_t N, class ORDER>
+void ByteMessageFieldArray<T, N, ORDER>::set(size_t index, T value) {
+    if (index < N) {
+        ByteMessageFieldCodec<T, ORDER>::encode(msgptr + index*element_size, value);
+    }
+}
+
+/**
+ * @brief   Get value of a single element.
+ * @param   index
+ *          The index of the element.
+ * @return  The value of the element, or T{} (i.e. zero) for an 
+ *          out-of-bounds index.
+ */
+template <class T, size_t N, class ORDER>
+T ByteMessageFieldArray<T, N, ORDER>::get(size_t index) const {
+    if (index < N) {
+        return ByteMessageFieldCodec<T, ORDER>::decode(msgptr + index*element_size);
+    }
+    else {
+        return T{};
+    }
+}
+
+/**
+ * @brief   Set value of a single element and patch a checksum.
+ * @param   index
+ *          The index of the element. Out-of-bounds indices are ignored.
+ * @param   value
+ *          The value to write.
+ * @param   checksum
+ *          A ByteMessageChecksum<T> operating on the same array. The
+ *          stored checksum must be valid before the call.
+ * @note    See ByteMessageField<T>::set(value, checksum).
+ */
+template <class T, size_t N, class ORDER>
+template <class CHECKSUM>
+void ByteMessageFieldArray<T, N, ORDER>::set(size_t index, T value, CHECKSUM &checksum) {
+    if (index < N) {
+        uint8_t * const ptr = msgptr + index*element_size;
+        uint8_t old_data[element_size];
+        memcpy(old_data, ptr, element_size);
+        ByteMessageFieldCodec<T, ORDER>::encode(ptr, value);
+        checksum.patch(ptr, old_data, element_size);
+    }
+}
+
+/**
+ * @brief   Set a range of elements from an array of values.
+ * @param   values
+ *          Pointer to array of values.
+ * @param   n
+ *          Number of values to copy from values. If first+n > count, not
+ *          all values are copied. Check the return value!
+ * @param   first
+ *          Index of the first element to set.
+ * @return  Number of elements set.
+ */
+template <class T, size_t N, class ORDER>
+size_t ByteMessageFieldArray<T, N, ORDER>::set_array(const T * values, size_t n, size_t first) {
+    if (first >= N) return 0;
+    if (n > N - first) n = N - first;
+    bm_encode_array<T, ORDER>(msgptr + first*element_size, values, n);
+    return n;
+}
+
+/**
+ * @brief   Copy a range of elements to an array of values.
+ * @param   values
+ *          Pointer to array of values to copy to.
+ * @param   n
+ *          Maximum number of values to copy to values. If first+n > count,
+ *          not all values are copied. Check the return value!
+ * @param   first
+ *          Index of the first element to get.
+ * @return  Number of values copied to values.
+ */
+template <class T, size_t N, class ORDER>
+size_t ByteMessageFieldArray<T, N, ORDER>::get_array(T * values, size_t n, size_t first) const {
+    if (first >= N) return 0;
+    if (n > N - first) n = N - first;
+    bm_decode_array<T, ORDER>(values, msgptr + first*element_size, n);
+    return n;
+}
+
+/**
+ * @brief   Return a pointer to the encoded data.
+ * @return  A pointer to the first byte of the first element.
+ */
+template <class T, size_t N, class ORDER>
+const uint8_t* ByteMessageFieldArray<T, N, ORDER>::get_ptr(void) const {
+    return msgptr;
+}
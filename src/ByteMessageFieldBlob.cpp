@@ -33,6 +33,9 @@
 #include "ByteMessageFieldBlob.h"
 #include <string.h> // needed for memcpy(), memset()
 
+// dummy byte for non-const subscript operator, shared by all blobs
+uint8_t ByteMessageFieldBlob::blackhole = 0;
+
 // constructor
 /**
  * @brief  The constructor
@@ -45,13 +48,34 @@
  *         represented by messagepointer.
  * @param  bloblength
  *         The length of the binary data in bytes.
+ * @param  prefill
+ *         If true (the default), the binary data is pre-filled with zeros.
+ *         If false, the bytes in the array are left as they are. Use this
+ *         if the blob is overwritten anyway, e.g. by set() or by 
+ *         ByteMessage::populate().
  */
-ByteMessageFieldBlob::ByteMessageFieldBlob(uint8_t * messagepointer, size_t pos, size_t bloblength) 
-    : size{bloblength}, msgptr{messagepointer+pos}, blackhole{0}, blackhole_const{0} {
-    zerofill(0); // pre-fill buffer with zeros
+ByteMessageFieldBlob::ByteMessageFieldBlob(uint8_t * messagepointer, size_t pos, size_t bloblength, bool prefill) 
+    : size{bloblength}, msgptr{messagepointer+pos} {
+    if (prefill) {
+        zerofill(0); // pre-fill buffer with zeros
+    }
     return;
 }
 
+// constructor without initialization
+/**
+ * @brief  The constructor for uninitialized messages
+ * @param  messagepointer
+ *         A pointer to the beginning on an array of bytes.
+ * @param  pos
+ *         A position into the array given by messagepointer.
+ * @param  bloblength
+ *         The length of the binary data in bytes.
+ * @note   Same as the other constructor with prefill=false.
+ */
+ByteMessageFieldBlob::ByteMessageFieldBlob(uint8_t * messagepointer, size_t pos, size_t bloblength, ByteMessageUninitialized) 
+    : ByteMessageFieldBlob{messagepointer, pos, bloblength, false} {}
+
 // assignment operator
 /**
  * @brief  The copy-assignment operator 
@@ -76,71 +100,6 @@ ByteMessageFieldBlob& ByteMessageFieldBlob::operator= (const ByteMessageFieldBlo
     return *this;
 }
 
-// subscript operator (read & write)
-/**
- * @brief   The subscript operator
- * @details Access the raw bytes of the underlying array like an array.
- *          Using this operator it is possible to access the data in the
- *          underlying array byte by byte.
- *          If you try to access an element by an out-of-bounds index, a 
- *          reference to an instance-internal value is returned. Your can
- *          write to this reference, but whenever any out-of bounds element
- *          the value will be reset to 0.
- *          It is not possible to read or write out-of-bounds data using
- *          this operator, i.e. it is safe to use.
- * @param   index
- *          The index into the underlying array.
- * @return  A reference to the element in the underlying array.
- * @note    In fact you @b can read from and write to the dummy reference
- *          which is returned when accessing an out-of-bounds index.
- *          However, this is not really useful, because the value is reset to 
- *          0 whenever the subscript operator is used with an out-of-bounds
- *          index. Don't outsmart yourself!
- */
-uint8_t& ByteMessageFieldBlob::operator[](size_t index) {
-    if (index < size) {
-        // in range - reading and writing is ok
-        return msgptr[index];
-    }
-    else {
-        // re-set blackhole to 0 immediately before returning
-        // --> all out-of-bounds reads will return 0
-        blackhole = 0;
-        return blackhole;
-    }
-}
-
-// const subscript operator (read-only)
-/**
- * @brief   Read-only subscript operator for constant instances
- * @details Access the raw bytes of the underlying array like an array.
- *          Using this operator it is possible to access the data in the
- *          underlying array byte by byte.
- *          This operator works read-only. You cannot change data in the
- *          underlying array by assigning to an array element.
- *          If you try to access an element by an out-of-bounds index, a 
- *          reference to a constant containing zero is returned. It is not
- *          possible to read out-of-bounds data using this operator.
- *          Trying to write data (in-bounds or out-of-bounds) will result
- *          in a compile-time error.
- * @param   index
- *          The index into the underlying array.
- * @return  A constant reference to the element in the underlying array.
- * @note    There comes really no good use case for constant
- *          ByteMessageFieldBlob objects to mind. But who knows, maybe
- *          this is useful to somebody in the future.
- */
-const uint8_t& ByteMessageFieldBlob::operator[](size_t index) const {
-    if (index < size) {
-        // in range - reading and writing is ok
-        return msgptr[index];
-    }
-    else {
-        // always return reference to constant 0
-        return blackhole_const;
-    }
-}
-
 // copy data from *data to the message
 // return the number of bytes effectively copied
 /**
@@ -212,6 +171,27 @@ const uint8_t* ByteMessageFieldBlob::get_ptr(void) const {
     return static_cast<const uint8_t*>(msgptr);
 }
 
+// get unchecked span of blob (read & write)
+/**
+ * @brief   Get an unchecked span of the blob.
+ * @details Use this for loops over many bytes. The subscript operator of
+ *          the span does not check the index (unless BM_DEBUG_BOUNDS is
+ *          defined), and range-based for loops work.
+ * @return  A span of all size bytes of the blob.
+ */
+ByteMessageSpan<uint8_t> ByteMessageFieldBlob::span(void) {
+    return ByteMessageSpan<uint8_t>{msgptr, size};
+}
+
+// get unchecked span of blob (read-only)
+/**
+ * @brief   Get an unchecked read-only span of the blob.
+ * @return  A read-only span of all size bytes of the blob.
+ */
+ByteMessageSpan<const uint8_t> ByteMessageFieldBlob::span(void) const {
+    return ByteMessageSpan<const uint8_t>{msgptr, size};
+}
+
 // helper function to fill blob with zeros, starting at startpos 
 // relative to start of blob
 void ByteMessageFieldBlob::zerofill(size_t startpos) {
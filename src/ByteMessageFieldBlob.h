@@ -36,6 +36,9 @@
 #include <stdint.h> // needed for fixed-size data types
 #include <stddef.h> // needed for size_t data type
 
+#include "ByteMessageField.h" // needed for ByteMessageUninitialized
+#include "ByteMessageSpan.h"  // needed for span()
+
 /**
  * @class   ByteMessageFieldBlob
  * @brief   Class for generic data fields in ByteMessage objects.
@@ -47,7 +50,11 @@ class ByteMessageFieldBlob final {
     public:
         // constructor
         // Note: There is *NO* error checking to prevent pos+bloblength > sizeof(messagepointer)
-        ByteMessageFieldBlob(uint8_t * messagepointer, size_t pos, size_t bloblength); 
+        // Note: Use prefill=false to skip zero-filling if the blob is overwritten anyway.
+        ByteMessageFieldBlob(uint8_t * messagepointer, size_t pos, size_t bloblength, bool prefill=true); 
+
+        // constructor, same as prefill=false
+        ByteMessageFieldBlob(uint8_t * messagepointer, size_t pos, size_t bloblength, ByteMessageUninitialized); 
         
         // delete copy constructor
         ByteMessageFieldBlob(const ByteMessageFieldBlob &copy) = delete; ///< The copy constructor is explicitly deleted.
@@ -59,6 +66,7 @@ class ByteMessageFieldBlob final {
         ByteMessageFieldBlob& operator= (const ByteMessageFieldBlob &bmfb);
         
         // subscript operator
+        // Note: Defined in this header file, so that loops can inline them.
         uint8_t& operator[](size_t index);              // read & write
         const uint8_t& operator[](size_t index) const;  // read-only / const
         
@@ -66,6 +74,8 @@ class ByteMessageFieldBlob final {
         size_t set(uint8_t value=0);                     // set whole blob to constant value
         size_t get(uint8_t * data, size_t length) const; // return number of bytes copied from msgptr to data
         const uint8_t* get_ptr(void) const;              // return pointer to constant data
+        ByteMessageSpan<uint8_t> span(void);             // return unchecked span (read & write)
+        ByteMessageSpan<const uint8_t> span(void) const; // return unchecked span (read-only)
 
         // public member variables
         const size_t size; ///< Size of the binary blob in bytes.
@@ -76,8 +86,59 @@ class ByteMessageFieldBlob final {
         
         // private member variables
         uint8_t * const msgptr; // const pointer to non-const value
-        uint8_t blackhole;             // dummy memory reference for non-const subscript operator
-        const uint8_t blackhole_const; // dummy memory reference for const subscript operator
+        static uint8_t blackhole; // dummy memory reference for non-const subscript operator, shared by all blobs
 };
 
+// subscript operator (read & write)
+/**
+ * @brief   The subscript operator
+ * @details Access the raw bytes of the underlying array like an array.
+ *          Using this operator it is possible to access the data in the
+ *          underlying array byte by byte.
+ *          If you try to access an element by an out-of-bounds index, a 
+ *          reference to a dummy byte shared by all blobs is returned. You 
+ *          can write to this reference, but whenever any out-of bounds 
+ *          element is accessed the value will be reset to 0.
+ *          It is not possible to read or write out-of-bounds data using
+ *          this operator, i.e. it is safe to use. For loops over many 
+ *          bytes, span() is faster.
+ * @param   index
+ *          The index into the underlying array.
+ * @return  A reference to the element in the underlying array.
+ * @note    In fact you @b can read from and write to the dummy reference
+ *          which is returned when accessing an out-of-bounds index.
+ *          However, this is not really useful, because the value is reset to 
+ *          0 whenever the subscript operator is used with an out-of-bounds
+ *          index. Don't outsmart yourself!
+ */
+inline uint8_t& ByteMessageFieldBlob::operator[](size_t index) {
+    BM_ASSERT_INDEX(index, size);
+    if (index < size) {
+        // in range - reading and writing is ok
+        return msgptr[index];
+    }
+    // re-set blackhole to 0 immediately before returning
+    // --> all out-of-bounds reads will return 0
+    blackhole = 0;
+    return blackhole;
+}
+
+// const subscript operator (read-only)
+/**
+ * @brief   Read-only subscript operator for constant instances
+ * @details Access the raw bytes of the underlying array like an array.
+ *          This operator works read-only. If you try to access an element
+ *          by an out-of-bounds index, a reference to a constant containing
+ *          zero is returned. It is not possible to read out-of-bounds data
+ *          using this operator.
+ * @param   index
+ *          The index into the underlying array.
+ * @return  A constant reference to the element in the underlying array.
+ */
+inline const uint8_t& ByteMessageFieldBlob::operator[](size_t index) const {
+    BM_ASSERT_INDEX(index, size);
+    // select the address instead of branching
+    return *((index < size) ? msgptr + index : &bm_zero_byte);
+}
+
 #endif
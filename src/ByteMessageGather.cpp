@@ -0,0 +1,215 @@
+/**
+ * @file    ByteMessageGather.cpp
+ * @brief   Implementation file for the non-template members of the ByteMessageGather class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageGather_cpp License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ByteMessageGather.h"
+#include <string.h> // needed for memcpy()
+
+const ByteMessageSegment ByteMessageGather::empty = {nullptr, 0};
+
+// constructor
+/**
+ * @brief  Create an empty gather without segments.
+ */
+ByteMessageGather::ByteMessageGather(void)
+    : segments{}, segment_count{0}, checksum_bytes{0} {}
+
+// copy constructor
+/**
+ * @brief  Create a copy of a gather.
+ * @param  other
+ *         The gather to copy.
+ * @note   The checksum segment of the copy points to the checksum 
+ *         stored in the copy, all other segments are shared.
+ */
+ByteMessageGather::ByteMessageGather(const ByteMessageGather &other)
+    : segments{}, segment_count{0}, checksum_bytes{0} {
+    *this = other;
+}
+
+// assignment operator
+/**
+ * @brief  Copy the segments and the checksum of another gather.
+ * @param  other
+ *         The gather to copy.
+ * @return A reference to this object.
+ * @note   See copy constructor.
+ */
+ByteMessageGather& ByteMessageGather::operator= (const ByteMessageGather &other) {
+    if (this == &other) return *this;
+    memcpy(checksum_bytes, other.checksum_bytes, sizeof(checksum_bytes));
+    segment_count = other.segment_count;
+    for (size_t i = 0; i < max_segments; i++) {
+        segments[i] = other.segments[i];
+        if (segments[i].data == other.checksum_bytes) {
+            segments[i].data = checksum_bytes;
+        }
+    }
+    return *this;
+}
+
+// build() for raw frames without checksum
+/**
+ * @brief  Describe a raw frame with some bytes taken from a buffer.
+ * @param  frame
+ *         A pointer to the frame. It is not changed.
+ * @param  frame_size
+ *         The number of bytes of the frame.
+ * @param  offset
+ *         Position of the first byte which is taken from payload.
+ * @param  payload
+ *         A pointer to the payload.
+ * @param  payload_length
+ *         The number of bytes of the payload.
+ * @return true if the segments were built, false if the payload does not
+ *         fit into the frame. If false, the gather is empty.
+ */
+bool ByteMessageGather::build(const uint8_t * frame, size_t frame_size, size_t offset, const uint8_t * payload, size_t payload_length) {
+    return assemble(frame, frame_size, offset, payload, payload_length, 0, 0);
+}
+
+// clear()
+/**
+ * @brief  Remove all segments.
+ */
+void ByteMessageGather::clear(void) {
+    segment_count = 0;
+}
+
+// count()
+/**
+ * @brief  Get the number of segments.
+ * @return The number of segments, at most max_segments. Empty segments 
+ *         are left out.
+ */
+size_t ByteMessageGather::count(void) const {
+    return segment_count;
+}
+
+// length()
+/**
+ * @brief  Get the size of the frame.
+ * @return The total number of bytes of all segments.
+ */
+size_t ByteMessageGather::length(void) const {
+    size_t total = 0;
+    for (size_t i = 0; i < segment_count; i++) {
+        total += segments[i].length;
+    }
+    return total;
+}
+
+// read-only subscript operator
+/**
+ * @brief  Access a segment.
+ * @param  index
+ *         The index of the segment, in the order of transmission.
+ * @return A constant reference to the segment. For out-of-bounds indices,
+ *         a segment with nullptr and length 0 is returned.
+ */
+const ByteMessageSegment& ByteMessageGather::operator[] (size_t index) const {
+    if (index >= segment_count) {
+        return empty;
+    }
+    return segments[index];
+}
+
+// get()
+/**
+ * @brief  Copy the frame into a buffer.
+ * @param  data
+ *         A pointer to the buffer.
+ * @param  length
+ *         The size of the buffer.
+ * @return The number of bytes copied. The frame is truncated if the 
+ *         buffer is too small.
+ * @note   For transports which cannot send segments. This is the staging
+ *         copy the gather otherwise avoids.
+ */
+size_t ByteMessageGather::get(uint8_t * data, size_t length) const {
+    if (data == nullptr) return 0;
+    size_t copied = 0;
+    for (size_t i = 0; i < segment_count && copied < length; i++) {
+        const size_t n = (segments[i].length < length - copied) ? segments[i].length : length - copied;
+        memcpy(data + copied, segments[i].data, n);
+        copied += n;
+    }
+    return copied;
+}
+
+// append()
+// add segment to list, skip empty segments
+void ByteMessageGather::append(const uint8_t * data, size_t length) {
+    if (length == 0) return;
+    segments[segment_count].data = data;
+    segments[segment_count].length = length;
+    segment_count++;
+}
+
+// assemble()
+// The frame is split at the payload and at the checksum (if checksum_size 
+// is not 0). Both are inserted in the order of their positions, all other
+// bytes are taken from frame.
+bool ByteMessageGather::assemble(const uint8_t * frame, size_t frame_size, size_t offset, const uint8_t * payload, size_t payload_length, 
+                                 size_t checksum_pos, size_t checksum_size) {
+    clear();
+    if (frame == nullptr || offset > frame_size || payload_length > frame_size - offset || (payload == nullptr && payload_length > 0)) {
+        return false;
+    }
+    if (checksum_size > 0) {
+        if (checksum_pos > frame_size || checksum_size > frame_size - checksum_pos) {
+            return false;
+        }
+        if (checksum_pos < offset + payload_length && offset < checksum_pos + checksum_size) {
+            return false; // overlap
+        }
+    }
+    if (checksum_size > 0 && checksum_pos < offset) {
+        append(frame, checksum_pos);
+        append(checksum_bytes, checksum_size);
+        append(frame + checksum_pos + checksum_size, offset - checksum_pos - checksum_size);
+        append(payload, payload_length);
+        append(frame + offset + payload_length, frame_size - offset - payload_length);
+    }
+    else if (checksum_size > 0) {
+        append(frame, offset);
+        append(payload, payload_length);
+        append(frame + offset + payload_length, checksum_pos - offset - payload_length);
+        append(checksum_bytes, checksum_size);
+        append(frame + checksum_pos + checksum_size, frame_size - checksum_pos - checksum_size);
+    }
+    else {
+        append(frame, offset);
+        append(payload, payload_length);
+        append(frame + offset + payload_length, frame_size - offset - payload_length);
+    }
+    return true;
+}
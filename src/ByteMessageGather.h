@@ -0,0 +1,160 @@
+/**
+ * @file    ByteMessageGather.h
+ * @brief   Header file for the ByteMessageGather class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageGather_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ByteMessageGather_h
+#define ByteMessageGather_h
+
+#include <stdint.h> // needed for fixed-size data types
+#include <stddef.h> // needed for size_t data type
+
+#include "ByteMessageFieldBlob.h"
+#include "ByteMessageChecksum.h"
+#include "ByteMessageChecksumDelta.h"
+#include "ByteMessageChecksumStream.h"
+
+/* Note: This header file also includes the complete implementation from ByteMessageGather.hpp! */
+
+/* 
+ * Important points:
+ * - A ByteMessageGather describes a frame as a list of up to five 
+ *   segments (pointer and length), e.g. for writev() or chained DMA 
+ *   descriptors: the bytes of the message before the blob (type byte and
+ *   fixed fields), the payload in a buffer owned by the caller, the bytes
+ *   after the blob and the checksum. Nothing is copied.
+ * - The message itself is not changed. Its blob may hold anything, and 
+ *   its stored checksum is ignored: the checksum of the frame as it is 
+ *   sent is calculated across the segments and stored in the gather 
+ *   object, which provides the checksum segment.
+ * - For XOR, two's complement and one's complement sums, the checksum is
+ *   derived from the checksum of the message and the payload with the 
+ *   delta functions (see ByteMessageChecksumDelta.h). Fletcher and Luhn
+ *   (base 256) are streamed over the pieces (see ByteMessageChecksumStream.h).
+ *   Other algorithms calculate the checksum over a copy of the covered 
+ *   bytes on the stack.
+ * - Only compile-time checksums (ByteMessageChecksum<T, POS, FUNC>) can be
+ *   used, because the gather needs their position and function. They can
+ *   be declared in messages with classic fields, too.
+ * - Message and payload must outlive the gather object. Build it again 
+ *   after the message or the payload has changed.
+ * - A copy of a gather object shares message and payload with the 
+ *   original, but has its own copy of the checksum.
+ */
+
+/**
+ * @struct  ByteMessageSegment
+ * @brief   A contiguous piece of a frame, like struct iovec.
+ */
+struct ByteMessageSegment {
+    const uint8_t * data; ///< Pointer to the first byte of the segment.
+    size_t length;        ///< Number of bytes in the segment.
+};
+
+/**
+ * @class   ByteMessageGather
+ * @brief   A frame as a list of segments, with the payload of a blob 
+ *          taken from a buffer of the caller.
+ * @details Usage:
+ * 
+ *              ByteMessageGather g;
+ *              g.build(msg, msg.payload, buffer, length, FileChunk::checksum);
+ *              for (size_t i = 0; i < g.count(); i++) {
+ *                  iov[i].iov_base = const_cast<uint8_t*>(g[i].data);
+ *                  iov[i].iov_len  = g[i].length;
+ *              }
+ *              writev(fd, iov, g.count());
+ */
+class ByteMessageGather final {
+    public:
+        static constexpr size_t max_segments = 5;    ///< Largest number of segments of a frame.
+
+        ByteMessageGather(void);                     // create empty gather
+
+        // copies point their checksum segment to their own checksum
+        ByteMessageGather(const ByteMessageGather &other);
+        ByteMessageGather& operator= (const ByteMessageGather &other);
+
+        // describe msg with payload in place of blob, and checksum calculated across segments
+        template <class MSG, class T, size_t POS, T (*FUNC)(const uint8_t*, size_t)>
+        bool build(const MSG &msg, const ByteMessageFieldBlob &blob, const uint8_t * payload, size_t payload_length, 
+                   const ByteMessageChecksum<T, POS, FUNC> &checksum);
+
+        // describe msg with payload in place of blob, for messages without checksum
+        template <class MSG>
+        bool build(const MSG &msg, const ByteMessageFieldBlob &blob, const uint8_t * payload, size_t payload_length);
+
+        // describe raw frame with payload at offset, and checksum calculated across segments
+        template <class T, size_t POS, T (*FUNC)(const uint8_t*, size_t)>
+        bool build(const uint8_t * frame, size_t frame_size, size_t offset, const uint8_t * payload, size_t payload_length, 
+                   const ByteMessageChecksum<T, POS, FUNC> &checksum);
+
+        // describe raw frame with payload at offset, without checksum
+        bool build(const uint8_t * frame, size_t frame_size, size_t offset, const uint8_t * payload, size_t payload_length);
+
+        // remove all segments
+        void clear(void);
+
+        // number of segments
+        size_t count(void) const;
+
+        // total number of bytes of all segments
+        size_t length(void) const;
+
+        // access segment
+        const ByteMessageSegment& operator[](size_t index) const;
+
+        // copy all segments into data, return number of bytes copied
+        size_t get(uint8_t * data, size_t length) const;
+
+    private:
+        ByteMessageSegment segments[max_segments];   // the segments
+        size_t segment_count;                        // number of used segments
+        uint8_t checksum_bytes[8];                   // encoded checksum of the frame
+        static const ByteMessageSegment empty;       // returned for out-of-bounds indices
+
+        // append segment, skip empty ones
+        void append(const uint8_t * data, size_t length);
+
+        // fill segments, with optional checksum at checksum_pos
+        bool assemble(const uint8_t * frame, size_t frame_size, size_t offset, const uint8_t * payload, size_t payload_length, 
+                      size_t checksum_pos, size_t checksum_size);
+
+        // checksum over frame with covered bytes at offset taken from payload, with and without streaming functions
+        template <class T, size_t POS, T (*FUNC)(const uint8_t*, size_t)>
+        static T calc_across(const uint8_t * frame, size_t offset, const uint8_t * payload, size_t covered, bm_bool_tag<true>);
+        template <class T, size_t POS, T (*FUNC)(const uint8_t*, size_t)>
+        static T calc_across(const uint8_t * frame, size_t offset, const uint8_t * payload, size_t covered, bm_bool_tag<false>);
+};
+
+// include implementation file
+#include "ByteMessageGather.hpp"
+
+#endif
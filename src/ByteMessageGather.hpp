@@ -0,0 +1,165 @@
+/**
+ * @file    ByteMessageGather.hpp
+ * @brief   Implementation file for the ByteMessageGather class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageGather_hpp License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h> // needed for memcpy()
+
+// implement build() for messages with checksum
+/**
+ * @brief  Describe a message with the payload of a blob taken from a buffer.
+ * @param  msg
+ *         The message. It is not changed.
+ * @param  blob
+ *         The blob of msg which is replaced by the payload.
+ * @param  payload
+ *         A pointer to the payload.
+ * @param  payload_length
+ *         The number of bytes of the payload. If it is shorter than the 
+ *         blob, the remaining bytes of the blob are taken from msg.
+ * @param  checksum
+ *         The compile-time checksum of msg. It is calculated across the 
+ *         segments and sent instead of the checksum stored in msg.
+ * @return true if the segments were built, false if blob does not belong
+ *         to msg, the payload is longer than the blob or overlaps the 
+ *         checksum. If false, the gather is empty.
+ */
+template <class MSG, class T, size_t POS, T (*FUNC)(const uint8_t*, size_t)>
+bool ByteMessageGather::build(const MSG &msg, const ByteMessageFieldBlob &blob, const uint8_t * payload, size_t payload_length, 
+                              const ByteMessageChecksum<T, POS, FUNC> &checksum) {
+    static_assert(POS + sizeof(T) <= MSG::size, "checksum does not fit into message");
+    const uint8_t * base = msg.get_ptr();
+    const uint8_t * blob_ptr = blob.get_ptr();
+    if (blob_ptr < base || blob_ptr + blob.size > base + MSG::size || payload_length > blob.size) {
+        clear();
+        return false;
+    }
+    return build(base, MSG::size, static_cast<size_t>(blob_ptr - base), payload, payload_length, checksum);
+}
+
+// implement build() for messages without checksum
+/**
+ * @brief  Describe a message with the payload of a blob taken from a buffer.
+ * @param  msg
+ *         The message. It is not changed.
+ * @param  blob
+ *         The blob of msg which is replaced by the payload.
+ * @param  payload
+ *         A pointer to the payload.
+ * @param  payload_length
+ *         The number of bytes of the payload. If it is shorter than the 
+ *         blob, the remaining bytes of the blob are taken from msg.
+ * @return true if the segments were built, false if blob does not belong
+ *         to msg or the payload is longer than the blob. If false, the 
+ *         gather is empty.
+ */
+template <class MSG>
+bool ByteMessageGather::build(const MSG &msg, const ByteMessageFieldBlob &blob, const uint8_t * payload, size_t payload_length) {
+    const uint8_t * base = msg.get_ptr();
+    const uint8_t * blob_ptr = blob.get_ptr();
+    if (blob_ptr < base || blob_ptr + blob.size > base + MSG::size || payload_length > blob.size) {
+        clear();
+        return false;
+    }
+    return build(base, MSG::size, static_cast<size_t>(blob_ptr - base), payload, payload_length);
+}
+
+// implement build() for raw frames with checksum
+/**
+ * @brief  Describe a raw frame with some bytes taken from a buffer.
+ * @param  frame
+ *         A pointer to the frame. It is not changed.
+ * @param  frame_size
+ *         The number of bytes of the frame.
+ * @param  offset
+ *         Position of the first byte which is taken from payload.
+ * @param  payload
+ *         A pointer to the payload.
+ * @param  payload_length
+ *         The number of bytes of the payload.
+ * @param  checksum
+ *         The compile-time checksum of the frame. It is calculated across 
+ *         the segments and sent instead of the checksum stored in frame.
+ * @return true if the segments were built, false if payload or checksum
+ *         do not fit into the frame or overlap. If false, the gather is 
+ *         empty.
+ * @note   Checksums with delta functions cost O(payload_length) on top of
+ *         the checksum over frame. Checksums with streaming functions are
+ *         calculated over the three pieces in a row. All others (e.g. CRC)
+ *         are calculated over a copy of the first POS bytes on the stack.
+ */
+template <class T, size_t POS, T (*FUNC)(const uint8_t*, size_t)>
+bool ByteMessageGather::build(const uint8_t * frame, size_t frame_size, size_t offset, const uint8_t * payload, size_t payload_length, 
+                              const ByteMessageChecksum<T, POS, FUNC> &) {
+    static_assert(POS != BM_RUNTIME_POSITION, "only compile-time checksums can be calculated across segments");
+    static_assert(sizeof(T) <= sizeof(checksum_bytes), "checksum type too large");
+    if (!assemble(frame, frame_size, offset, payload, payload_length, POS, sizeof(T))) {
+        return false;
+    }
+    // number of payload bytes covered by the checksum
+    const size_t covered = (offset >= POS) ? 0 : ((payload_length < POS - offset) ? payload_length : POS - offset);
+    constexpr auto delta_function = ByteMessageChecksumDelta<T>::template find<FUNC>();
+    T value;
+    if (ByteMessageChecksumDelta<T>::template has<FUNC>()) {
+        value = FUNC(frame, POS);
+        if (covered > 0) {
+            value = delta_function(value, offset, frame + offset, payload, covered);
+        }
+    }
+    else if (covered == 0) {
+        value = FUNC(frame, POS);
+    }
+    else {
+        value = calc_across<T, POS, FUNC>(frame, offset, payload, covered, bm_bool_tag<ByteMessageChecksumStream<T, FUNC>::supported>{});
+    }
+    ByteMessageFieldCodec<T>::encode(checksum_bytes, value);
+    return true;
+}
+
+// checksum across segments, with streaming functions
+template <class T, size_t POS, T (*FUNC)(const uint8_t*, size_t)>
+T ByteMessageGather::calc_across(const uint8_t * frame, size_t offset, const uint8_t * payload, size_t covered, bm_bool_tag<true>) {
+    using stream = ByteMessageChecksumStream<T, FUNC>;
+    typename stream::context_type ctx;
+    stream::init(ctx);
+    stream::update(ctx, frame, offset);
+    stream::update(ctx, payload, covered);
+    stream::update(ctx, frame + offset + covered, POS - offset - covered);
+    return stream::final(ctx);
+}
+
+// checksum across segments, over a copy of the covered bytes
+template <class T, size_t POS, T (*FUNC)(const uint8_t*, size_t)>
+T ByteMessageGather::calc_across(const uint8_t * frame, size_t offset, const uint8_t * payload, size_t covered, bm_bool_tag<false>) {
+    uint8_t covered_bytes[POS];
+    memcpy(covered_bytes, frame, POS);
+    memcpy(covered_bytes + offset, payload, covered);
+    return FUNC(covered_bytes, POS);
+}
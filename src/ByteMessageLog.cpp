@@ -0,0 +1,442 @@
+/**
+ * @file    ByteMessageLog.cpp
+ * @brief   Implementation file for the ByteMessageLogWriter and ByteMessageLogReader classes
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageLog_cpp License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* ByteMessageLog is host-only, nothing is compiled for Arduino boards. */
+#if !defined(ARDUINO) || defined(BM_HOST)
+
+#include "ByteMessageLog.h"
+#include "bm_checksum_crc.h" // needed for crc32_checksum()
+
+#include <string.h>    // needed for memcpy()
+#include <algorithm>   // needed for std::stable_sort() (host only)
+
+#include <fcntl.h>     // needed for open() (POSIX)
+#include <sys/mman.h>  // needed for mmap() (POSIX)
+#include <sys/stat.h>  // needed for fstat() (POSIX)
+#include <unistd.h>    // needed for close(), truncate() (POSIX)
+
+/* ByteMessageLogWriter */
+
+// constructor
+/**
+ * @brief  Create a writer without an open file.
+ * @param  frames_per_block
+ *         Number of frames collected in memory before a block is written.
+ *         Larger blocks have less overhead, smaller blocks lose less 
+ *         frames on a crash.
+ */
+ByteMessageLogWriter::ByteMessageLogWriter(size_t frames_per_block)
+    : file{nullptr}, failed{false}, block_frames{(frames_per_block > 0) ? frames_per_block : 1} {}
+
+// destructor
+/**
+ * @brief  Write pending frames and close the file.
+ */
+ByteMessageLogWriter::~ByteMessageLogWriter(void) {
+    close();
+}
+
+// implement open()
+/**
+ * @brief  Create a new log file or open an existing one for appending.
+ * @param  path
+ *         Path of the log file.
+ * @return true on success, false if a file is already open, the file is
+ *         not a log file or cannot be written.
+ * @note   A damaged block at the end of an existing log (e.g. after a 
+ *         crash while writing) is cut off, so that new blocks can be read.
+ */
+bool ByteMessageLogWriter::open(const char * path) {
+    if (file != nullptr) return false;
+    failed = false;
+    struct stat st;
+    if (stat(path, &st) == 0 && static_cast<size_t>(st.st_size) >= bm_log_header_size) {
+        // existing log: keep intact blocks, append behind them
+        size_t valid = 0;
+        {
+            ByteMessageLogReader reader;
+            if (!reader.open(path)) return false;
+            valid = reader.valid_size();
+        }
+        if (valid < static_cast<size_t>(st.st_size) && truncate(path, static_cast<off_t>(valid)) != 0) return false;
+        file = fopen(path, "ab");
+        return file != nullptr;
+    }
+    // new log (or one which does not even hold a complete file header)
+    file = fopen(path, "wb");
+    if (file == nullptr) return false;
+    uint8_t header[bm_log_header_size] = {0};
+    ByteMessageFieldCodec<uint32_t>::encode(header, bm_log_magic);
+    ByteMessageFieldCodec<uint16_t>::encode(header + 4, bm_log_version);
+    ByteMessageFieldCodec<uint16_t>::encode(header + 6, static_cast<uint16_t>(bm_log_header_size));
+    ByteMessageFieldCodec<uint32_t>::encode(header + 8, static_cast<uint32_t>(block_frames));
+    if (fwrite(header, 1, sizeof(header), file) != sizeof(header) || fflush(file) != 0) {
+        fclose(file);
+        file = nullptr;
+        return false;
+    }
+    return true;
+}
+
+// implement close()
+/**
+ * @brief  Write pending frames and close the file.
+ * @return true if all frames were written, false otherwise (including 
+ *         an earlier failed block, see flush()) or if no file was open.
+ */
+bool ByteMessageLogWriter::close(void) {
+    if (file == nullptr) return false;
+    const bool flushed = !failed && flush();
+    const bool closed = (fclose(file) == 0);
+    file = nullptr;
+    failed = false;
+    return flushed && closed;
+}
+
+// implement is_open()
+/**
+ * @brief  Check if a log file is open.
+ * @return true if open() was successful and close() was not called yet.
+ */
+bool ByteMessageLogWriter::is_open(void) const {
+    return file != nullptr;
+}
+
+// implement append() for raw frames
+/**
+ * @brief  Append a raw frame to the log.
+ * @param  frame
+ *         Pointer to the frame. The first byte is the type.
+ * @param  frame_size
+ *         Number of bytes of the frame.
+ * @return true on success, false if the log is not open, the frame is 
+ *         empty or writing a block failed (now or earlier, see flush()).
+ * @note   The frame is copied into the current block. The block is 
+ *         written when it holds frames_per_block frames.
+ */
+bool ByteMessageLogWriter::append(const uint8_t * frame, size_t frame_size) {
+    if (file == nullptr || failed || frame_size == 0 || frame_size > UINT32_MAX) return false;
+    // offsets within a block are 32 bit
+    if (data.size() + frame_size > UINT32_MAX && !flush()) return false;
+    frames.push_back(Frame{frame[0], static_cast<uint32_t>(frame_size), static_cast<uint32_t>(data.size())});
+    data.insert(data.end(), frame, frame + frame_size);
+    if (frames.size() >= block_frames) {
+        return flush();
+    }
+    return true;
+}
+
+// implement flush()
+/**
+ * @brief  Write all pending frames to the file as one block.
+ * @return true on success (or if nothing was pending), false if no file
+ *         is open or writing failed (now or earlier).
+ * @note   If writing failed, the pending frames are dropped and the file
+ *         may end with a damaged block. Blocks behind it could never be
+ *         read, so the writer refuses all further frames: append(), 
+ *         flush() and close() return false until the log is opened again.
+ *         open() cuts the damaged block off.
+ */
+bool ByteMessageLogWriter::flush(void) {
+    if (file == nullptr || failed) return false;
+    if (frames.empty()) return true;
+
+    // group frames by type and size, keep order of appending within each group
+    std::stable_sort(frames.begin(), frames.end(), [](const Frame &a, const Frame &b) {
+        return (a.type != b.type) ? (a.type < b.type) : (a.size < b.size);
+    });
+    uint32_t groups = 0;
+    for (size_t i = 0; i < frames.size(); i++) {
+        if (i == 0 || frames[i].type != frames[i-1].type || frames[i].size != frames[i-1].size) ++groups;
+    }
+
+    // build index
+    index.assign(4 + groups * bm_log_group_size + 4 * frames.size(), 0);
+    ByteMessageFieldCodec<uint32_t>::encode(index.data(), groups);
+    uint8_t * group   = index.data() + 4;
+    uint8_t * offsets = group + groups * bm_log_group_size;
+    for (size_t i = 0; i < frames.size(); i++) {
+        if (i == 0 || frames[i].type != frames[i-1].type || frames[i].size != frames[i-1].size) {
+            if (i > 0) group += bm_log_group_size;
+            group[0] = frames[i].type;
+            ByteMessageFieldCodec<uint32_t>::encode(group + 4, frames[i].size);
+        }
+        ByteMessageFieldCodec<uint32_t>::encode(group + 8, ByteMessageFieldCodec<uint32_t>::decode(group + 8) + 1);
+        ByteMessageFieldCodec<uint32_t>::encode(offsets + 4*i, frames[i].offset);
+    }
+
+    // block header, index and frames
+    uint8_t header[bm_log_block_header_size];
+    ByteMessageFieldCodec<uint32_t>::encode(header, bm_log_block_magic);
+    ByteMessageFieldCodec<uint32_t>::encode(header + 4, static_cast<uint32_t>(frames.size()));
+    ByteMessageFieldCodec<uint32_t>::encode(header + 8, static_cast<uint32_t>(index.size()));
+    ByteMessageFieldCodec<uint32_t>::encode(header + 12, static_cast<uint32_t>(data.size()));
+    ByteMessageFieldCodec<uint32_t>::encode(header + 16, crc32_checksum(index.data(), index.size()));
+    const bool ok = fwrite(header, 1, sizeof(header), file) == sizeof(header) &&
+                    fwrite(index.data(), 1, index.size(), file) == index.size() &&
+                    fwrite(data.data(), 1, data.size(), file) == data.size() &&
+                    fflush(file) == 0;
+    frames.clear();
+    data.clear();
+    failed = !ok;
+    return ok;
+}
+
+// implement pending()
+/**
+ * @brief  Get the number of frames which are not written to the file yet.
+ * @return Number of frames in the current block.
+ */
+size_t ByteMessageLogWriter::pending(void) const {
+    return frames.size();
+}
+
+/* ByteMessageLogReader */
+
+// constructor
+/**
+ * @brief  Create a reader without an open log.
+ */
+ByteMessageLogReader::ByteMessageLogReader(void)
+    : log_data{nullptr}, log_size{0}, mapped{false}, block_size{0}, valid_bytes{0}, frame_counter{} {}
+
+// destructor
+/**
+ * @brief  Unmap the log file.
+ */
+ByteMessageLogReader::~ByteMessageLogReader(void) {
+    close();
+}
+
+// implement open() for files
+/**
+ * @brief  Map a log file into memory (read-only).
+ * @param  path
+ *         Path of the log file.
+ * @return true if the file was mapped and has a valid file header,
+ *         false otherwise.
+ * @note   Only the block headers and indices are read. A damaged block
+ *         and everything behind it is ignored, see valid_size().
+ */
+bool ByteMessageLogReader::open(const char * path) {
+    close();
+    const int fd = ::open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+    void * p = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // the mapping stays valid
+    if (p == MAP_FAILED) return false;
+    log_data = static_cast<const uint8_t*>(p);
+    log_size = static_cast<size_t>(st.st_size);
+    mapped = true;
+    if (!load()) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+// implement open() for logs in memory
+/**
+ * @brief  Use a log which is already in memory.
+ * @param  log
+ *         Pointer to the log. It must outlive the reader.
+ * @param  log_size
+ *         Number of bytes of the log.
+ * @return true if the log has a valid file header, false otherwise.
+ */
+bool ByteMessageLogReader::open(const uint8_t * log, size_t log_size) {
+    close();
+    if (log == nullptr) return false;
+    this->log_data = log;
+    this->log_size = log_size;
+    if (!load()) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+// implement close()
+/**
+ * @brief  Unmap the log file (if it was mapped by open()) and forget the log.
+ */
+void ByteMessageLogReader::close(void) {
+    if (mapped) {
+        munmap(const_cast<uint8_t*>(log_data), log_size);
+    }
+    log_data = nullptr;
+    log_size = 0;
+    mapped = false;
+    block_size = 0;
+    valid_bytes = 0;
+    block_offsets.clear();
+    for (size_t t = 0; t < 256; t++) {
+        frame_counter[t] = 0;
+    }
+}
+
+// implement is_open()
+/**
+ * @brief  Check if a log is open.
+ * @return true if open() was successful and close() was not called yet.
+ */
+bool ByteMessageLogReader::is_open(void) const {
+    return log_data != nullptr;
+}
+
+/**
+ * @brief  Get the number of intact blocks.
+ * @return Number of blocks.
+ */
+size_t ByteMessageLogReader::blocks(void) const {
+    return block_offsets.size();
+}
+
+/**
+ * @brief  Get the number of frames in all intact blocks.
+ * @return Number of frames.
+ */
+uint64_t ByteMessageLogReader::frames(void) const {
+    uint64_t n = 0;
+    for (size_t t = 0; t < 256; t++) {
+        n += frame_counter[t];
+    }
+    return n;
+}
+
+/**
+ * @brief  Get the number of frames of one type in all intact blocks.
+ * @param  type
+ *         The type of the frames.
+ * @return Number of frames.
+ */
+uint64_t ByteMessageLogReader::frames(uint8_t type) const {
+    return frame_counter[type];
+}
+
+/**
+ * @brief  Get the number of frames per block given to the writer which created the log.
+ * @return Number of frames. Blocks may hold fewer frames (see ByteMessageLogWriter::flush()).
+ */
+size_t ByteMessageLogReader::frames_per_block(void) const {
+    return block_size;
+}
+
+/**
+ * @brief  Get the number of bytes up to the end of the last intact block.
+ * @return Number of bytes. Smaller than size() if the log ends with a damaged block.
+ */
+size_t ByteMessageLogReader::valid_size(void) const {
+    return valid_bytes;
+}
+
+/**
+ * @brief  Get the size of the whole log.
+ * @return Number of bytes.
+ */
+size_t ByteMessageLogReader::size(void) const {
+    return log_size;
+}
+
+/**
+ * @brief  Get a pointer to the whole log.
+ * @return Pointer to the first byte of the file header, nullptr if no log is open.
+ */
+const uint8_t* ByteMessageLogReader::get_ptr(void) const {
+    return log_data;
+}
+
+// implement load()
+// Checks everything for_each() relies on, so it does not need any checks itself.
+bool ByteMessageLogReader::load(void) {
+    if (log_size < bm_log_header_size) return false;
+    if (ByteMessageFieldCodec<uint32_t>::decode(log_data) != bm_log_magic) return false;
+    if (ByteMessageFieldCodec<uint16_t>::decode(log_data + 4) != bm_log_version) return false;
+    const size_t header_size = ByteMessageFieldCodec<uint16_t>::decode(log_data + 6);
+    if (header_size < bm_log_header_size || header_size > log_size) return false;
+    block_size = ByteMessageFieldCodec<uint32_t>::decode(log_data + 8);
+
+    size_t pos = header_size;
+    while (log_size - pos >= bm_log_block_header_size) {
+        const uint8_t * block = log_data + pos;
+        if (ByteMessageFieldCodec<uint32_t>::decode(block) != bm_log_block_magic) break;
+        const uint32_t count      = ByteMessageFieldCodec<uint32_t>::decode(block + 4);
+        const size_t   index_size = ByteMessageFieldCodec<uint32_t>::decode(block + 8);
+        const size_t   data_size  = ByteMessageFieldCodec<uint32_t>::decode(block + 12);
+        const size_t   available  = log_size - pos - bm_log_block_header_size;
+        if (index_size < 4 || index_size > available || data_size > available - index_size) break;
+        const uint8_t * index = block + bm_log_block_header_size;
+        if (crc32_checksum(index, index_size) != ByteMessageFieldCodec<uint32_t>::decode(block + 16)) break;
+        const uint32_t groups = ByteMessageFieldCodec<uint32_t>::decode(index);
+        if (groups > (index_size - 4) / bm_log_group_size || 
+            index_size != 4 + groups * bm_log_group_size + 4 * static_cast<size_t>(count)) break;
+
+        // check groups and offsets
+        uint64_t block_counter[256] = {0};
+        uint64_t total = 0;
+        bool ok = true;
+        const uint8_t * group   = index + 4;
+        const uint8_t * offsets = group + groups * bm_log_group_size;
+        for (uint32_t g = 0; ok && g < groups; g++, group += bm_log_group_size) {
+            const size_t   frame_size = ByteMessageFieldCodec<uint32_t>::decode(group + 4);
+            const uint32_t n          = ByteMessageFieldCodec<uint32_t>::decode(group + 8);
+            total += n;
+            if (frame_size == 0 || frame_size > data_size || total > count) {
+                ok = false;
+                break;
+            }
+            for (uint32_t i = 0; i < n; i++, offsets += 4) {
+                if (ByteMessageFieldCodec<uint32_t>::decode(offsets) > data_size - frame_size) {
+                    ok = false;
+                    break;
+                }
+            }
+            block_counter[group[0]] += n;
+        }
+        if (!ok || total != count) break;
+
+        block_offsets.push_back(pos);
+        for (size_t t = 0; t < 256; t++) {
+            frame_counter[t] += block_counter[t];
+        }
+        pos += bm_log_block_header_size + index_size + data_size;
+    }
+    valid_bytes = pos;
+    return true;
+}
+
+#endif
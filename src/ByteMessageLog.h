@@ -0,0 +1,197 @@
+/**
+ * @file    ByteMessageLog.h
+ * @brief   Header file for the ByteMessageLogWriter and ByteMessageLogReader classes
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageLog_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ByteMessageLog_h
+#define ByteMessageLog_h
+
+#if defined(ARDUINO) && !defined(BM_HOST)
+    #error "ByteMessageLog is host-only. Define BM_HOST to use it on a board with POSIX file and mmap() support."
+#endif
+
+#include <stdint.h> // needed for fixed-size data types
+#include <stddef.h> // needed for size_t data type
+#include <stdio.h>  // needed for FILE (host only)
+
+#include <vector>   // needed for std::vector (host only)
+
+#include "ByteMessageView.h" // used internally
+
+/* Note: This header file also includes the implementation of the template member functions from ByteMessageLog.hpp! */
+
+/* 
+ * Important points:
+ * - Host only: the writer uses stdio, the reader maps the file into 
+ *   memory with mmap() (POSIX).
+ * - A log file is a file header followed by blocks. Each block holds up
+ *   to frames_per_block frames, preceded by a block header and an index:
+ *
+ *     file header (16 bytes):  "BMLG", version (2), header size (2), frames per block (4), reserved (4)
+ *     block header (20 bytes): "BMBK", frame count (4), index size (4), data size (4), CRC-32 of index (4)
+ *     index:                   group count (4), 
+ *                              per group: type (1), reserved (3), frame size (4), frame count (4),
+ *                              per frame: offset within data (4), grouped like the groups
+ *     data:                    the raw frames, concatenated in the order of appending
+ *
+ *   All numbers are stored in network byte order. A group holds all frames
+ *   of the block with the same type and size, in ascending order.
+ * - The writer collects the frames of one block in memory and appends
+ *   the complete block to the file. Frames which are not written yet are
+ *   lost if the program crashes, call flush() to write them early.
+ * - If a block cannot be written completely (e.g. disk full), the writer
+ *   rejects all further frames until the log is opened again.
+ * - The reader maps the file and walks the block headers only. Frames of
+ *   one type are found through the indices of the blocks, without looking
+ *   at any other frame. Frames are handed out as pointers into the
+ *   mapping or as ByteMessageView, nothing is copied.
+ * - A truncated or damaged block ends the log: the reader ignores it and
+ *   everything behind it. The writer cuts it off before appending.
+ */
+
+/**
+ * @class   ByteMessageLogWriter
+ * @brief   Appends raw frames to a log file in blocks with a per-type index.
+ * @details Usage:
+ * 
+ *              ByteMessageLogWriter writer;
+ *              writer.open("sensors.bmlog");
+ *              writer.append(msg.get_ptr(), msg.size);
+ *              writer.close();
+ */
+class ByteMessageLogWriter final {
+    public:
+        explicit ByteMessageLogWriter(size_t frames_per_block = 1024); // create closed writer
+        ~ByteMessageLogWriter(void);                                   // close file
+
+        // no copies
+        ByteMessageLogWriter(const ByteMessageLogWriter &) = delete;
+        ByteMessageLogWriter& operator= (const ByteMessageLogWriter &) = delete;
+
+        // create a new log or append to an existing one
+        bool open(const char * path);
+
+        // write pending frames and close file
+        bool close(void);
+
+        // check if a file is open
+        bool is_open(void) const;
+
+        // append a raw frame, the first byte is the type
+        bool append(const uint8_t * frame, size_t frame_size);
+
+        // append a message object
+        template <class MSG> bool append(const MSG &msg);
+
+        // write pending frames as a (short) block
+        bool flush(void);
+
+        // number of frames not yet written to the file
+        size_t pending(void) const;
+
+    private:
+        /** @cond log_internals */
+        struct Frame {
+            uint8_t type;
+            uint32_t size;
+            uint32_t offset;
+        };
+        FILE * file;
+        bool failed;                  // a block was not written completely, see flush()
+        size_t block_frames;
+        std::vector<uint8_t> data;    // frames of the current block
+        std::vector<Frame> frames;    // type, size and offset of each frame in data
+        std::vector<uint8_t> index;   // index of the current block, built on flush()
+        /** @endcond */
+};
+
+/**
+ * @class   ByteMessageLogReader
+ * @brief   Read-only, memory-mapped access to a log file written by ByteMessageLogWriter.
+ * @details Usage:
+ * 
+ *              ByteMessageLogReader reader;
+ *              reader.open("sensors.bmlog");
+ *              reader.for_each_view<SensorData>([](ByteMessageView<const SensorData> v) { ... });
+ */
+class ByteMessageLogReader final {
+    public:
+        ByteMessageLogReader(void);                      // create closed reader
+        ~ByteMessageLogReader(void);                     // unmap file
+
+        // no copies
+        ByteMessageLogReader(const ByteMessageLogReader &) = delete;
+        ByteMessageLogReader& operator= (const ByteMessageLogReader &) = delete;
+
+        // map a log file
+        bool open(const char * path);
+
+        // use a log which is already in memory, it must outlive the reader
+        bool open(const uint8_t * log, size_t log_size);
+
+        // unmap file
+        void close(void);
+
+        // check if a log is open
+        bool is_open(void) const;
+
+        size_t blocks(void) const;                       // number of intact blocks
+        uint64_t frames(void) const;                     // number of frames in intact blocks
+        uint64_t frames(uint8_t type) const;             // number of frames of one type
+        size_t frames_per_block(void) const;             // from the file header
+        size_t valid_size(void) const;                   // bytes up to the end of the last intact block
+        size_t size(void) const;                         // size of the whole log in bytes
+        const uint8_t* get_ptr(void) const;              // pointer to the whole log
+
+        // call handler(frame, frame_size) for all frames of type, return number of frames
+        template <class HANDLER> uint64_t for_each(uint8_t type, HANDLER &&handler) const;
+
+        // call handler(view) for all frames of MSG, return number of frames
+        template <class MSG, class HANDLER> uint64_t for_each_view(HANDLER &&handler) const;
+
+    private:
+        /** @cond log_internals */
+        // check file header and all blocks, fill block_offsets and counters
+        bool load(void);
+
+        const uint8_t * log_data;
+        size_t log_size;
+        bool mapped;                          // log_data was mapped by open(path)
+        size_t block_size;
+        size_t valid_bytes;
+        std::vector<size_t> block_offsets;    // offset of each intact block
+        uint64_t frame_counter[256];
+        /** @endcond */
+};
+
+// include implementation of template member functions
+#include "ByteMessageLog.hpp"
+
+#endif
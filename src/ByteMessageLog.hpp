@@ -0,0 +1,116 @@
+/**
+ * @file    ByteMessageLog.hpp
+ * @brief   Implementation file for the template member functions of ByteMessageLogReader
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageLog_hpp License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ByteMessageField.h" // needed for ByteMessageFieldCodec
+
+/** @cond log_internals */
+
+/* constants of the file format */
+constexpr uint32_t bm_log_magic             = 0x424D4C47;  // "BMLG"
+constexpr uint32_t bm_log_block_magic       = 0x424D424B;  // "BMBK"
+constexpr uint16_t bm_log_version           = 1;
+constexpr size_t   bm_log_header_size       = 16;
+constexpr size_t   bm_log_block_header_size = 20;
+constexpr size_t   bm_log_group_size        = 12;
+
+/** @endcond */
+
+// implement append() for message objects
+/**
+ * @brief  Append a message object to the log.
+ * @param  msg
+ *         A message object, e.g. derived from ByteMessage.
+ * @return true on success, false if the log is not open or writing failed.
+ */
+template <class MSG>
+bool ByteMessageLogWriter::append(const MSG &msg) {
+    return append(msg.get_ptr(), MSG::size);
+}
+
+// implement for_each()
+/**
+ * @brief  Call a handler for all frames of one type.
+ * @param  type
+ *         The type of the frames.
+ * @param  handler
+ *         A callable object, called as handler(const uint8_t * frame, size_t frame_size)
+ *         for each frame. frame points into the log.
+ * @return Number of frames handed to handler.
+ * @note   Frames of one block are visited in the order they were appended,
+ *         blocks in the order of the file. Only the index of each block 
+ *         is read, not the frames of other types.
+ */
+template <class HANDLER>
+uint64_t ByteMessageLogReader::for_each(uint8_t type, HANDLER &&handler) const {
+    uint64_t n = 0;
+    for (size_t b : block_offsets) {
+        const uint8_t * block = log_data + b;
+        const uint8_t * index = block + bm_log_block_header_size;
+        const uint8_t * data  = index + ByteMessageFieldCodec<uint32_t>::decode(block + 8);
+        const uint32_t groups = ByteMessageFieldCodec<uint32_t>::decode(index);
+        const uint8_t * group   = index + 4;
+        const uint8_t * offsets = group + groups * bm_log_group_size;
+        for (uint32_t g = 0; g < groups; g++, group += bm_log_group_size) {
+            const uint32_t count = ByteMessageFieldCodec<uint32_t>::decode(group + 8);
+            if (group[0] == type) {
+                const size_t frame_size = ByteMessageFieldCodec<uint32_t>::decode(group + 4);
+                for (uint32_t i = 0; i < count; i++) {
+                    handler(data + ByteMessageFieldCodec<uint32_t>::decode(offsets + 4*i), frame_size);
+                }
+                n += count;
+            }
+            offsets += 4 * static_cast<size_t>(count);
+        }
+    }
+    return n;
+}
+
+// implement for_each_view()
+/**
+ * @brief  Call a handler with a read-only view of all frames of one message class.
+ * @param  handler
+ *         A callable object, called as handler(ByteMessageView<const MSG> view)
+ *         for each frame with type MSG::type and size MSG::size.
+ * @return Number of frames handed to handler.
+ * @note   See for_each(). Checksums are not verified.
+ */
+template <class MSG, class HANDLER>
+uint64_t ByteMessageLogReader::for_each_view(HANDLER &&handler) const {
+    uint64_t n = 0;
+    for_each(MSG::type, [&handler, &n](const uint8_t * frame, size_t frame_size) {
+        if (frame_size == MSG::size) {
+            handler(ByteMessageView<const MSG>{frame, MSG::size});
+            ++n;
+        }
+    });
+    return n;
+}
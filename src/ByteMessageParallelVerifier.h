@@ -0,0 +1,147 @@
+/**
+ * @file    ByteMessageParallelVerifier.h
+ * @brief   Header file for the ByteMessageParallelVerifier class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageParallelVerifier_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ByteMessageParallelVerifier_h
+#define ByteMessageParallelVerifier_h
+
+#if defined(ARDUINO) && !defined(BM_HOST)
+    #error "ByteMessageParallelVerifier is host-only. Define BM_HOST to use it on a board with std::thread support."
+#endif
+
+#include <stdint.h> // needed for fixed-size data types
+#include <stddef.h> // needed for size_t data type
+
+#include <thread>    // needed for std::thread (host only)
+#include <vector>    // needed for std::vector (host only)
+
+#include "ByteMessageDispatcher.h"      // used internally
+#include "ByteMessageCriticalSection.h" // used internally
+
+/* Note: This header file also includes the complete implementation from ByteMessageParallelVerifier.hpp! */
+
+/* 
+ * Important points:
+ * - Host only: uses std::thread and std::vector, which are not available
+ *   on most Arduino platforms.
+ * - Verifies the checksums of all frames in a large buffer of 
+ *   concatenated frames, e.g. a recorded log mapped into memory with 
+ *   mmap(). Frame sizes come from the type/size registry of DISPATCHER.
+ * - The buffer is split into chunks of about chunk_size bytes. Chunk 
+ *   borders are frame borders, found by walking the type bytes once. 
+ *   This costs one table lookup per frame and touches only the type 
+ *   bytes, which is much cheaper than checksumming the frames.
+ * - The chunks are distributed over the worker threads. Each worker 
+ *   owns a range of chunks and takes chunks from its front. A worker
+ *   without chunks steals half of the remaining range of another worker
+ *   from its back, so all workers stay busy until the very end.
+ * - Frames are walked exactly like ByteMessageScanner does: a byte with
+ *   an unknown type is skipped, a frame with a wrong checksum is 
+ *   counted and skipped as a whole, an incomplete frame at the end of the
+ *   buffer is not counted.
+ * - Results: number of frames and checksum errors per type, number of
+ *   skipped bytes and the offsets of all bad frames in ascending order.
+ */
+
+/**
+ * @class   ByteMessageParallelVerifier
+ * @brief   Multi-threaded checksum verification of a buffer of concatenated frames.
+ * @details DISPATCHER must be a ByteMessageDispatcher. Usage:
+ * 
+ *              using MyDispatcher = ByteMessageDispatcher<Point3D, TankControl, SensorData>;
+ *              ByteMessageParallelVerifier<MyDispatcher> verifier;
+ *              size_t bad = verifier.verify(log, log_length);
+ *              uint64_t points = verifier.frames(Point3D::type);
+ */
+template <class DISPATCHER>
+class ByteMessageParallelVerifier {
+
+    public:
+        // constructor, 0 threads means one thread per hardware thread
+        explicit ByteMessageParallelVerifier(unsigned int threads = 0, size_t chunk_size = 1024*1024);
+
+        // verify all frames in buffer, return number of frames with wrong checksum
+        size_t verify(const uint8_t * buffer, size_t length);
+
+        unsigned int threads(void) const;                        // number of worker threads
+        uint64_t frames(uint8_t type) const;                     // number of frames of type found by last call to verify()
+        uint64_t frames(void) const;                             // number of frames of all types
+        uint64_t checksum_errors(uint8_t type) const;            // number of frames of type with wrong checksum
+        uint64_t checksum_errors(void) const;                    // number of frames of all types with wrong checksum
+        uint64_t discarded(void) const;                          // number of bytes with unknown type
+        size_t consumed(void) const;                             // number of bytes up to the end of the last complete frame
+        const std::vector<size_t>& bad_offsets(void) const;      // offsets of frames with wrong checksum, ascending
+
+    private:
+        /** @cond parallel_verifier_internals */
+        // range of chunk indices owned by one worker, protected by a spin lock
+        struct alignas(64) WorkRange {
+            size_t first;
+            size_t last;    // one behind the last chunk
+            bool lock;
+        };
+
+        // results of one worker
+        struct WorkResult {
+            uint64_t frames[256] = {};
+            uint64_t checksum_errors[256] = {};
+            uint64_t discarded = 0;
+            std::vector<size_t> bad_offsets;
+        };
+
+        // find chunk borders, return offset behind the last complete frame
+        size_t split(const uint8_t * buffer, size_t length);
+
+        // verify all frames of one chunk
+        void verify_chunk(const uint8_t * buffer, size_t chunk, WorkResult &result) const;
+
+        // take the next chunk of worker w, steal from other workers if there is none
+        bool next_chunk(size_t w, size_t &chunk);
+
+        // work loop of worker w
+        void work(const uint8_t * buffer, size_t w, WorkResult &result);
+
+        unsigned int thread_count;
+        size_t chunk_bytes;
+        std::vector<size_t> chunk_starts;  // one more entry than chunks: the end of the last chunk
+        std::vector<WorkRange> ranges;
+        std::vector<size_t> bad;
+        uint64_t frame_counter[256];
+        uint64_t checksum_error_counter[256];
+        uint64_t discard_counter;
+        size_t consumed_bytes;
+        /** @endcond */
+};
+
+// include implementation file
+#include "ByteMessageParallelVerifier.hpp"
+
+#endif
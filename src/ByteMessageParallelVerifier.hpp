@@ -0,0 +1,285 @@
+/**
+ * @file    ByteMessageParallelVerifier.hpp
+ * @brief   Implementation file for the ByteMessageParallelVerifier class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageParallelVerifier_hpp License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <algorithm> // needed for std::sort() (host only)
+
+// implement constructor
+/**
+ * @brief  The constructor.
+ * @param  threads
+ *         Number of worker threads, including the thread calling verify().
+ *         0 means one worker per hardware thread.
+ * @param  chunk_size
+ *         Approximate number of bytes per chunk. Smaller chunks balance 
+ *         better, larger chunks have less overhead.
+ */
+template <class DISPATCHER>
+ByteMessageParallelVerifier<DISPATCHER>::ByteMessageParallelVerifier(unsigned int threads, size_t chunk_size)
+    : thread_count{threads}, chunk_bytes{(chunk_size > 0) ? chunk_size : 1}, 
+      frame_counter{}, checksum_error_counter{}, discard_counter{0}, consumed_bytes{0} {
+    if (thread_count == 0) {
+        thread_count = std::thread::hardware_concurrency();
+    }
+    if (thread_count == 0) {
+        thread_count = 1;
+    }
+}
+
+// implement verify()
+/**
+ * @brief  Verify the checksums of all frames in a buffer.
+ * @param  buffer
+ *         Pointer to the concatenated frames, e.g. a memory-mapped log file.
+ * @param  length
+ *         Number of bytes in buffer.
+ * @return Number of frames with a wrong checksum.
+ * @note   The results of the previous call are overwritten.
+ */
+template <class DISPATCHER>
+size_t ByteMessageParallelVerifier<DISPATCHER>::verify(const uint8_t * buffer, size_t length) {
+    consumed_bytes = split(buffer, length);
+
+    // distribute chunks evenly over the workers
+    const size_t chunks = chunk_starts.size() - 1;
+    ranges.assign(thread_count, WorkRange{0, 0, false});
+    for (size_t w = 0; w < thread_count; w++) {
+        ranges[w].first = chunks * w / thread_count;
+        ranges[w].last  = chunks * (w+1) / thread_count;
+    }
+
+    // the calling thread is worker 0
+    std::vector<WorkResult> results(thread_count);
+    std::vector<std::thread> workers;
+    workers.reserve(thread_count - 1);
+    for (size_t w = 1; w < thread_count; w++) {
+        workers.emplace_back([this, buffer, w, &results] { work(buffer, w, results[w]); });
+    }
+    work(buffer, 0, results[0]);
+    for (std::thread &t : workers) {
+        t.join();
+    }
+
+    // merge results
+    discard_counter = 0;
+    bad.clear();
+    for (size_t t = 0; t < 256; t++) {
+        frame_counter[t] = 0;
+        checksum_error_counter[t] = 0;
+    }
+    for (const WorkResult &r : results) {
+        for (size_t t = 0; t < 256; t++) {
+            frame_counter[t] += r.frames[t];
+            checksum_error_counter[t] += r.checksum_errors[t];
+        }
+        discard_counter += r.discarded;
+        bad.insert(bad.end(), r.bad_offsets.begin(), r.bad_offsets.end());
+    }
+    std::sort(bad.begin(), bad.end());
+    return bad.size();
+}
+
+/**
+ * @brief  Get the number of worker threads.
+ * @return Number of threads, including the thread calling verify().
+ */
+template <class DISPATCHER>
+unsigned int ByteMessageParallelVerifier<DISPATCHER>::threads(void) const {
+    return thread_count;
+}
+
+/**
+ * @brief  Get the number of frames of one type found by the last call to verify().
+ * @param  type
+ *         The message type.
+ * @return Number of frames, including frames with wrong checksum.
+ */
+template <class DISPATCHER>
+uint64_t ByteMessageParallelVerifier<DISPATCHER>::frames(uint8_t type) const {
+    return frame_counter[type];
+}
+
+/**
+ * @brief  Get the number of frames of all types found by the last call to verify().
+ * @return Number of frames, including frames with wrong checksum.
+ */
+template <class DISPATCHER>
+uint64_t ByteMessageParallelVerifier<DISPATCHER>::frames(void) const {
+    uint64_t n = 0;
+    for (size_t t = 0; t < 256; t++) {
+        n += frame_counter[t];
+    }
+    return n;
+}
+
+/**
+ * @brief  Get the number of frames of one type with a wrong checksum.
+ * @param  type
+ *         The message type.
+ * @return Number of frames.
+ */
+template <class DISPATCHER>
+uint64_t ByteMessageParallelVerifier<DISPATCHER>::checksum_errors(uint8_t type) const {
+    return checksum_error_counter[type];
+}
+
+/**
+ * @brief  Get the number of frames of all types with a wrong checksum.
+ * @return Number of frames.
+ */
+template <class DISPATCHER>
+uint64_t ByteMessageParallelVerifier<DISPATCHER>::checksum_errors(void) const {
+    return bad.size();
+}
+
+/**
+ * @brief  Get the number of bytes skipped because of an unknown type.
+ * @return Number of bytes.
+ */
+template <class DISPATCHER>
+uint64_t ByteMessageParallelVerifier<DISPATCHER>::discarded(void) const {
+    return discard_counter;
+}
+
+/**
+ * @brief  Get the number of bytes up to the end of the last complete frame.
+ * @return Number of bytes. The remaining bytes of the buffer start an 
+ *         incomplete frame.
+ */
+template <class DISPATCHER>
+size_t ByteMessageParallelVerifier<DISPATCHER>::consumed(void) const {
+    return consumed_bytes;
+}
+
+/**
+ * @brief  Get the offsets of all frames with a wrong checksum.
+ * @return Offsets of the type bytes of the bad frames, in ascending order.
+ */
+template <class DISPATCHER>
+const std::vector<size_t>& ByteMessageParallelVerifier<DISPATCHER>::bad_offsets(void) const {
+    return bad;
+}
+
+/** @cond parallel_verifier_internals */
+
+// implement split()
+// Walks the type bytes once. A new chunk starts at the first frame 
+// behind chunk_bytes bytes of the previous chunk.
+template <class DISPATCHER>
+size_t ByteMessageParallelVerifier<DISPATCHER>::split(const uint8_t * buffer, size_t length) {
+    chunk_starts.clear();
+    chunk_starts.push_back(0);
+    size_t next_cut = chunk_bytes;
+    size_t pos = 0;
+    while (pos < length) {
+        const size_t frame_size = DISPATCHER::size_of(buffer[pos]);
+        if (frame_size == 0) {
+            ++pos;
+            continue;
+        }
+        if (frame_size > length - pos) break; // incomplete frame
+        if (pos >= next_cut) {
+            chunk_starts.push_back(pos);
+            next_cut = pos + chunk_bytes;
+        }
+        pos += frame_size;
+    }
+    chunk_starts.push_back(pos);
+    return pos;
+}
+
+// implement verify_chunk()
+// Chunks start and end at frame borders, so the walk is the same as in split().
+template <class DISPATCHER>
+void ByteMessageParallelVerifier<DISPATCHER>::verify_chunk(const uint8_t * buffer, size_t chunk, WorkResult &result) const {
+    size_t pos = chunk_starts[chunk];
+    const size_t end = chunk_starts[chunk+1];
+    while (pos < end) {
+        const uint8_t type = buffer[pos];
+        const size_t frame_size = DISPATCHER::size_of(type);
+        if (frame_size == 0) {
+            ++result.discarded;
+            ++pos;
+            continue;
+        }
+        ++result.frames[type];
+        if (DISPATCHER::verify(buffer + pos, frame_size) != ByteMessageDispatchResult::ok) {
+            ++result.checksum_errors[type];
+            result.bad_offsets.push_back(pos);
+        }
+        pos += frame_size;
+    }
+}
+
+// implement next_chunk()
+template <class DISPATCHER>
+bool ByteMessageParallelVerifier<DISPATCHER>::next_chunk(size_t w, size_t &chunk) {
+    {
+        ByteMessageCriticalSection cs{ranges[w].lock};
+        if (ranges[w].first < ranges[w].last) {
+            chunk = ranges[w].first++;
+            return true;
+        }
+    }
+    // own range is empty: steal the back half of another range
+    for (size_t i = 1; i < thread_count; i++) {
+        WorkRange &victim = ranges[(w + i) % thread_count];
+        size_t first;
+        size_t last;
+        {
+            ByteMessageCriticalSection cs{victim.lock};
+            const size_t available = victim.last - victim.first;
+            if (available == 0) continue;
+            last = victim.last;
+            first = last - (available + 1) / 2;
+            victim.last = first;
+        }
+        chunk = first;
+        if (last - first > 1) {
+            ByteMessageCriticalSection cs{ranges[w].lock};
+            ranges[w].first = first + 1;
+            ranges[w].last = last;
+        }
+        return true;
+    }
+    return false;
+}
+
+// implement work()
+template <class DISPATCHER>
+void ByteMessageParallelVerifier<DISPATCHER>::work(const uint8_t * buffer, size_t w, WorkResult &result) {
+    size_t chunk;
+    while (next_chunk(w, chunk)) {
+        verify_chunk(buffer, chunk, result);
+    }
+}
+
+/** @endcond */
@@ -0,0 +1,138 @@
+/**
+ * @file    ByteMessagePool.h
+ * @brief   Header file for the ByteMessagePool class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessagePool_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ByteMessagePool_h
+#define ByteMessagePool_h
+
+#include <stdint.h> // needed for fixed-size data types
+#include <stddef.h> // needed for size_t data type
+
+#include "ByteMessageTraits.h"          // used internally
+#include "ByteMessageCriticalSection.h" // used internally
+
+/* Note: This header file also includes the complete implementation from ByteMessagePool.hpp! */
+
+/* 
+ * Important points:
+ * - ByteMessagePool<MSG, N> holds storage for N messages of type MSG in a
+ *   static buffer inside the pool object. There is no heap allocation.
+ * - acquire() constructs a message in a free slot and returns a pointer
+ *   to it (or nullptr if all slots are in use). release() destroys the 
+ *   message and returns the slot to the pool. Both are O(1): free slots 
+ *   are kept in a singly linked list of slot indices.
+ * - acquire(bm_uninitialized) and acquire(raw_message, message_size) use 
+ *   the constructor for uninitialized messages if MSG has one (see 
+ *   ByteMessageTraits::make_for_populate()).
+ * - The free list is protected by a ByteMessageCriticalSection, so 
+ *   acquire() and release() can be called from interrupt service routines
+ *   and the main loop alike. Interrupts are blocked for a few instructions 
+ *   only; the message itself is constructed and populated outside of the
+ *   critical section. On Arduino boards other than AVR, ARM Cortex-M,
+ *   ESP32, ESP8266 and RISC-V, the previous interrupt state cannot be 
+ *   restored: a call from an ISR enables interrupts before the ISR 
+ *   returns. On hosts, a spin lock protects against other threads 
+ *   (never call the pool from a signal handler there).
+ * - release() rejects pointers which do not belong to the pool and 
+ *   messages which were already released.
+ * - The pool does not destroy messages which are still in use when the 
+ *   pool itself is destroyed.
+ */
+
+/** @cond pool_internals */
+// smallest type for slot indices, including two marker values
+template <bool SMALL> struct ByteMessagePoolIndex       { using type = size_t;  };
+template <>           struct ByteMessagePoolIndex<true> { using type = uint8_t; };
+/** @endcond */
+
+/**
+ * @class   ByteMessagePool
+ * @brief   Fixed-capacity pool of N messages of type MSG.
+ * @details Usage:
+ * 
+ *              ByteMessagePool<Point3DCompact, 8> pool;
+ *              Point3DCompact * p = pool.acquire(rx_buffer, rx_length);
+ *              if (p) { ...; pool.release(p); }
+ */
+template <class MSG, size_t N>
+class ByteMessagePool {
+
+    static_assert(N > 0, "a pool needs at least one slot");
+
+    public:
+        static constexpr size_t capacity = N;                // number of slots
+
+        ByteMessagePool(void);                               // create pool with all slots free
+        ByteMessagePool(const ByteMessagePool &) = delete;   // pools cannot be copied
+        ByteMessagePool& operator= (const ByteMessagePool &) = delete;
+        ~ByteMessagePool() = default;
+
+        // get default-constructed message, nullptr if pool is exhausted
+        MSG * acquire(void);
+
+        // get uninitialized message, nullptr if pool is exhausted
+        MSG * acquire(ByteMessageUninitialized);
+
+        // get message populated from raw data, nullptr if pool is exhausted or populate() fails
+        MSG * acquire(const uint8_t * raw_message, size_t message_size);
+
+        // destroy message and return it to the pool
+        bool release(MSG * msg);
+
+        // number of free slots
+        size_t available(void) const;
+
+        // check if message belongs to the pool
+        bool owns(const MSG * msg) const;
+
+    private:
+        using index_type = typename ByteMessagePoolIndex<(N + 1 < 0xFF)>::type;
+        static constexpr index_type end = N;                 // marks end of free list
+        static constexpr index_type in_use = N + 1;          // marks slot in use
+
+        alignas(MSG) uint8_t storage[N * sizeof(MSG)];       // the slots
+        index_type next[N];                                  // next free slot, or in_use
+        index_type head;                                     // first free slot, or end
+        index_type free_count;                               // number of free slots
+        mutable bool lock_flag;                              // for ByteMessageCriticalSection
+
+        // take slot from free list, return its index or end
+        index_type take(void);
+        // return pointer to slot
+        void * slot(index_type index);
+        // find index of message in pool, end if it does not belong to it
+        index_type index_of(const MSG * msg) const;
+};
+
+// include implementation file
+#include "ByteMessagePool.hpp"
+
+#endif
@@ -0,0 +1,187 @@
+/**
+ * @file    ByteMessagePool.hpp
+ * @brief   Implementation file for the ByteMessagePool class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessagePool_hpp License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#if defined(__AVR__)
+    #include <new.h>  // needed for placement new
+#else
+    #include <new>    // needed for placement new
+#endif
+
+// implement constructor
+/**
+ * @brief  Create a pool with all slots free.
+ * @note   No message is constructed yet.
+ */
+template <class MSG, size_t N>
+ByteMessagePool<MSG, N>::ByteMessagePool(void)
+    : head{0}, free_count{N}, lock_flag{false} {
+    for (size_t i = 0; i < N; i++) {
+        next[i] = static_cast<index_type>(i + 1); // last slot points to end
+    }
+}
+
+// implement acquire()
+/**
+ * @brief  Get a default-constructed message from the pool.
+ * @return Pointer to the message, or nullptr if all slots are in use.
+ */
+template <class MSG, size_t N>
+MSG * ByteMessagePool<MSG, N>::acquire(void) {
+    const index_type i = take();
+    if (i == end) {
+        return nullptr;
+    }
+    return new (slot(i)) MSG();
+}
+
+// implement acquire() for uninitialized messages
+/**
+ * @brief  Get a message without initialized contents from the pool.
+ * @return Pointer to the message, or nullptr if all slots are in use.
+ * @note   Only the type byte is set if MSG has a constructor taking 
+ *         bm_uninitialized. Otherwise, the message is default-constructed.
+ */
+template <class MSG, size_t N>
+MSG * ByteMessagePool<MSG, N>::acquire(ByteMessageUninitialized) {
+    const index_type i = take();
+    if (i == end) {
+        return nullptr;
+    }
+    return new (slot(i)) MSG(ByteMessageTraits<MSG>::make_for_populate());
+}
+
+// implement acquire() for received messages
+/**
+ * @brief  Get a message from the pool and populate it.
+ * @param  raw_message
+ *         A pointer to a uint8_t array to copy the data from.
+ * @param  message_size
+ *         The number of bytes to copy from raw_message.
+ * @return Pointer to the message, or nullptr if all slots are in use or
+ *         if populate() fails (i.e. type or size do not match). In the 
+ *         latter case, the slot is returned to the pool immediately.
+ * @note   The checksum is not verified.
+ */
+template <class MSG, size_t N>
+MSG * ByteMessagePool<MSG, N>::acquire(const uint8_t * raw_message, size_t message_size) {
+    MSG * msg = acquire(bm_uninitialized);
+    if (msg != nullptr && !msg->populate(raw_message, message_size)) {
+        release(msg);
+        return nullptr;
+    }
+    return msg;
+}
+
+// implement release()
+/**
+ * @brief  Destroy a message and return its slot to the pool.
+ * @param  msg
+ *         Pointer to a message returned by acquire().
+ * @return true if the message was released, false if it does not belong
+ *         to the pool or was already released. Nothing is changed in the
+ *         latter cases.
+ */
+template <class MSG, size_t N>
+bool ByteMessagePool<MSG, N>::release(MSG * msg) {
+    const index_type i = index_of(msg);
+    if (i == end) {
+        return false;
+    }
+    {
+        ByteMessageCriticalSection guard{lock_flag};
+        if (next[i] != in_use) {
+            return false;
+        }
+        next[i] = end; // not free, but not in use anymore: a second release() fails
+    }
+    msg->~MSG();
+    ByteMessageCriticalSection guard{lock_flag};
+    next[i] = head;
+    head = i;
+    free_count++;
+    return true;
+}
+
+// implement available()
+/**
+ * @brief  Get the number of free slots.
+ * @return The number of messages which can be acquired.
+ */
+template <class MSG, size_t N>
+size_t ByteMessagePool<MSG, N>::available(void) const {
+    ByteMessageCriticalSection guard{lock_flag};
+    return free_count;
+}
+
+// implement owns()
+/**
+ * @brief  Check if a message belongs to the pool.
+ * @param  msg
+ *         Pointer to a message.
+ * @return true if msg points to a slot of the pool (in use or not).
+ */
+template <class MSG, size_t N>
+bool ByteMessagePool<MSG, N>::owns(const MSG * msg) const {
+    return index_of(msg) != end;
+}
+
+/** @cond pool_internals */
+// take first slot from free list and mark it as used
+template <class MSG, size_t N>
+typename ByteMessagePool<MSG, N>::index_type ByteMessagePool<MSG, N>::take(void) {
+    ByteMessageCriticalSection guard{lock_flag};
+    const index_type i = head;
+    if (i != end) {
+        head = next[i];
+        next[i] = in_use;
+        free_count--;
+    }
+    return i;
+}
+
+// pointer to memory of slot
+template <class MSG, size_t N>
+void * ByteMessagePool<MSG, N>::slot(index_type index) {
+    return storage + static_cast<size_t>(index) * sizeof(MSG);
+}
+
+// compare addresses as integers: comparing unrelated pointers is unspecified
+template <class MSG, size_t N>
+typename ByteMessagePool<MSG, N>::index_type ByteMessagePool<MSG, N>::index_of(const MSG * msg) const {
+    const uintptr_t first = reinterpret_cast<uintptr_t>(storage);
+    const uintptr_t addr  = reinterpret_cast<uintptr_t>(msg);
+    if (addr < first || addr >= first + sizeof(storage) || (addr - first) % sizeof(MSG) != 0) {
+        return end;
+    }
+    return static_cast<index_type>((addr - first) / sizeof(MSG));
+}
+/** @endcond */
@@ -0,0 +1,164 @@
+/**
+ * @file    ByteMessageRing.h
+ * @brief   Header file for the ByteMessageRing class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageRing_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ByteMessageRing_h
+#define ByteMessageRing_h
+
+#include <stdint.h> // needed for fixed-size data types
+#include <stddef.h> // needed for size_t data type
+
+#include "ByteMessageView.h" // used for zero-copy access to slots
+
+/* Note: This header file also includes the complete implementation from ByteMessageRing.hpp! */
+
+/* 
+ * Important points:
+ * - ByteMessageRing<FRAMESIZE, N> is a single-producer, single-consumer
+ *   queue of N frames with up to FRAMESIZE bytes each. Use MSG::size to 
+ *   queue messages of a single type, or ByteMessageDispatcher<...>::max_size
+ *   to queue raw frames of all types known to a dispatcher.
+ * - One side (e.g. an interrupt service routine) only calls the producer 
+ *   functions, the other side (e.g. the main loop) only calls the consumer 
+ *   functions. No locks are taken and interrupts are never blocked.
+ * - Head and tail are free-running counters. Each one is written by one 
+ *   side only. On AVR, they are single bytes accessed through volatile 
+ *   pointers with compiler barriers. Elsewhere, they are accessed with 
+ *   acquire/release atomics, so the ring also works between two cores.
+ * - N must be a power of two (at most 128 on AVR), so the slot index is a 
+ *   mask operation and wrap-around of the counters is harmless.
+ * - produce_begin()/produce_commit() and consume_begin()/consume_commit() 
+ *   give direct access to a slot. Nothing is copied. produce_view() and 
+ *   consume_view() do the same through a ByteMessageView.
+ * - A slot is not cleared before it is handed to the producer. Write all 
+ *   bytes of the frame.
+ * - If the ring is full, the frame is dropped and the overflow counter is 
+ *   incremented. Queued frames are never overwritten.
+ */
+
+/** @cond ring_internals */
+// smallest type for counters which can be read and written atomically
+template <bool SMALL> struct ByteMessageRingIndex       { using type = size_t;  };
+template <>           struct ByteMessageRingIndex<true> { using type = uint8_t; };
+/** @endcond */
+
+/**
+ * @class   ByteMessageRing
+ * @brief   Lock-free single-producer, single-consumer ring of N frames.
+ * @details Usage:
+ * 
+ *              ByteMessageRing<Point3DCompact::size, 8> ring;
+ *              // in ISR:
+ *              ring.push(rx_buffer, rx_length);
+ *              // in loop():
+ *              ByteMessageView<const Point3DCompact> v = ring.consume_view<Point3DCompact>();
+ *              if (v.valid()) { ...; ring.consume_commit(); }
+ */
+template <size_t FRAMESIZE, size_t N>
+class ByteMessageRing {
+
+    static_assert(FRAMESIZE > 0, "frames must hold at least one byte");
+    static_assert(N > 0 && (N & (N - 1)) == 0, "number of slots must be a power of two");
+#if defined(__AVR__)
+    static_assert(N <= 128, "at most 128 slots on AVR (counters are single bytes)");
+#endif
+
+    public:
+        static constexpr size_t capacity   = N;                  // number of slots
+        static constexpr size_t frame_size = FRAMESIZE;          // maximum size of a frame
+
+        ByteMessageRing(void);                                   // create empty ring
+        ByteMessageRing(const ByteMessageRing &) = delete;       // rings cannot be copied
+        ByteMessageRing& operator= (const ByteMessageRing &) = delete;
+        ~ByteMessageRing() = default;
+
+        /* ---- producer side ---- */
+
+        // get free slot to write into, nullptr if ring is full
+        uint8_t * produce_begin(void);
+
+        // publish slot returned by produce_begin()
+        void produce_commit(size_t length);
+
+        // get view of free slot with type byte already set, detached view if ring is full
+        template <class MSG> ByteMessageView<MSG> produce_view(void);
+
+        // publish slot returned by produce_view()
+        template <class MSG> void produce_commit(const ByteMessageView<MSG> &view);
+
+        // copy frame into ring
+        bool push(const uint8_t * raw_message, size_t message_size);
+
+        // copy message into ring
+        template <class MSG> bool push(const MSG &msg);
+
+        /* ---- consumer side ---- */
+
+        // get oldest frame, nullptr if ring is empty
+        const uint8_t * consume_begin(size_t &length) const;
+
+        // get read-only view of oldest frame, detached view if ring is empty or frame is no MSG
+        template <class MSG> ByteMessageView<const MSG> consume_view(void) const;
+
+        // remove oldest frame
+        void consume_commit(void);
+
+        // copy oldest frame into buffer and remove it, return its size
+        size_t pop(uint8_t * buffer, size_t buffer_size);
+
+        /* ---- both sides ---- */
+
+        // number of queued frames
+        size_t count(void) const;
+
+        bool empty(void) const;
+        bool full(void) const;
+
+        // number of frames dropped because the ring was full
+        uint32_t overflows(void) const;
+
+    private:
+        using index_type = typename ByteMessageRingIndex<(N <= 128)>::type;
+
+        uint8_t frames[N][FRAMESIZE];                            // the slots
+        size_t lengths[N];                                       // size of the frame in each slot
+        index_type head;                                         // written by producer only
+        index_type tail;                                         // written by consumer only
+        uint32_t overflow_count;                                 // written by producer only
+
+        static index_type load_acquire(const index_type &counter);
+        static void store_release(index_type &counter, index_type value);
+};
+
+// include implementation file
+#include "ByteMessageRing.hpp"
+
+#endif
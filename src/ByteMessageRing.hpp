@@ -0,0 +1,321 @@
+/**
+ * @file    ByteMessageRing.hpp
+ * @brief   Implementation file for the ByteMessageRing class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageRing_hpp License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h> // needed for memcpy()
+
+// implement constructor
+/**
+ * @brief  Create an empty ring.
+ * @note   The slots are not cleared.
+ */
+template <size_t FRAMESIZE, size_t N>
+ByteMessageRing<FRAMESIZE, N>::ByteMessageRing(void)
+    : head{0}, tail{0}, overflow_count{0} {}
+
+/** @cond ring_internals */
+// implement load_acquire()
+// read counter written by the other side; later reads of the slots must not be moved before it
+template <size_t FRAMESIZE, size_t N>
+typename ByteMessageRing<FRAMESIZE, N>::index_type ByteMessageRing<FRAMESIZE, N>::load_acquire(const index_type &counter) {
+#if defined(__AVR__)
+    // single core, in-order execution: a volatile access plus a compiler barrier is enough
+    const index_type value = *static_cast<const volatile index_type *>(&counter);
+    __asm__ __volatile__ ("" ::: "memory");
+    return value;
+#else
+    return __atomic_load_n(&counter, __ATOMIC_ACQUIRE);
+#endif
+}
+
+// implement store_release()
+// write own counter; earlier writes to the slots must not be moved after it
+template <size_t FRAMESIZE, size_t N>
+void ByteMessageRing<FRAMESIZE, N>::store_release(index_type &counter, index_type value) {
+#if defined(__AVR__)
+    __asm__ __volatile__ ("" ::: "memory");
+    *static_cast<volatile index_type *>(&counter) = value;
+#else
+    __atomic_store_n(&counter, value, __ATOMIC_RELEASE);
+#endif
+}
+/** @endcond */
+
+// implement produce_begin()
+/**
+ * @brief  Get a free slot to write a frame into.
+ * @return Pointer to the FRAMESIZE bytes of the slot, or nullptr if the 
+ *         ring is full. In that case, the overflow counter is incremented.
+ * @note   Producer side only. The frame is not visible to the consumer 
+ *         before produce_commit() is called. Calling produce_begin() 
+ *         again without produce_commit() returns the same slot.
+ */
+template <size_t FRAMESIZE, size_t N>
+uint8_t * ByteMessageRing<FRAMESIZE, N>::produce_begin(void) {
+    const index_type h = head; // own counter, no synchronization needed
+    if (static_cast<index_type>(h - load_acquire(tail)) >= N) {
+#if defined(__AVR__)
+        *static_cast<volatile uint32_t *>(&overflow_count) = overflow_count + 1;
+#else
+        __atomic_store_n(&overflow_count, overflow_count + 1, __ATOMIC_RELAXED);
+#endif
+        return nullptr;
+    }
+    return frames[h & (N - 1)];
+}
+
+// implement produce_commit()
+/**
+ * @brief  Publish the slot returned by the last call of produce_begin().
+ * @param  length
+ *         The number of bytes written into the slot. Values larger than 
+ *         FRAMESIZE are clipped.
+ * @note   Producer side only. Must not be called if produce_begin() 
+ *         returned nullptr.
+ */
+template <size_t FRAMESIZE, size_t N>
+void ByteMessageRing<FRAMESIZE, N>::produce_commit(size_t length) {
+    const index_type h = head;
+    lengths[h & (N - 1)] = (length < FRAMESIZE) ? length : FRAMESIZE;
+    store_release(head, static_cast<index_type>(h + 1));
+}
+
+// implement produce_view()
+/**
+ * @brief  Get a view of a free slot to write a message of type MSG into.
+ * @return A view attached to the slot with the type byte already set, or 
+ *         a detached view if the ring is full. In that case, the overflow 
+ *         counter is incremented.
+ * @note   Producer side only. Set all fields and the checksum through the 
+ *         view, then call produce_commit(view).
+ */
+template <size_t FRAMESIZE, size_t N>
+template <class MSG>
+ByteMessageView<MSG> ByteMessageRing<FRAMESIZE, N>::produce_view(void) {
+    static_assert(MSG::size <= FRAMESIZE, "message does not fit into a slot");
+    uint8_t * slot = produce_begin();
+    if (slot == nullptr) {
+        return ByteMessageView<MSG>();
+    }
+    slot[0] = MSG::type;
+    return ByteMessageView<MSG>(slot, MSG::size);
+}
+
+// implement produce_commit() for views
+/**
+ * @brief  Publish the slot returned by the last call of produce_view().
+ * @param  view
+ *         The view returned by produce_view(). Nothing is published if it 
+ *         is detached.
+ * @note   Producer side only.
+ */
+template <size_t FRAMESIZE, size_t N>
+template <class MSG>
+void ByteMessageRing<FRAMESIZE, N>::produce_commit(const ByteMessageView<MSG> &view) {
+    if (view.valid()) {
+        produce_commit(MSG::size);
+    }
+}
+
+// implement push() for raw frames
+/**
+ * @brief  Copy a frame into the ring.
+ * @param  raw_message
+ *         A pointer to a uint8_t array holding the frame.
+ * @param  message_size
+ *         The number of bytes in raw_message.
+ * @return true if the frame was queued, false if it is larger than 
+ *         FRAMESIZE or the ring is full.
+ * @note   Producer side only. Only a full ring increments the overflow 
+ *         counter.
+ */
+template <size_t FRAMESIZE, size_t N>
+bool ByteMessageRing<FRAMESIZE, N>::push(const uint8_t * raw_message, size_t message_size) {
+    if (raw_message == nullptr || message_size > FRAMESIZE) {
+        return false;
+    }
+    uint8_t * slot = produce_begin();
+    if (slot == nullptr) {
+        return false;
+    }
+    memcpy(slot, raw_message, message_size);
+    produce_commit(message_size);
+    return true;
+}
+
+// implement push() for messages
+/**
+ * @brief  Copy a message into the ring.
+ * @param  msg
+ *         The message to queue.
+ * @return true if the message was queued, false if the ring is full.
+ * @note   Producer side only.
+ */
+template <size_t FRAMESIZE, size_t N>
+template <class MSG>
+bool ByteMessageRing<FRAMESIZE, N>::push(const MSG &msg) {
+    static_assert(MSG::size <= FRAMESIZE, "message does not fit into a slot");
+    return push(msg.get_ptr(), MSG::size);
+}
+
+// implement consume_begin()
+/**
+ * @brief  Get the oldest frame in the ring.
+ * @param  length
+ *         Receives the size of the frame. Set to 0 if the ring is empty.
+ * @return Pointer to the frame, or nullptr if the ring is empty.
+ * @note   Consumer side only. The frame stays in the ring (and the pointer
+ *         stays valid) until consume_commit() is called.
+ */
+template <size_t FRAMESIZE, size_t N>
+const uint8_t * ByteMessageRing<FRAMESIZE, N>::consume_begin(size_t &length) const {
+    const index_type t = tail; // own counter, no synchronization needed
+    if (load_acquire(head) == t) {
+        length = 0;
+        return nullptr;
+    }
+    length = lengths[t & (N - 1)];
+    return frames[t & (N - 1)];
+}
+
+// implement consume_view()
+/**
+ * @brief  Get a read-only view of the oldest frame in the ring.
+ * @return A view attached to the frame, or a detached view if the ring is 
+ *         empty or the frame is not a message of type MSG.
+ * @note   Consumer side only. A frame of another type is not removed. Use 
+ *         consume_begin() and a ByteMessageDispatcher to handle frames of 
+ *         several types.
+ */
+template <size_t FRAMESIZE, size_t N>
+template <class MSG>
+ByteMessageView<const MSG> ByteMessageRing<FRAMESIZE, N>::consume_view(void) const {
+    size_t length;
+    const uint8_t * frame = consume_begin(length);
+    if (frame == nullptr) {
+        return ByteMessageView<const MSG>();
+    }
+    return ByteMessageView<const MSG>(frame, length);
+}
+
+// implement consume_commit()
+/**
+ * @brief  Remove the oldest frame from the ring.
+ * @note   Consumer side only. Does nothing if the ring is empty.
+ */
+template <size_t FRAMESIZE, size_t N>
+void ByteMessageRing<FRAMESIZE, N>::consume_commit(void) {
+    const index_type t = tail;
+    if (load_acquire(head) != t) {
+        store_release(tail, static_cast<index_type>(t + 1));
+    }
+}
+
+// implement pop()
+/**
+ * @brief  Copy the oldest frame into a buffer and remove it from the ring.
+ * @param  buffer
+ *         A pointer to a uint8_t array receiving the frame.
+ * @param  buffer_size
+ *         The number of bytes available in buffer.
+ * @return The size of the frame, or 0 if the ring is empty or the frame 
+ *         does not fit into buffer. A frame which does not fit is kept.
+ * @note   Consumer side only.
+ */
+template <size_t FRAMESIZE, size_t N>
+size_t ByteMessageRing<FRAMESIZE, N>::pop(uint8_t * buffer, size_t buffer_size) {
+    size_t length;
+    const uint8_t * frame = consume_begin(length);
+    if (frame == nullptr || buffer == nullptr || length > buffer_size) {
+        return 0;
+    }
+    memcpy(buffer, frame, length);
+    consume_commit();
+    return length;
+}
+
+// implement count()
+/**
+ * @brief  Get the number of frames in the ring.
+ * @return The number of queued frames.
+ * @note   May be called from both sides. The result may already be 
+ *         outdated when it is returned.
+ */
+template <size_t FRAMESIZE, size_t N>
+size_t ByteMessageRing<FRAMESIZE, N>::count(void) const {
+    const index_type t = load_acquire(tail);
+    return static_cast<index_type>(load_acquire(head) - t);
+}
+
+// implement empty()
+/**
+ * @brief  Check if the ring is empty.
+ * @return true if no frame is queued, false otherwise.
+ */
+template <size_t FRAMESIZE, size_t N>
+bool ByteMessageRing<FRAMESIZE, N>::empty(void) const {
+    return count() == 0;
+}
+
+// implement full()
+/**
+ * @brief  Check if the ring is full.
+ * @return true if all N slots hold a frame, false otherwise.
+ */
+template <size_t FRAMESIZE, size_t N>
+bool ByteMessageRing<FRAMESIZE, N>::full(void) const {
+    return count() >= N;
+}
+
+// implement overflows()
+/**
+ * @brief  Get the number of frames dropped because the ring was full.
+ * @return The number of failed calls of produce_begin(), produce_view() 
+ *         and push() due to a full ring.
+ * @note   May be called from both sides. On AVR, the 32 bit counter is read 
+ *         until two reads agree, so an update by an interrupt service 
+ *         routine in the middle of the read is not mistaken for a value.
+ */
+template <size_t FRAMESIZE, size_t N>
+uint32_t ByteMessageRing<FRAMESIZE, N>::overflows(void) const {
+#if defined(__AVR__)
+    const volatile uint32_t * counter = &overflow_count;
+    uint32_t value = *counter;
+    uint32_t check = *counter;
+    while (value != check) {
+        value = check;
+        check = *counter;
+    }
+    return value;
+#else
+    return __atomic_load_n(&overflow_count, __ATOMIC_RELAXED);
+#endif
+}
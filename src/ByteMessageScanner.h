@@ -0,0 +1,124 @@
+/**
+ * @file    ByteMessageScanner.h
+ * @brief   Header file for the ByteMessageScanner class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageScanner_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ByteMessageScanner_h
+#define ByteMessageScanner_h
+
+#include <stdint.h> // needed for fixed-size data types
+#include <stddef.h> // needed for size_t data type
+
+#include "ByteMessageDispatcher.h" // used internally
+#include "ByteMessageView.h"       // used internally
+
+/* Note: This header file also includes the complete implementation from ByteMessageScanner.hpp! */
+
+/* 
+ * Important points:
+ * - The scanner indexes a large buffer of concatenated frames (e.g. all
+ *   frames received from many devices) without creating message objects.
+ *   For each frame, one ByteMessageScanEntry (offset, type, checksum_ok)
+ *   is written.
+ * - Frame sizes are looked up in the 256-entry table of the dispatcher,
+ *   so finding the next frame costs one table lookup, independent of the
+ *   number of registered messages.
+ * - Only wanted types produce entries and have their checksums verified.
+ *   Unwanted frames are skipped without looking at their contents. By
+ *   default, all registered types are wanted.
+ * - Checksums are verified on the raw frame with the (SIMD) checksum 
+ *   kernels of the library. Classic checksums need a temporary object,
+ *   use compile-time checksums for large buffers.
+ * - A byte with an unknown type is skipped. A frame with a wrong checksum
+ *   is indexed with checksum_ok == false and skipped as a whole.
+ * - A frame at the end of the buffer which is not complete is left for 
+ *   the next call, see consumed().
+ * - Wanted frames are decoded afterwards through a read-only view, see 
+ *   view<MSG>().
+ */
+
+/**
+ * @struct  ByteMessageScanEntry
+ * @brief   Position, type and checksum status of one frame found by ByteMessageScanner.
+ */
+struct ByteMessageScanEntry {
+    size_t  offset;      ///< Index of the type byte of the frame within the buffer.
+    uint8_t type;        ///< The type byte of the frame.
+    bool    checksum_ok; ///< true if the checksum is correct (or was not verified).
+};
+
+/**
+ * @class   ByteMessageScanner
+ * @brief   Index of the frames in a buffer holding many concatenated raw messages.
+ * @details DISPATCHER must be a ByteMessageDispatcher. Usage:
+ * 
+ *              using MyDispatcher = ByteMessageDispatcher<Point3D, TankControl, SensorData>;
+ *              ByteMessageScanner<MyDispatcher> scanner;
+ *              scanner.ignore(TankControl::type);
+ *              size_t n = scanner.scan(buffer, length, entries, max_entries);
+ *              auto view = scanner.view<Point3D>(buffer, entries[0]);
+ */
+template <class DISPATCHER>
+class ByteMessageScanner {
+
+    public:
+        ByteMessageScanner(void);                  // default constructor, all registered types are wanted
+
+        // select the types for which entries are written
+        void want(uint8_t type);
+        void ignore(uint8_t type);
+        void ignore_all(void);
+        bool wanted(uint8_t type) const;
+
+        // index frames in buffer, return number of entries written
+        size_t scan(const uint8_t * buffer, size_t length, ByteMessageScanEntry * entries, 
+                    size_t max_entries, bool verify_checksum=true);
+
+        size_t consumed(void) const;               // number of bytes processed by last call to scan()
+        uint32_t frames(void) const;               // number of complete frames found, wanted or not
+        uint32_t discarded(void) const;            // number of bytes with unknown type
+        uint32_t checksum_errors(void) const;      // number of wanted frames with wrong checksum
+
+        // read-only view of an indexed frame, detached if type or size do not match MSG
+        template <class MSG>
+        static ByteMessageView<const MSG> view(const uint8_t * buffer, const ByteMessageScanEntry &entry);
+
+    private:
+        uint8_t wanted_types[32];                  // one bit per type
+        size_t consumed_bytes;
+        uint32_t frame_counter;
+        uint32_t discard_counter;
+        uint32_t checksum_error_counter;
+};
+
+// include implementation file
+#include "ByteMessageScanner.hpp"
+
+#endif
@@ -0,0 +1,196 @@
+/**
+ * @file    ByteMessageScanner.hpp
+ * @brief   Implementation file for the ByteMessageScanner class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageScanner_hpp License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// implement default constructor
+/**
+ * @brief  The default constructor.
+ * @note   All types registered with DISPATCHER are wanted.
+ */
+template <class DISPATCHER>
+ByteMessageScanner<DISPATCHER>::ByteMessageScanner(void)
+    : wanted_types{}, consumed_bytes{0}, frame_counter{0}, discard_counter{0}, checksum_error_counter{0} {
+    for (size_t t = 0; t < 256; t++) {
+        if (DISPATCHER::known(static_cast<uint8_t>(t))) {
+            want(static_cast<uint8_t>(t));
+        }
+    }
+}
+
+// implement want()
+/**
+ * @brief  Write entries for frames of the given type.
+ * @param  type
+ *         The message type. Types not registered with DISPATCHER never
+ *         produce entries.
+ */
+template <class DISPATCHER>
+void ByteMessageScanner<DISPATCHER>::want(uint8_t type) {
+    wanted_types[type >> 3] |= static_cast<uint8_t>(1u << (type & 0x07));
+}
+
+// implement ignore()
+/**
+ * @brief  Skip frames of the given type without writing entries.
+ * @param  type
+ *         The message type.
+ * @note   Checksums of ignored frames are not verified.
+ */
+template <class DISPATCHER>
+void ByteMessageScanner<DISPATCHER>::ignore(uint8_t type) {
+    wanted_types[type >> 3] &= static_cast<uint8_t>(~(1u << (type & 0x07)));
+}
+
+// implement ignore_all()
+/**
+ * @brief  Skip frames of all types. Use want() afterwards to select types.
+ */
+template <class DISPATCHER>
+void ByteMessageScanner<DISPATCHER>::ignore_all(void) {
+    for (size_t i = 0; i < sizeof(wanted_types); i++) {
+        wanted_types[i] = 0;
+    }
+}
+
+// implement wanted()
+/**
+ * @brief  Check if entries are written for frames of the given type.
+ * @param  type
+ *         The message type.
+ * @return true if the type is registered with DISPATCHER and wanted.
+ */
+template <class DISPATCHER>
+bool ByteMessageScanner<DISPATCHER>::wanted(uint8_t type) const {
+    return DISPATCHER::known(type) && (wanted_types[type >> 3] & (1u << (type & 0x07)));
+}
+
+// implement scan()
+/**
+ * @brief  Index the frames in a buffer of concatenated raw messages.
+ * @param  buffer
+ *         Pointer to the raw messages.
+ * @param  length
+ *         Number of bytes in buffer.
+ * @param  entries
+ *         Array to write one entry per wanted frame to.
+ * @param  max_entries
+ *         Number of elements in entries. Scanning stops when it is full.
+ * @param  verify_checksum
+ *         If true, the checksums of wanted frames are verified. Otherwise
+ *         checksum_ok is always true.
+ * @return Number of entries written.
+ * @note   Scanning stops in front of an incomplete frame at the end of 
+ *         buffer or when entries is full. Continue with buffer+consumed().
+ */
+template <class DISPATCHER>
+size_t ByteMessageScanner<DISPATCHER>::scan(const uint8_t * buffer, size_t length, ByteMessageScanEntry * entries, 
+                                            size_t max_entries, bool verify_checksum) {
+    size_t pos = 0;
+    size_t n = 0;
+    while (pos < length) {
+        const uint8_t type = buffer[pos];
+        const size_t frame_size = DISPATCHER::size_of(type);
+        if (frame_size == 0) {
+            // byte cannot start a frame
+            ++discard_counter;
+            ++pos;
+            continue;
+        }
+        if (frame_size > length - pos) break; // incomplete frame, wait for more bytes
+        if (wanted_types[type >> 3] & (1u << (type & 0x07))) {
+            if (n == max_entries) break;
+            bool ok = true;
+            if (verify_checksum) {
+                ok = DISPATCHER::verify(buffer + pos, frame_size) == ByteMessageDispatchResult::ok;
+                if (!ok) ++checksum_error_counter;
+            }
+            entries[n++] = ByteMessageScanEntry{pos, type, ok};
+        }
+        ++frame_counter;
+        pos += frame_size;
+    }
+    consumed_bytes = pos;
+    return n;
+}
+
+// implement consumed()
+/**
+ * @brief  Get the number of bytes processed by the last call to scan().
+ * @return Number of bytes. The remaining bytes start an incomplete frame
+ *         or did not fit into the entries array.
+ */
+template <class DISPATCHER>
+size_t ByteMessageScanner<DISPATCHER>::consumed(void) const {
+    return consumed_bytes;
+}
+
+/**
+ * @brief  Get the number of complete frames found so far, wanted or not.
+ * @return Number of frames.
+ */
+template <class DISPATCHER>
+uint32_t ByteMessageScanner<DISPATCHER>::frames(void) const {
+    return frame_counter;
+}
+
+/**
+ * @brief  Get the number of bytes skipped because of an unknown type.
+ * @return Number of bytes.
+ */
+template <class DISPATCHER>
+uint32_t ByteMessageScanner<DISPATCHER>::discarded(void) const {
+    return discard_counter;
+}
+
+/**
+ * @brief  Get the number of wanted frames with a wrong checksum.
+ * @return Number of frames.
+ */
+template <class DISPATCHER>
+uint32_t ByteMessageScanner<DISPATCHER>::checksum_errors(void) const {
+    return checksum_error_counter;
+}
+
+// implement view()
+/**
+ * @brief  Create a read-only view of an indexed frame.
+ * @param  buffer
+ *         The buffer given to scan().
+ * @param  entry
+ *         An entry written by scan().
+ * @return A view attached to the frame, or a detached view if the type
+ *         of the frame is not MSG::type.
+ */
+template <class DISPATCHER>
+template <class MSG>
+ByteMessageView<const MSG> ByteMessageScanner<DISPATCHER>::view(const uint8_t * buffer, const ByteMessageScanEntry &entry) {
+    return ByteMessageView<const MSG>{buffer + entry.offset, MSG::size};
+}
@@ -0,0 +1,248 @@
+/**
+ * @file    ByteMessageSchema.h
+ * @brief   Header file for the ByteMessageSchema class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageSchema_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ByteMessageSchema_h
+#define ByteMessageSchema_h
+
+#include <stdint.h> // needed for fixed-size data types
+#include <stddef.h> // needed for size_t data type
+
+#include "ByteMessage.h"
+#include "ByteMessageField.h"
+#include "ByteMessageBitField.h"
+#include "ByteMessageChecksum.h"
+
+/* 
+ * Note: All function definitions are included in the header file.
+ *
+ * Important points:
+ * - ByteMessageSchema<TYPE, ENTRIES...> takes the fields of a message as
+ *   a list of types in wire order. Offsets of all fields and the size of
+ *   the message are calculated at compile time. Fields cannot overlap,
+ *   and the message is always large enough.
+ * - Entries are value types (uint8_t ... double, bool), checksums 
+ *   (ByteMessageSchemaChecksum<T, FUNC>) and reserved bytes 
+ *   (ByteMessageSchemaReserved<N>). A checksum covers all bytes in front
+ *   of it.
+ * - ByteMessageOrderedSchema<ORDER, TYPE, ENTRIES...> stores all values in 
+ *   byte order ORDER (e.g. ByteMessageLittleEndian) instead of network 
+ *   byte order. Checksums always stay in network byte order.
+ * - message is the base class of the message, plain_message the same 
+ *   without vtable pointer (see ByteMessagePlain).
+ * - field<I> is the compile-time field (ByteMessageField<T, POS> or 
+ *   ByteMessageChecksum<T, POS, FUNC>) for entry I. Declare it as a 
+ *   static constexpr member with a readable name. Access compiles to
+ *   loads and stores at fixed offsets, no pointers are stored.
+ * - bm_layout_valid<MSG>(fields...) verifies a hand-written layout of 
+ *   compile-time fields: no overlaps (bit fields are compared bitwise),
+ *   no field on the type byte and no field behind the end of MSG.
+ */
+
+/**
+ * @struct  ByteMessageSchemaChecksum
+ * @brief   Schema entry for a checksum of type T calculated with FUNC.
+ */
+template <class T, T (*FUNC)(const uint8_t*, size_t)>
+struct ByteMessageSchemaChecksum {};
+
+/**
+ * @struct  ByteMessageSchemaReserved
+ * @brief   Schema entry for N unused bytes, e.g. for later extensions.
+ */
+template <size_t N>
+struct ByteMessageSchemaReserved {};
+
+/**
+ * @struct  ByteMessageReservedField
+ * @brief   Field generated for ByteMessageSchemaReserved<N>: position and size only.
+ */
+template <size_t POS, size_t N>
+struct ByteMessageReservedField {
+    static constexpr size_t size = N;   ///< Number of reserved bytes.
+    static constexpr size_t pos  = POS; ///< Position of the first reserved byte.
+};
+
+/** @cond schema_internals */
+// field type and size of a single entry at position POS, values in byte order ORDER
+template <class ENTRY, size_t POS, class ORDER>
+struct ByteMessageSchemaEntry {
+    using type = ByteMessageField<ENTRY, POS, ORDER>;
+    static constexpr size_t size = ByteMessageFieldCodec<ENTRY, ORDER>::size;
+};
+
+template <class T, T (*FUNC)(const uint8_t*, size_t), size_t POS, class ORDER>
+struct ByteMessageSchemaEntry<ByteMessageSchemaChecksum<T, FUNC>, POS, ORDER> {
+    using type = ByteMessageChecksum<T, POS, FUNC>;
+    static constexpr size_t size = sizeof(T);
+};
+
+template <size_t N, size_t POS, class ORDER>
+struct ByteMessageSchemaEntry<ByteMessageSchemaReserved<N>, POS, ORDER> {
+    static_assert(N > 0, "reserve at least one byte");
+    using type = ByteMessageReservedField<POS, N>;
+    static constexpr size_t size = N;
+};
+
+// field type of entry I, entries start at position POS
+template <size_t I, size_t POS, class ORDER, class... ENTRIES>
+struct ByteMessageSchemaAt {
+    static_assert(I < sizeof...(ENTRIES), "index of schema entry out of range");
+};
+
+template <size_t I, size_t POS, class ORDER, class FIRST, class... REST>
+struct ByteMessageSchemaAt<I, POS, ORDER, FIRST, REST...> 
+    : ByteMessageSchemaAt<I-1, POS + ByteMessageSchemaEntry<FIRST, POS, ORDER>::size, ORDER, REST...> {};
+
+template <size_t POS, class ORDER, class FIRST, class... REST>
+struct ByteMessageSchemaAt<0, POS, ORDER, FIRST, REST...> {
+    using type = typename ByteMessageSchemaEntry<FIRST, POS, ORDER>::type;
+};
+
+// position behind the last entry, entries start at position POS
+template <size_t POS, class ORDER, class... ENTRIES>
+struct ByteMessageSchemaEnd {
+    static constexpr size_t value = POS;
+};
+
+template <size_t POS, class ORDER, class FIRST, class... REST>
+struct ByteMessageSchemaEnd<POS, ORDER, FIRST, REST...> 
+    : ByteMessageSchemaEnd<POS + ByteMessageSchemaEntry<FIRST, POS, ORDER>::size, ORDER, REST...> {};
+/** @endcond */
+
+/**
+ * @struct  ByteMessageOrderedSchema
+ * @brief   Compile-time layout of a message with type TYPE and the fields ENTRIES,
+ *          all values stored in byte order ORDER.
+ * @details ByteMessageSchema<TYPE, ENTRIES...> is the same with network 
+ *          byte order. Usage:
+ *          using SensorSchema = ByteMessageOrderedSchema<ByteMessageLittleEndian, 24, uint32_t, int16_t>;
+ */
+template <class ORDER, uint8_t TYPE, class... ENTRIES>
+struct ByteMessageOrderedSchema {
+    static_assert(sizeof...(ENTRIES) > 0, "a schema needs at least one entry");
+
+    using order = ORDER;                                                                ///< The byte order of all values.
+    static constexpr uint8_t type  = TYPE;                                              ///< The numeric type of the message.
+    static constexpr size_t  count = sizeof...(ENTRIES);                                ///< Number of entries.
+    static constexpr size_t  size  = ByteMessageSchemaEnd<1, ORDER, ENTRIES...>::value; ///< Size of the message including the type byte.
+
+    /** @brief Base class for the message. */
+    using message = ByteMessage<TYPE, size>;
+
+    /** @brief Non-polymorphic base class for the message, see ByteMessagePlain. */
+    using plain_message = ByteMessagePlain<TYPE, size>;
+
+    /** @brief Compile-time field for entry I. The first entry starts at index 1, behind the type byte. */
+    template <size_t I>
+    using field = typename ByteMessageSchemaAt<I, 1, ORDER, ENTRIES...>::type;
+
+#if __cplusplus >= 201402L
+    /** @brief Position of entry I within the message (C++14, same as field<I>::pos). */
+    template <size_t I>
+    static constexpr size_t pos = field<I>::pos;
+#endif
+};
+
+/**
+ * @brief   Compile-time layout of a message with type TYPE and the fields ENTRIES.
+ * @details Usage:
+ *          using Point3DSchema = ByteMessageSchema<23, float, float, float, ByteMessageSchemaChecksum<uint8_t, &luhn256_checksum>>;
+ *          class Point3DAuto : public Point3DSchema::message {
+ *              public:
+ *                  static constexpr Point3DSchema::field<0> x{};
+ *                  ...
+ *                  static constexpr Point3DSchema::field<3> checksum{};
+ *          };
+ */
+template <uint8_t TYPE, class... ENTRIES>
+using ByteMessageSchema = ByteMessageOrderedSchema<ByteMessageNetworkOrder, TYPE, ENTRIES...>;
+
+/** @cond layout_internals */
+// range of bits covered by a field, counted from the first bit of the message
+template <class FIELD>
+struct ByteMessageLayoutBits {
+    static constexpr size_t first = 8 * FIELD::pos;
+    static constexpr size_t count = 8 * FIELD::size;
+};
+
+template <size_t OFFSET, size_t BITPOS, size_t WIDTH, class T>
+struct ByteMessageLayoutBits<ByteMessageBitField<OFFSET, BITPOS, WIDTH, T>> {
+    static constexpr size_t first = 8 * OFFSET + BITPOS;
+    static constexpr size_t count = WIDTH;
+};
+
+// true if bits FIRST ... FIRST+COUNT-1 do not overlap with any of FIELDS
+template <size_t FIRST, size_t COUNT, class... FIELDS>
+struct ByteMessageLayoutDisjoint {
+    static constexpr bool value = true;
+};
+
+template <size_t FIRST, size_t COUNT, class FIELD, class... REST>
+struct ByteMessageLayoutDisjoint<FIRST, COUNT, FIELD, REST...> {
+    using bits = ByteMessageLayoutBits<FIELD>;
+    static constexpr bool value = !(FIRST < bits::first + bits::count && bits::first < FIRST + COUNT) && 
+                                  ByteMessageLayoutDisjoint<FIRST, COUNT, REST...>::value;
+};
+
+// true if FIELDS do not overlap, do not cover the type byte and end within SIZE bytes
+template <size_t SIZE, class... FIELDS>
+struct ByteMessageLayoutCheck {
+    static constexpr bool value = true;
+};
+
+template <size_t SIZE, class FIELD, class... REST>
+struct ByteMessageLayoutCheck<SIZE, FIELD, REST...> {
+    using bits = ByteMessageLayoutBits<FIELD>;
+    static constexpr bool value = bits::first >= 8 &&                         // type byte
+                                  bits::first + bits::count <= 8 * SIZE &&    // behind the end
+                                  ByteMessageLayoutDisjoint<bits::first, bits::count, REST...>::value && // overlap
+                                  ByteMessageLayoutCheck<SIZE, REST...>::value;
+};
+/** @endcond */
+
+// implement bm_layout_valid()
+/**
+ * @brief   Verify the layout of compile-time fields of a message.
+ * @details Use it in a static_assert behind the message class, e.g.
+ *          static_assert(bm_layout_valid<Point3DCompact>(Point3DCompact::x, Point3DCompact::y, 
+ *                                                        Point3DCompact::z, Point3DCompact::checksum), "bad layout");
+ * @param   fields
+ *          Compile-time fields, bit fields and checksums of MSG.
+ * @return  true if no two fields overlap, no field covers the type 
+ *          byte and all fields end within MSG::size bytes, false otherwise.
+ */
+template <class MSG, class... FIELDS>
+constexpr bool bm_layout_valid(const FIELDS&...) {
+    return ByteMessageLayoutCheck<MSG::size, FIELDS...>::value;
+}
+
+#endif
@@ -0,0 +1,101 @@
+/**
+ * @file    ByteMessageSpan.h
+ * @brief   Header file for the ByteMessageSpan class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageSpan_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ByteMessageSpan_h
+#define ByteMessageSpan_h
+
+#include <stdint.h> // needed for fixed-size data types
+#include <stddef.h> // needed for size_t data type
+
+/* 
+ * Note: All function definitions are included in the header file.
+ *
+ * Important points:
+ * - The subscript operators of messages and blobs check the index on 
+ *   every access. Out-of-bounds indices return a reference to zero.
+ * - For loops over many bytes, span() returns a ByteMessageSpan: pointer 
+ *   and length, like std::span. Its subscript operator does NOT check the
+ *   index. Range-based for loops work, too.
+ * - Define BM_DEBUG_BOUNDS (before including any header of the library)
+ *   to assert() on every out-of-bounds index instead, both for the 
+ *   checked subscript operators and for spans. Never define it for 
+ *   production builds.
+ */
+
+#if defined(BM_DEBUG_BOUNDS)
+    #include <assert.h>
+    #define BM_ASSERT_INDEX(index, size) assert((index) < (size))
+#else
+    #define BM_ASSERT_INDEX(index, size) ((void)0)
+#endif
+
+/** @brief Zero byte for read-only subscript operators called with out-of-bounds indices. */
+#if (__cplusplus >= 201703L)
+inline constexpr uint8_t bm_zero_byte = 0;
+#else
+static constexpr uint8_t bm_zero_byte = 0; // inline variables need C++17, so one byte per translation unit
+#endif
+
+/**
+ * @class   ByteMessageSpan
+ * @brief   Non-owning, unchecked view of a contiguous range of bytes.
+ * @details T is uint8_t (read & write) or const uint8_t (read-only).
+ *          A span is only valid as long as the message or blob it was 
+ *          taken from.
+ */
+template <class T>
+class ByteMessageSpan {
+    public:
+        /** @brief Create span of length bytes starting at ptr. */
+        constexpr ByteMessageSpan(T * ptr, size_t length) : ptr{ptr}, length{length} {}
+
+        /** @brief Access byte at index. The index is not checked (unless BM_DEBUG_BOUNDS is defined). */
+        constexpr T& operator[](size_t index) const { BM_ASSERT_INDEX(index, length); return ptr[index]; }
+
+        /** @brief Pointer to the first byte. */
+        constexpr T* data(void) const { return ptr; }
+
+        /** @brief Number of bytes. */
+        constexpr size_t size(void) const { return length; }
+
+        /** @brief Begin of range, for range-based for loops. */
+        constexpr T* begin(void) const { return ptr; }
+
+        /** @brief End of range, for range-based for loops. */
+        constexpr T* end(void) const { return ptr + length; }
+
+    private:
+        T * ptr;
+        size_t length;
+};
+
+#endif
@@ -0,0 +1,295 @@
+/**
+ * @file    ByteMessageStats.h
+ * @brief   Header file for the ByteMessageStats class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageStats_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ByteMessageStats_h
+#define ByteMessageStats_h
+
+#include <stdint.h> // needed for fixed-size data types
+#include <stddef.h> // needed for size_t data type
+
+/* 
+ * Note: All function definitions are included in the header file.
+ *
+ * Important points:
+ * - Statistics are off by default and cost nothing then: all hooks are
+ *   empty inline functions and no counters exist.
+ * - Define BM_STATS (before including any header of the library) to 
+ *   count per message type:
+ *   - populate(): frames accepted, rejected for wrong size and rejected 
+ *     for wrong type (counted for the type of the message object),
+ *   - check() and update() of checksums: passes, failures and updates
+ *     (counted for the type byte of the checked array).
+ * - Define BM_STATS_CYCLES in addition to measure the cycles spent in 
+ *   the checksum function of each check() and update(). Only available
+ *   on x86 (rdtsc) and ARM Cortex-M3/M4/M7/M33 (DWT cycle counter),
+ *   ignored on all other targets. The cycle count includes the overhead 
+ *   of reading the counter, and on hosts the time the thread was not 
+ *   running.
+ * - Only type bytes below BM_STATS_TYPES are counted (default: 256, or 
+ *   16 on AVR). Each type takes about 40 bytes of RAM.
+ * - Counters are 32 bit wide and wrap around. Counting is not atomic on
+ *   boards: an ISR updating counters may lose a count of the main loop.
+ *   On hosts, counters are updated with relaxed atomic operations, so 
+ *   several threads can count at the same time.
+ */
+
+#if !defined(BM_STATS_TYPES)
+    #if defined(__AVR__)
+        #define BM_STATS_TYPES 16
+    #else
+        #define BM_STATS_TYPES 256
+    #endif
+#endif
+
+/** @cond stats_internals */
+#if defined(BM_STATS) && defined(BM_STATS_CYCLES)
+    #if defined(__x86_64__) || defined(__i386__)
+        #define BM_STATS_CYCLES_RDTSC
+    #elif defined(__arm__) && ( defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__) )
+        #define BM_STATS_CYCLES_DWT
+    #endif
+#endif
+
+#if defined(BM_STATS) && (!defined(ARDUINO) || defined(BM_HOST))
+    #define BM_STATS_ATOMIC
+#endif
+/** @endcond */
+
+/**
+ * @struct  ByteMessageStatsSnapshot
+ * @brief   Copy of the counters of one message type (or of all types).
+ */
+struct ByteMessageStatsSnapshot {
+    uint32_t populate_ok;            ///< Number of successful calls to populate().
+    uint32_t populate_size_rejects;  ///< Number of frames rejected by populate() because of a wrong size.
+    uint32_t populate_type_rejects;  ///< Number of frames rejected by populate() because of a wrong type.
+    uint32_t checksum_passes;        ///< Number of calls to check() with a matching checksum.
+    uint32_t checksum_failures;      ///< Number of calls to check() with a wrong checksum.
+    uint32_t checksum_updates;       ///< Number of calls to update().
+    uint32_t cycle_samples;          ///< Number of checksum calculations included in cycles.
+    uint64_t cycles;                 ///< Sum of cycles spent in checksum functions (BM_STATS_CYCLES only).
+};
+
+/**
+ * @class   ByteMessageStats
+ * @brief   Snapshot API for the statistics counters (see BM_STATS).
+ * @details Usage:
+ * 
+ *              ByteMessageStatsSnapshot s = ByteMessageStats::snapshot(SensorData::type);
+ *              Serial.println(s.checksum_failures);
+ *              ByteMessageStats::reset();
+ */
+class ByteMessageStats final {
+    public:
+    #if defined(BM_STATS)
+        static constexpr bool enabled = true;         ///< true if BM_STATS is defined.
+    #else
+        static constexpr bool enabled = false;
+    #endif
+    #if defined(BM_STATS_CYCLES_RDTSC) || defined(BM_STATS_CYCLES_DWT)
+        static constexpr bool cycles_enabled = true;  ///< true if cycles are measured on this target.
+    #else
+        static constexpr bool cycles_enabled = false;
+    #endif
+        static constexpr size_t types = BM_STATS_TYPES; ///< Number of counted type bytes.
+
+        // counters of one type, all zero for types >= BM_STATS_TYPES
+        static ByteMessageStatsSnapshot snapshot(uint8_t type);
+
+        // counters of all types added up
+        static ByteMessageStatsSnapshot snapshot(void);
+
+        // set all counters to zero
+        static void reset(void);
+};
+
+/** @cond stats_internals */
+
+#if defined(BM_STATS)
+// counters per type
+inline ByteMessageStatsSnapshot bm_stats_table[BM_STATS_TYPES] = {};
+
+// check if counters exist for type
+inline bool bm_stats_counted(uint8_t type) {
+#if (BM_STATS_TYPES > 255)
+    (void) type;
+    return true;
+#else
+    return type < BM_STATS_TYPES;
+#endif
+}
+
+template <class T>
+inline void bm_stats_add(T &counter, T value) {
+#if defined(BM_STATS_ATOMIC)
+    __atomic_fetch_add(&counter, value, __ATOMIC_RELAXED);
+#else
+    counter += value;
+#endif
+}
+
+template <class T>
+inline T bm_stats_load(const T &counter) {
+#if defined(BM_STATS_ATOMIC)
+    return __atomic_load_n(&counter, __ATOMIC_RELAXED);
+#else
+    return counter;
+#endif
+}
+#endif
+
+#if defined(BM_STATS_CYCLES_RDTSC)
+inline uint64_t bm_stats_cycles(void) {
+    return __builtin_ia32_rdtsc();
+}
+#elif defined(BM_STATS_CYCLES_DWT)
+inline uint32_t bm_stats_cycles(void) {
+    volatile uint32_t * const demcr      = reinterpret_cast<volatile uint32_t *>(0xE000EDFC);
+    volatile uint32_t * const dwt_ctrl   = reinterpret_cast<volatile uint32_t *>(0xE0001000);
+    volatile uint32_t * const dwt_cyccnt = reinterpret_cast<volatile uint32_t *>(0xE0001004);
+    volatile uint32_t * const dwt_lar    = reinterpret_cast<volatile uint32_t *>(0xE0001FB0);
+    // enable cycle counter on first use
+    if ((*dwt_ctrl & 1u) == 0) {
+        *demcr |= (1u << 24);    // TRCENA
+        *dwt_lar = 0xC5ACCE55;   // unlock DWT (Cortex-M7), ignored by other cores
+        *dwt_cyccnt = 0;
+        *dwt_ctrl |= 1u;         // CYCCNTENA
+    }
+    return *dwt_cyccnt;
+}
+#endif
+
+// count an event for type, e.g. bm_stats_count(TYPE, &ByteMessageStatsSnapshot::populate_ok)
+inline void bm_stats_count(uint8_t type, uint32_t ByteMessageStatsSnapshot::* counter) {
+#if defined(BM_STATS)
+    if (bm_stats_counted(type)) {
+        bm_stats_add(bm_stats_table[type].*counter, uint32_t{1});
+    }
+#else
+    (void) type;
+    (void) counter;
+#endif
+}
+
+// count a checksum result for type
+inline bool bm_stats_check(uint8_t type, bool passed) {
+    bm_stats_count(type, passed ? &ByteMessageStatsSnapshot::checksum_passes : &ByteMessageStatsSnapshot::checksum_failures);
+    return passed;
+}
+
+// call func() (a checksum calculation) and add the cycles it took for type
+template <class FUNC>
+inline auto bm_stats_timed(uint8_t type, FUNC &&func) -> decltype(func()) {
+#if defined(BM_STATS_CYCLES_RDTSC) || defined(BM_STATS_CYCLES_DWT)
+    const auto start = bm_stats_cycles();
+    const auto result = func();
+    const auto elapsed = bm_stats_cycles() - start;
+    if (bm_stats_counted(type)) {
+        bm_stats_add(bm_stats_table[type].cycles, static_cast<uint64_t>(elapsed));
+        bm_stats_add(bm_stats_table[type].cycle_samples, uint32_t{1});
+    }
+    return result;
+#else
+    (void) type;
+    return func();
+#endif
+}
+
+/** @endcond */
+
+// implement snapshot() for one type
+/**
+ * @brief  Get the counters of one message type.
+ * @param  type
+ *         The type byte of the message.
+ * @return Copy of the counters. All zero if BM_STATS is not defined or
+ *         type >= BM_STATS_TYPES.
+ * @note   The counters are copied one by one. Counts happening during 
+ *         the copy may be included in some counters and not in others.
+ */
+inline ByteMessageStatsSnapshot ByteMessageStats::snapshot(uint8_t type) {
+    ByteMessageStatsSnapshot s{};
+#if defined(BM_STATS)
+    if (bm_stats_counted(type)) {
+        const ByteMessageStatsSnapshot &c = bm_stats_table[type];
+        s.populate_ok           = bm_stats_load(c.populate_ok);
+        s.populate_size_rejects = bm_stats_load(c.populate_size_rejects);
+        s.populate_type_rejects = bm_stats_load(c.populate_type_rejects);
+        s.checksum_passes       = bm_stats_load(c.checksum_passes);
+        s.checksum_failures     = bm_stats_load(c.checksum_failures);
+        s.checksum_updates      = bm_stats_load(c.checksum_updates);
+        s.cycle_samples         = bm_stats_load(c.cycle_samples);
+        s.cycles                = bm_stats_load(c.cycles);
+    }
+#else
+    (void) type;
+#endif
+    return s;
+}
+
+// implement snapshot() for all types
+/**
+ * @brief  Get the counters of all message types added up.
+ * @return Sum of the counters of all types (see snapshot(uint8_t)).
+ */
+inline ByteMessageStatsSnapshot ByteMessageStats::snapshot(void) {
+    ByteMessageStatsSnapshot sum{};
+#if defined(BM_STATS)
+    for (size_t t = 0; t < BM_STATS_TYPES; t++) {
+        const ByteMessageStatsSnapshot s = snapshot(static_cast<uint8_t>(t));
+        sum.populate_ok           += s.populate_ok;
+        sum.populate_size_rejects += s.populate_size_rejects;
+        sum.populate_type_rejects += s.populate_type_rejects;
+        sum.checksum_passes       += s.checksum_passes;
+        sum.checksum_failures     += s.checksum_failures;
+        sum.checksum_updates      += s.checksum_updates;
+        sum.cycle_samples         += s.cycle_samples;
+        sum.cycles                += s.cycles;
+    }
+#endif
+    return sum;
+}
+
+// implement reset()
+/**
+ * @brief  Set the counters of all types to zero.
+ * @note   Do not call while other threads are counting.
+ */
+inline void ByteMessageStats::reset(void) {
+#if defined(BM_STATS)
+    for (size_t t = 0; t < BM_STATS_TYPES; t++) {
+        bm_stats_table[t] = ByteMessageStatsSnapshot{};
+    }
+#endif
+}
+
+#endif
@@ -0,0 +1,116 @@
+/**
+ * @file    ByteMessageStreamDecoder.h
+ * @brief   Header file for the ByteMessageStreamDecoder class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageStreamDecoder_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ByteMessageStreamDecoder_h
+#define ByteMessageStreamDecoder_h
+
+#include <stdint.h> // needed for fixed-size data types
+#include <stddef.h> // needed for size_t data type
+
+#include "ByteMessageDispatcher.h" // used internally
+
+/* Note: This header file also includes the complete implementation from ByteMessageStreamDecoder.hpp! */
+
+/* 
+ * Important points:
+ * - The decoder is a state machine which is fed one byte (or a chunk of
+ *   bytes) at a time, e.g. from a UART receive interrupt.
+ * - Frames are not delimited on the wire. The type byte of a frame tells
+ *   the decoder (through the dispatcher) how many bytes to expect.
+ * - Complete frames are handed to the dispatcher, which verifies the
+ *   checksum and calls the handler.
+ * - A byte which cannot start a frame (unknown type) is discarded.
+ * - If a complete frame is rejected (wrong checksum), only its first
+ *   byte is discarded. Decoding resumes with the next byte in the 
+ *   rejected frame which can start a frame.
+ * - The buffer is a ring with a mirrored second half: every byte is 
+ *   stored twice, N bytes apart (N: size of the largest registered 
+ *   message). So the frame starting at any position is contiguous in 
+ *   memory and discarding bytes only moves an index, nothing is copied.
+ * - Costs per byte are constant, plus one checksum calculation for each
+ *   completed frame candidate. On a corrupted stream, every byte which
+ *   can start a frame becomes a candidate, so the worst case is one 
+ *   checksum calculation over up to N bytes per byte received.
+ * - The internal buffer holds 2 * N bytes and is sized at compile time.
+ *   There is no heap allocation.
+ */
+
+/**
+ * @class   ByteMessageStreamDecoder
+ * @brief   Incremental decoder for a stream of raw messages.
+ * @details DISPATCHER must be a ByteMessageDispatcher. Usage:
+ * 
+ *              using MyDispatcher = ByteMessageDispatcher<Point3D, TankControl, SensorData>;
+ *              ByteMessageStreamDecoder<MyDispatcher> decoder;
+ *              decoder.put(Serial.read(), handler);
+ */
+template <class DISPATCHER>
+class ByteMessageStreamDecoder {
+
+    public:
+        ByteMessageStreamDecoder(void);                    // default constructor
+
+        // feed a single byte, return true if at least one frame was handled
+        template <class HANDLER>
+        bool put(uint8_t byte, HANDLER &&handler);
+
+        // feed a chunk of bytes, return number of frames handled
+        template <class HANDLER>
+        size_t write(const uint8_t * data, size_t length, HANDLER &&handler);
+
+        // discard partial frame, keep counters
+        void reset(void);
+
+        // number of bytes in partial frame
+        size_t pending(void) const;
+
+        uint32_t frames(void) const;          // number of frames handed to handler
+        uint32_t discarded(void) const;       // number of bytes discarded while resynchronizing
+        uint32_t checksum_errors(void) const; // number of complete frames with wrong checksum
+
+    private:
+        // handle all complete frames in buffer
+        template <class HANDLER>
+        bool process(HANDLER &handler);
+
+        uint8_t buffer[2 * DISPATCHER::max_size]; // ring of partial frame, mirrored: buffer[i] == buffer[i + max_size]
+        size_t head;                              // start of partial frame in ring, buffer[head] is always a known type
+        size_t fill;                              // number of bytes in partial frame
+        uint32_t frame_counter;
+        uint32_t discard_counter;
+        uint32_t checksum_error_counter;
+};
+
+// include implementation file
+#include "ByteMessageStreamDecoder.hpp"
+
+#endif
@@ -0,0 +1,177 @@
+/**
+ * @file    ByteMessageStreamDecoder.hpp
+ * @brief   Implementation file for the ByteMessageStreamDecoder class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageStreamDecoder_hpp License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// implement default constructor
+/**
+ * @brief  The default constructor.
+ */
+template <class DISPATCHER>
+ByteMessageStreamDecoder<DISPATCHER>::ByteMessageStreamDecoder(void)
+    : head{0}, fill{0}, frame_counter{0}, discard_counter{0}, checksum_error_counter{0} {}
+
+// implement put()
+/**
+ * @brief  Feed a single byte into the decoder.
+ * @param  byte
+ *         The next byte of the stream.
+ * @param  handler
+ *         A callable object which accepts all message classes registered
+ *         with DISPATCHER (see ByteMessageDispatcher::dispatch()).
+ * @return true if at least one frame was completed and handed to handler,
+ *         false otherwise.
+ * @note   Constant time, plus one checksum calculation for each frame
+ *         completed by byte. After a rejected frame, the frames starting
+ *         within the rejected bytes are checked, too. 
+ */
+template <class DISPATCHER>
+template <class HANDLER>
+bool ByteMessageStreamDecoder<DISPATCHER>::put(uint8_t byte, HANDLER &&handler) {
+    if (fill == 0 && !DISPATCHER::known(byte)) {
+        // byte cannot start a frame
+        ++discard_counter;
+        return false;
+    }
+    // store byte in ring and in its mirror
+    size_t tail = head + fill;
+    if (tail >= DISPATCHER::max_size) tail -= DISPATCHER::max_size;
+    buffer[tail] = byte;
+    buffer[tail + DISPATCHER::max_size] = byte;
+    ++fill;
+    return process(handler);
+}
+
+// implement write()
+/**
+ * @brief  Feed a chunk of bytes into the decoder.
+ * @param  data
+ *         Pointer to the next bytes of the stream.
+ * @param  length
+ *         Number of bytes in data.
+ * @param  handler
+ *         A callable object which accepts all message classes registered
+ *         with DISPATCHER (see ByteMessageDispatcher::dispatch()).
+ * @return Number of frames handed to handler.
+ */
+template <class DISPATCHER>
+template <class HANDLER>
+size_t ByteMessageStreamDecoder<DISPATCHER>::write(const uint8_t * data, size_t length, HANDLER &&handler) {
+    const uint32_t before = frame_counter;
+    for (size_t i = 0; i < length; i++) {
+        put(data[i], handler);
+    }
+    return static_cast<size_t>(frame_counter - before);
+}
+
+// implement reset()
+/**
+ * @brief  Discard a partially received frame.
+ * @note   Counters are not reset.
+ */
+template <class DISPATCHER>
+void ByteMessageStreamDecoder<DISPATCHER>::reset(void) {
+    head = 0;
+    fill = 0;
+}
+
+// implement pending()
+/**
+ * @brief  Get the number of bytes of a partially received frame.
+ * @return Number of bytes waiting for completion of a frame.
+ */
+template <class DISPATCHER>
+size_t ByteMessageStreamDecoder<DISPATCHER>::pending(void) const {
+    return fill;
+}
+
+/**
+ * @brief  Get the number of frames handed to the handler so far.
+ * @return Number of frames.
+ */
+template <class DISPATCHER>
+uint32_t ByteMessageStreamDecoder<DISPATCHER>::frames(void) const {
+    return frame_counter;
+}
+
+/**
+ * @brief  Get the number of bytes discarded while resynchronizing.
+ * @return Number of bytes.
+ */
+template <class DISPATCHER>
+uint32_t ByteMessageStreamDecoder<DISPATCHER>::discarded(void) const {
+    return discard_counter;
+}
+
+/**
+ * @brief  Get the number of complete frames with a wrong checksum.
+ * @return Number of frames.
+ */
+template <class DISPATCHER>
+uint32_t ByteMessageStreamDecoder<DISPATCHER>::checksum_errors(void) const {
+    return checksum_error_counter;
+}
+
+// implement process()
+// Invariant: buffer[head] is a known type whenever fill > 0.
+// Because of the mirror, the fill bytes starting at buffer+head are contiguous.
+template <class DISPATCHER>
+template <class HANDLER>
+bool ByteMessageStreamDecoder<DISPATCHER>::process(HANDLER &handler) {
+    bool handled = false;
+    while (fill > 0) {
+        const uint8_t * frame = buffer + head;
+        const size_t expected = DISPATCHER::size_of(frame[0]);
+        if (fill < expected) break; // wait for more bytes
+        size_t consumed;
+        if (DISPATCHER::dispatch(frame, expected, handler) == ByteMessageDispatchResult::ok) {
+            ++frame_counter;
+            handled = true;
+            consumed = expected;
+        }
+        else {
+            // Type and size are correct by construction, so the checksum
+            // is wrong. Drop only the first byte and resynchronize on the rest.
+            ++checksum_error_counter;
+            ++discard_counter;
+            consumed = 1;
+        }
+        // skip all bytes which cannot start a frame
+        while (consumed < fill && !DISPATCHER::known(frame[consumed])) {
+            ++discard_counter;
+            ++consumed;
+        }
+        // move start of partial frame, nothing is copied
+        fill -= consumed;
+        head += consumed;
+        if (head >= DISPATCHER::max_size) head -= DISPATCHER::max_size;
+    }
+    return handled;
+}
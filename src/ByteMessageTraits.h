@@ -0,0 +1,160 @@
+/**
+ * @file    ByteMessageTraits.h
+ * @brief   Header file for the ByteMessageTraits helper class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageTraits_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ByteMessageTraits_h
+#define ByteMessageTraits_h
+
+#include <stdint.h> // needed for fixed-size data types
+#include <stddef.h> // needed for size_t data type
+
+#include "ByteMessageField.h" // needed for ByteMessageUninitialized
+
+/* 
+ * Note: All function definitions are included in the header file.
+ *
+ * ByteMessageTraits collects compile-time knowledge about message classes
+ * which generic code (dispatcher, decoder, ...) needs. We do not rely 
+ * on <type_traits>, because it is not available on all Arduino platforms.
+ *
+ * By convention, the checksum of a message is a member named "checksum":
+ * - classic flavor:       ByteMessageChecksum<T> checksum{msgarr, POS, FUNC};
+ * - compile-time flavor:  static constexpr ByteMessageChecksum<T, POS, FUNC> checksum{};
+ * Messages without such a member are treated as having no checksum, i.e.
+ * the checksum is always considered to be correct.
+ */
+
+/**
+ * @class   ByteMessageTraits
+ * @brief   Compile-time properties of a message class MSG derived from ByteMessage.
+ */
+template <class MSG>
+struct ByteMessageTraits {
+
+    // check checksum of a message object
+    static bool check(const MSG &msg) {
+        return check_object(msg, 0);
+    }
+
+    // check checksum of a raw message with correct type and size
+    // Note: raw message is copied into a temporary object for classic checksums.
+    static bool check(const uint8_t * raw_message) {
+        return check_raw(raw_message, 0);
+    }
+
+    // create a message object which is populated right away
+    // Note: Skips initialization if MSG has a constructor taking bm_uninitialized.
+    static MSG make_for_populate(void) {
+        return make_object(0);
+    }
+
+    // (re-)calculate and store checksum of a message object
+    static void update(MSG &msg) {
+        update_object(msg, 0);
+    }
+
+    // (re-)calculate and store checksum of a raw message with correct type and size
+    // Note: Only possible for compile-time checksums (or no checksum at all).
+    static void update(uint8_t * raw_message) {
+        update_raw(raw_message, 0);
+    }
+
+    private:
+        /** @cond traits_helpers */
+        // Overload resolution picks int > long > ellipsis for argument 0.
+        // Overloads which are not well-formed for MSG drop out (SFINAE).
+
+        // compile-time checksum
+        template <class M = MSG>
+        static auto check_object(const M &msg, int) -> decltype(M::checksum.check(msg.get_ptr())) {
+            return M::checksum.check(msg.get_ptr());
+        }
+        // classic checksum
+        template <class M = MSG>
+        static auto check_object(const M &msg, long) -> decltype(msg.checksum.check()) {
+            return msg.checksum.check();
+        }
+        // no checksum at all
+        static bool check_object(const MSG &, ...) {
+            return true;
+        }
+
+        // compile-time checksum, works directly on raw data
+        template <class M = MSG>
+        static auto check_raw(const uint8_t * raw_message, int) -> decltype(M::checksum.check(raw_message)) {
+            return M::checksum.check(raw_message);
+        }
+        // classic checksum or no checksum, needs a populated object
+        static bool check_raw(const uint8_t * raw_message, long) {
+            MSG msg = make_for_populate();
+            msg.populate(raw_message, MSG::size);
+            return check_object(msg, 0);
+        }
+
+        // compile-time checksum
+        template <class M = MSG>
+        static auto update_object(M &msg, int) -> decltype(M::checksum.update(static_cast<uint8_t*>(nullptr))) {
+            msg.update(M::checksum);
+        }
+        // classic checksum
+        template <class M = MSG>
+        static auto update_object(M &msg, long) -> decltype(msg.checksum.update()) {
+            msg.checksum.update();
+        }
+        // no checksum at all
+        static void update_object(MSG &, ...) {}
+
+        // compile-time checksum, works directly on raw data
+        template <class M = MSG>
+        static auto update_raw(uint8_t * raw_message, int) -> decltype(M::checksum.update(raw_message)) {
+            M::checksum.update(raw_message);
+        }
+        // classic checksum, cannot work on raw data
+        template <class M = MSG>
+        static auto update_raw(uint8_t *, long) -> decltype(static_cast<M*>(nullptr)->checksum.update()) {
+            static_assert(sizeof(M) == 0, "classic checksums can only be updated in a message object");
+        }
+        // no checksum at all
+        static void update_raw(uint8_t *, ...) {}
+
+        // message class with constructor for uninitialized objects
+        template <class M = MSG>
+        static auto make_object(int) -> decltype(M(bm_uninitialized)) {
+            return M(bm_uninitialized);
+        }
+        // any other message class
+        static MSG make_object(long) {
+            return MSG();
+        }
+        /** @endcond */
+};
+
+#endif
@@ -0,0 +1,196 @@
+/**
+ * @file    ByteMessageVariable.h
+ * @brief   Header file for the ByteMessageVariable class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageVariable_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ByteMessageVariable_h
+#define ByteMessageVariable_h
+
+#include <stdint.h> // needed for fixed-size data types
+#include <stddef.h> // needed for size_t data type
+
+#include "ByteMessageField.h"
+#include "ByteMessageVarint.h"
+#include "ByteMessageSpan.h"
+#include "ByteMessageStats.h"
+
+/* Note: This header file also includes the complete implementation from ByteMessageVariable.hpp! */
+
+/* 
+ * Important points:
+ * - ByteMessageVariable is the base class for messages whose length 
+ *   changes with the values of their fields. The frame layout is:
+ *     - type byte at index 0
+ *     - fixed-size header: bytes 1 ... HEADER-1, accessed with 
+ *       compile-time fields (ByteMessageField<T, POS>, ByteMessageBitField)
+ *     - FIELDS variable-length fields. By default, all of them are 
+ *       varints, accessed with ByteMessageVarintField<T, INDEX>. If bit 
+ *       INDEX of BLOBS is set, field INDEX is a length-prefixed blob 
+ *       (ByteMessagePrefixedBlob<INDEX, MAXLEN>): a varint holding the 
+ *       number of bytes, followed by the bytes. Unused bytes are not part
+ *       of the frame, i.e. there is no zero padding.
+ *     - optional trailer of TRAILER bytes, i.e. a checksum
+ *       (ByteMessageTrailerChecksum<T, FUNC>) covering all bytes before it
+ * - MAXSIZE bytes are reserved, length() returns the number of bytes 
+ *   actually used. Only those bytes have to be sent.
+ * - set() for a varint field moves all bytes behind it if the length of
+ *   the encoded value changes. It fails (and returns false) if the frame 
+ *   would grow beyond MAXSIZE.
+ * - Setting a field invalidates the trailer checksum. Call update() after
+ *   all fields have been set.
+ * - populate() accepts frames of any length between min_size and 
+ *   MAXSIZE, but only if the variable-length fields exactly fill the frame.
+ * - All fields are static data members without state, so copy 
+ *   construction and assignment copy the complete frame in the base 
+ *   class. Derived classes need no copy constructor or assignment operator.
+ * - ByteMessageDispatcher, ByteMessageView and friends work with fixed-size 
+ *   messages only.
+ */
+
+/**
+ * @class   ByteMessageTrailerChecksum
+ * @brief   Checksum at the end of a ByteMessageVariable.
+ * @details Covers all bytes of the frame before the checksum. Declare as 
+ *          "static constexpr" member of a class derived from 
+ *          ByteMessageVariable and access it through the message, e.g.
+ *          msg.update(msg.checksum) and msg.check(msg.checksum).
+ */
+template <class T, T (*FUNC)(const uint8_t*, size_t)>
+class ByteMessageTrailerChecksum final {
+    static_assert(bm_function_bound<T (*)(const uint8_t*, size_t), FUNC>::value, "trailer checksums need a checksum function");
+    public:
+        using value_type = T;                                          ///< The data type of the checksum.
+        static constexpr size_t size = ByteMessageFieldCodec<T>::size; ///< Size of the checksum value in bytes
+        static constexpr T (*function)(const uint8_t*, size_t) = FUNC; ///< The checksum function.
+
+        // calculate checksum of frame with given length (including checksum)
+        static T calc(const uint8_t * msg, size_t length);
+        // get stored checksum value
+        static T get(const uint8_t * msg, size_t length);
+        // calculate and store checksum
+        static void update(uint8_t * msg, size_t length);
+        // compare calculated and stored checksum
+        static bool check(const uint8_t * msg, size_t length);
+};
+
+/**
+ * @class   ByteMessagePrefixedBlob
+ * @brief   Length-prefixed binary data of a ByteMessageVariable.
+ * @details Holds up to MAXLEN bytes. Only the bytes actually stored (and
+ *          a varint with their number) are part of the frame. Declare as 
+ *          "static constexpr" member of a class derived from 
+ *          ByteMessageVariable and set bit INDEX in its BLOBS parameter.
+ */
+template <size_t INDEX, size_t MAXLEN>
+class ByteMessagePrefixedBlob final {
+    public:
+        static constexpr size_t index      = INDEX;                                   ///< Index among the variable-length fields of the message.
+        static constexpr size_t max_length = MAXLEN;                                  ///< Largest number of data bytes.
+        static constexpr size_t max_size   = bm_varint_size<size_t>(MAXLEN) + MAXLEN; ///< Largest number of bytes including length prefix.
+};
+
+/**
+ * @class   ByteMessageVariable
+ * @brief   Templated base class for messages with variable length.
+ * @details This class is not meant to be instantiated directly, but to
+ *          be derived from. See the description above for the layout.
+ *          The minimum length of a frame is HEADER + FIELDS + TRAILER, as
+ *          each variable-length field takes at least one byte.
+ */
+template <uint8_t TYPE, size_t MAXSIZE, size_t HEADER, size_t FIELDS, size_t TRAILER = 0, uint32_t BLOBS = 0>
+class ByteMessageVariable {
+
+    static_assert(HEADER > 0, "HEADER includes the type byte");
+    static_assert(HEADER + FIELDS + TRAILER <= MAXSIZE, "MAXSIZE is too small");
+    static_assert(FIELDS >= 32 || (BLOBS >> FIELDS) == 0, "BLOBS marks fields which do not exist");
+
+    public:
+        ByteMessageVariable(void);                                      // default constructor
+        explicit ByteMessageVariable(ByteMessageUninitialized);         // constructor without initialization, e.g. before populate()
+        ByteMessageVariable(const ByteMessageVariable &bm);             // copy constructor
+        virtual ~ByteMessageVariable() = default;                       // default public virtual destructor
+        ByteMessageVariable& operator= (const ByteMessageVariable& bm); // assignment operator
+        const uint8_t& operator[](size_t index) const;                  // read-only subscript operator
+
+        static constexpr uint8_t type         = TYPE;                   ///< The numeric type of the message.
+        static constexpr size_t  max_size     = MAXSIZE;                ///< The size of the underlying array.
+        static constexpr size_t  min_size     = HEADER + FIELDS + TRAILER; ///< The length of the shortest possible frame.
+        static constexpr size_t  header_size  = HEADER;                 ///< Number of bytes before the first variable-length field.
+        static constexpr size_t  field_count  = FIELDS;                 ///< Number of variable-length fields.
+        static constexpr size_t  trailer_size = TRAILER;                ///< Number of bytes after the last variable-length field.
+
+        // return current length of frame
+        size_t length(void) const;
+
+        // return pointer to constant value(s)
+        const uint8_t* get_ptr(void) const;
+        ByteMessageSpan<const uint8_t> span(void) const;                // unchecked read-only span of length() bytes
+
+        // populate message from raw byte array
+        bool populate(const uint8_t * raw_message, size_t message_size);
+
+        // access compile-time fields in header
+        template <class FIELD> typename FIELD::value_type get(const FIELD &field) const;
+        template <class FIELD> void set(const FIELD &field, typename FIELD::value_type value);
+
+        // access varint fields
+        template <class T, size_t INDEX> T get(const ByteMessageVarintField<T, INDEX> &field) const;
+        template <class T, size_t INDEX> bool set(const ByteMessageVarintField<T, INDEX> &field, typename ByteMessageVarintField<T, INDEX>::value_type value);
+
+        // access length-prefixed blobs
+        template <size_t INDEX, size_t MAXLEN> size_t set(const ByteMessagePrefixedBlob<INDEX, MAXLEN> &blob, const uint8_t * data, size_t length);
+        template <size_t INDEX, size_t MAXLEN> size_t get(const ByteMessagePrefixedBlob<INDEX, MAXLEN> &blob, uint8_t * data, size_t length) const;
+        template <size_t INDEX, size_t MAXLEN> size_t length(const ByteMessagePrefixedBlob<INDEX, MAXLEN> &blob) const;
+        template <size_t INDEX, size_t MAXLEN> const uint8_t* get_ptr(const ByteMessagePrefixedBlob<INDEX, MAXLEN> &blob) const;
+
+        // access trailer checksum
+        template <class CHECKSUM> typename CHECKSUM::value_type calc(const CHECKSUM &checksum) const;
+        template <class CHECKSUM> void update(const CHECKSUM &checksum);
+        template <class CHECKSUM> bool check(const CHECKSUM &checksum) const;
+
+    protected:
+        uint8_t msgarr[MAXSIZE];                        ///< The underlying array to hold the actual message data.
+        size_t  msglen;                                 ///< The number of bytes used in msgarr.
+
+    private:
+        // check if variable-length field is a blob
+        static constexpr bool is_blob(size_t index);
+
+        // find position of variable-length field
+        size_t field_pos(size_t index) const;
+
+        // number of bytes of variable-length field at frame+pos, must end before frame+end
+        static size_t field_size(const uint8_t * frame, size_t pos, size_t end, bool blob);
+};
+
+// include implementation file
+#include "ByteMessageVariable.hpp"
+
+#endif
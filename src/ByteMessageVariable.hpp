@@ -0,0 +1,503 @@
+/**
+ * @file    ByteMessageVariable.hpp
+ * @brief   Implementation file for the ByteMessageVariable class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageVariable_hpp License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h> // needed for memcpy(), memmove()
+
+/* member functions of ByteMessageTrailerChecksum */
+
+/**
+ * @brief      Calculate a trailer checksum, but do not store it.
+ * @param      msg
+ *             Pointer to the beginning of the frame.
+ * @param      length
+ *             Length of the frame, including the checksum.
+ * @return     The checksum over the first length-size bytes.
+ */
+template <class T, T (*FUNC)(const uint8_t*, size_t)>
+T ByteMessageTrailerChecksum<T, FUNC>::calc(const uint8_t * msg, size_t length) {
+    return FUNC(msg, length - size);
+}
+
+/**
+ * @brief      Get the stored value of a trailer checksum.
+ * @param      msg
+ *             Pointer to the beginning of the frame.
+ * @param      length
+ *             Length of the frame, including the checksum.
+ * @return     The checksum stored in the last size bytes.
+ */
+template <class T, T (*FUNC)(const uint8_t*, size_t)>
+T ByteMessageTrailerChecksum<T, FUNC>::get(const uint8_t * msg, size_t length) {
+    return ByteMessageFieldCodec<T>::decode(msg + length - size);
+}
+
+/**
+ * @brief      Calculate a trailer checksum and store it in the last size bytes.
+ * @param      msg
+ *             Pointer to the beginning of the frame.
+ * @param      length
+ *             Length of the frame, including the checksum.
+ */
+template <class T, T (*FUNC)(const uint8_t*, size_t)>
+void ByteMessageTrailerChecksum<T, FUNC>::update(uint8_t * msg, size_t length) {
+    ByteMessageFieldCodec<T>::encode(msg + length - size, calc(msg, length));
+}
+
+/**
+ * @brief      Check a trailer checksum.
+ * @param      msg
+ *             Pointer to the beginning of the frame.
+ * @param      length
+ *             Length of the frame, including the checksum.
+ * @return     true if stored and calculated checksum are the same, false otherwise.
+ */
+template <class T, T (*FUNC)(const uint8_t*, size_t)>
+bool ByteMessageTrailerChecksum<T, FUNC>::check(const uint8_t * msg, size_t length) {
+    return get(msg, length) == calc(msg, length);
+}
+
+/* member functions of ByteMessageVariable */
+
+// implement default constructor (without parameters)
+/**
+ * @brief  The default constructor.
+ * @note   Sets type automatically. All header bytes are zero, all varints
+ *         are zero (one byte each), i.e. length() == min_size.
+ */
+template <uint8_t TYPE, size_t MAXSIZE, size_t HEADER, size_t FIELDS, size_t TRAILER, uint32_t BLOBS>
+ByteMessageVariable<TYPE, MAXSIZE, HEADER, FIELDS, TRAILER, BLOBS>::ByteMessageVariable(void)
+    : msgarr{0}, msglen{min_size} {
+    msgarr[0] = TYPE;
+}
+
+// implement constructor without initialization
+/**
+ * @brief  Constructor which leaves header and trailer uninitialized.
+ * @note   Sets type automatically. All variable-length fields are set to
+ *         zero (one byte each), so the frame structure is valid. Header 
+ *         and trailer bytes have unspecified values until they are 
+ *         written, e.g. with populate().
+ */
+template <uint8_t TYPE, size_t MAXSIZE, size_t HEADER, size_t FIELDS, size_t TRAILER, uint32_t BLOBS>
+ByteMessageVariable<TYPE, MAXSIZE, HEADER, FIELDS, TRAILER, BLOBS>::ByteMessageVariable(ByteMessageUninitialized)
+    : msglen{min_size} {
+    msgarr[0] = TYPE;
+    memset(msgarr + HEADER, 0, FIELDS);
+}
+
+// implement copy constructor
+/**
+ * @brief  The copy constructor
+ * @param  bm
+ *         A reference to a ByteMessageVariable object.
+ * @note   Copies the used part of the array msgarr.
+ */
+template <uint8_t TYPE, size_t MAXSIZE, size_t HEADER, size_t FIELDS, size_t TRAILER, uint32_t BLOBS>
+ByteMessageVariable<TYPE, MAXSIZE, HEADER, FIELDS, TRAILER, BLOBS>::ByteMessageVariable(const ByteMessageVariable &bm)
+    : msglen{bm.msglen} {
+    memcpy(msgarr, bm.msgarr, msglen);
+}
+
+// implement assignment operator
+/**
+ * @brief  The copy-assignment operator 
+ * @param  bm
+ *         A reference to a ByteMessageVariable object.
+ * @return A reference to a ByteMessageVariable object.
+ * @note   Unlike ByteMessage::operator=, this copies the frame. Fields of
+ *         variable messages are static members, so derived classes have
+ *         nothing to copy themselves.
+ */
+template <uint8_t TYPE, size_t MAXSIZE, size_t HEADER, size_t FIELDS, size_t TRAILER, uint32_t BLOBS>
+ByteMessageVariable<TYPE, MAXSIZE, HEADER, FIELDS, TRAILER, BLOBS>& ByteMessageVariable<TYPE, MAXSIZE, HEADER, FIELDS, TRAILER, BLOBS>::operator= (const ByteMessageVariable &bm) {
+    if (this == &bm) return *this;
+    msglen = bm.msglen;
+    memcpy(msgarr, bm.msgarr, msglen);
+    return *this;
+}
+
+// implement read-only subscript operator
+/**
+ * @brief   Read-only subscript operator
+ * @param   index
+ *          The index into the underlying array.
+ * @return  A constant reference to the element in the underlying array,
+ *          or to a constant containing zero if index >= length().
+ */
+template <uint8_t TYPE, size_t MAXSIZE, size_t HEADER, size_t FIELDS, size_t TRAILER, uint32_t BLOBS>
+const uint8_t& ByteMessageVariable<TYPE, MAXSIZE, HEADER, FIELDS, TRAILER, BLOBS>::operator[] (size_t index) const {
+    BM_ASSERT_INDEX(index, msglen);
+    // select the address instead of branching
+    return *((index < msglen) ? msgarr + index : &bm_zero_byte);
+}
+
+// implement length()
+/**
+ * @brief  Get the current length of the frame.
+ * @return The number of bytes used, between min_size and max_size.
+ */
+template <uint8_t TYPE, size_t MAXSIZE, size_t HEADER, size_t FIELDS, size_t TRAILER, uint32_t BLOBS>
+size_t ByteMessageVariable<TYPE, MAXSIZE, HEADER, FIELDS, TRAILER, BLOBS>::length(void) const {
+    return msglen;
+}
+
+// implement get_ptr()
+/**
+ * @brief  Get a pointer to the underlying array. 
+ * @return A pointer to the underlying array. Only the first length()
+ *         bytes are part of the frame.
+ */
+template <uint8_t TYPE, size_t MAXSIZE, size_t HEADER, size_t FIELDS, size_t TRAILER, uint32_t BLOBS>
+const uint8_t* ByteMessageVariable<TYPE, MAXSIZE, HEADER, FIELDS, TRAILER, BLOBS>::get_ptr(void) const {
+    return msgarr;
+}
+
+// implement span()
+/**
+ * @brief  Get an unchecked read-only span of the frame.
+ * @details The subscript operator of the span does not check the index
+ *         (unless BM_DEBUG_BOUNDS is defined).
+ * @return A span of the first length() bytes of the underlying array.
+ */
+template <uint8_t TYPE, size_t MAXSIZE, size_t HEADER, size_t FIELDS, size_t TRAILER, uint32_t BLOBS>
+ByteMessageSpan<const uint8_t> ByteMessageVariable<TYPE, MAXSIZE, HEADER, FIELDS, TRAILER, BLOBS>::span(void) const {
+    return ByteMessageSpan<const uint8_t>{msgarr, msglen};
+}
+
+// implement populate()
+/**
+ * @brief  Populate the message with data from an array.
+ * @param  raw_message
+ *         A pointer to a uint8_t array to copy the data from.
+ * @param  message_size
+ *         The number of bytes to copy from raw_message.
+ * @return true if contents of raw_message were successfully copied to
+ *         the object, false otherwise. If false, the object was changed 
+ *         in no way.
+ * @note   The first byte in raw_message must reflect the correct type,
+ *         and the header, exactly FIELDS valid variable-length fields and 
+ *         the trailer must fill exactly message_size bytes. The checksum is not 
+ *         verified, use check() for that.
+ */
+template <uint8_t TYPE, size_t MAXSIZE, size_t HEADER, size_t FIELDS, size_t TRAILER, uint32_t BLOBS>
+bool ByteMessageVariable<TYPE, MAXSIZE, HEADER, FIELDS, TRAILER, BLOBS>::populate(const uint8_t * raw_message, size_t message_size) {
+    if ( (message_size < min_size) || (message_size > MAXSIZE) ) {
+        bm_stats_count(TYPE, &ByteMessageStatsSnapshot::populate_size_rejects);
+        return false;
+    }
+    if (*raw_message != TYPE) {
+        bm_stats_count(TYPE, &ByteMessageStatsSnapshot::populate_type_rejects);
+        return false;
+    }
+    // check structure in place, do not touch msgarr before the frame is known to be valid
+    // (fields which do not fill the frame exactly are a wrong size as well)
+    const size_t end = message_size - TRAILER;
+    size_t pos = HEADER;
+    for (size_t i = 0; i < FIELDS; i++) {
+        const size_t n = field_size(raw_message, pos, end, is_blob(i));
+        if (n == 0) {
+            bm_stats_count(TYPE, &ByteMessageStatsSnapshot::populate_size_rejects);
+            return false;
+        }
+        pos += n;
+    }
+    if (pos != end) {
+        bm_stats_count(TYPE, &ByteMessageStatsSnapshot::populate_size_rejects);
+        return false;
+    }
+    memcpy(msgarr, raw_message, message_size);
+    msglen = message_size;
+    bm_stats_count(TYPE, &ByteMessageStatsSnapshot::populate_ok);
+    return true;
+}
+
+// implement get() for compile-time fields in header
+/**
+ * @brief  Get the value of a compile-time field in the header.
+ * @param  field
+ *         A ByteMessageField<T, POS>, usually a static constexpr member
+ *         of the derived class.
+ * @return The value stored in the message for this field.
+ * @note   Fields which do not fit into the header are rejected at compile time.
+ */
+template <uint8_t TYPE, size_t MAXSIZE, size_t HEADER, size_t FIELDS, size_t TRAILER, uint32_t BLOBS>
+template <class FIELD>
+typename FIELD::value_type ByteMessageVariable<TYPE, MAXSIZE, HEADER, FIELDS, TRAILER, BLOBS>::get(const FIELD &) const {
+    static_assert(FIELD::pos > 0 && FIELD::pos + FIELD::size <= HEADER, "field does not fit into the header");
+    return FIELD::get(msgarr);
+}
+
+// implement set() for compile-time fields in header
+/**
+ * @brief  Set the value of a compile-time field in the header.
+ * @param  field
+ *         A ByteMessageField<T, POS>, usually a static constexpr member
+ *         of the derived class.
+ * @param  value
+ *         The value to write.
+ * @note   Fields which do not fit into the header are rejected at compile time.
+ */
+template <uint8_t TYPE, size_t MAXSIZE, size_t HEADER, size_t FIELDS, size_t TRAILER, uint32_t BLOBS>
+template <class FIELD>
+void ByteMessageVariable<TYPE, MAXSIZE, HEADER, FIELDS, TRAILER, BLOBS>::set(const FIELD &, typename FIELD::value_type value) {
+    static_assert(FIELD::pos > 0 && FIELD::pos + FIELD::size <= HEADER, "field does not fit into the header");
+    FIELD::set(msgarr, value);
+}
+
+// implement get() for varint fields
+/**
+ * @brief  Get the value of a varint field.
+ * @param  field
+ *         A ByteMessageVarintField<T, INDEX>, usually a static constexpr 
+ *         member of the derived class.
+ * @return The decoded value.
+ */
+template <uint8_t TYPE, size_t MAXSIZE, size_t HEADER, size_t FIELDS, size_t TRAILER, uint32_t BLOBS>
+template <class T, size_t INDEX>
+T ByteMessageVariable<TYPE, MAXSIZE, HEADER, FIELDS, TRAILER, BLOBS>::get(const ByteMessageVarintField<T, INDEX> &) const {
+    static_assert(INDEX < FIELDS && !is_blob(INDEX), "field INDEX is a blob, not a varint");
+    using wire_type = typename ByteMessageVarintField<T, INDEX>::wire_type;
+    const size_t pos = field_pos(INDEX);
+    wire_type value = 0;
+    bm_varint_decode(msgarr + pos, msglen - TRAILER - pos, value);
+    return ByteMessageVarintCodec<T>::from_wire(value);
+}
+
+// implement set() for varint fields
+/**
+ * @brief  Set the value of a varint field.
+ * @param  field
+ *         A ByteMessageVarintField<T, INDEX>, usually a static constexpr 
+ *         member of the derived class.
+ * @param  value
+ *         The value to write.
+ * @return true if the value was written, false if the frame would grow
+ *         beyond MAXSIZE. If false, the message is not changed.
+ * @note   All following bytes are moved if the length of the encoded 
+ *         value changes. Call update() for the checksum afterwards.
+ */
+template <uint8_t TYPE, size_t MAXSIZE, size_t HEADER, size_t FIELDS, size_t TRAILER, uint32_t BLOBS>
+template <class T, size_t INDEX>
+bool ByteMessageVariable<TYPE, MAXSIZE, HEADER, FIELDS, TRAILER, BLOBS>::set(const ByteMessageVarintField<T, INDEX> &, typename ByteMessageVarintField<T, INDEX>::value_type value) {
+    static_assert(INDEX < FIELDS && !is_blob(INDEX), "field INDEX is a blob, not a varint");
+    uint8_t encoded[ByteMessageVarintField<T, INDEX>::max_size];
+    const size_t new_size = bm_varint_encode(encoded, ByteMessageVarintCodec<T>::to_wire(value));
+    const size_t pos = field_pos(INDEX);
+    const size_t old_size = bm_varint_skip(msgarr + pos, msglen - TRAILER - pos);
+    if (msglen - old_size + new_size > MAXSIZE) {
+        return false;
+    }
+    if (new_size != old_size) {
+        memmove(msgarr + pos + new_size, msgarr + pos + old_size, msglen - pos - old_size);
+        msglen = msglen - old_size + new_size;
+    }
+    memcpy(msgarr + pos, encoded, new_size);
+    return true;
+}
+
+// implement calc() for trailer checksums
+/**
+ * @brief  Calculate the trailer checksum, but do not store it.
+ * @param  checksum
+ *         A ByteMessageTrailerChecksum<T, FUNC>, usually a static constexpr
+ *         member of the derived class.
+ * @return The calculated checksum.
+ */
+template <uint8_t TYPE, size_t MAXSIZE, size_t HEADER, size_t FIELDS, size_t TRAILER, uint32_t BLOBS>
+template <class CHECKSUM>
+typename CHECKSUM::value_type ByteMessageVariable<TYPE, MAXSIZE, HEADER, FIELDS, TRAILER, BLOBS>::calc(const CHECKSUM &) const {
+    static_assert(CHECKSUM::size == TRAILER, "the checksum must fill the trailer");
+    return CHECKSUM::calc(msgarr, msglen);
+}
+
+// implement update() for trailer checksums
+/**
+ * @brief  Calculate the trailer checksum and store it.
+ * @param  checksum
+ *         A ByteMessageTrailerChecksum<T, FUNC>, usually a static constexpr
+ *         member of the derived class.
+ * @note   Call update() after all fields have been set.
+ */
+template <uint8_t TYPE, size_t MAXSIZE, size_t HEADER, size_t FIELDS, size_t TRAILER, uint32_t BLOBS>
+template <class CHECKSUM>
+void ByteMessageVariable<TYPE, MAXSIZE, HEADER, FIELDS, TRAILER, BLOBS>::update(const CHECKSUM &) {
+    static_assert(CHECKSUM::size == TRAILER, "the checksum must fill the trailer");
+    CHECKSUM::update(msgarr, msglen);
+}
+
+// implement check() for trailer checksums
+/**
+ * @brief  Check the trailer checksum.
+ * @param  checksum
+ *         A ByteMessageTrailerChecksum<T, FUNC>, usually a static constexpr
+ *         member of the derived class.
+ * @return true if the stored checksum matches the calculated checksum.
+ */
+template <uint8_t TYPE, size_t MAXSIZE, size_t HEADER, size_t FIELDS, size_t TRAILER, uint32_t BLOBS>
+template <class CHECKSUM>
+bool ByteMessageVariable<TYPE, MAXSIZE, HEADER, FIELDS, TRAILER, BLOBS>::check(const CHECKSUM &) const {
+    static_assert(CHECKSUM::size == TRAILER, "the checksum must fill the trailer");
+    return CHECKSUM::check(msgarr, msglen);
+}
+
+// implement set() for length-prefixed blobs
+/**
+ * @brief  Copy data into a length-prefixed blob.
+ * @param  blob
+ *         A ByteMessagePrefixedBlob<INDEX, MAXLEN>, usually a static 
+ *         constexpr member of the derived class.
+ * @param  data
+ *         Pointer to array of bytes to copy into the blob.
+ * @param  length
+ *         Number of bytes to copy from data.
+ * @return Number of bytes copied. This is less than length if length > 
+ *         MAXLEN or if the frame would grow beyond MAXSIZE. Check the 
+ *         return value!
+ * @note   Only the bytes copied are part of the frame, there is no zero 
+ *         padding. All following bytes are moved if the length of the 
+ *         blob changes. Call update() for the checksum afterwards.
+ */
+template <uint8_t TYPE, size_t MAXSIZE, size_t HEADER, size_t FIELDS, size_t TRAILER, uint32_t BLOBS>
+template <size_t INDEX, size_t MAXLEN>
+size_t ByteMessageVariable<TYPE, MAXSIZE, HEADER, FIELDS, TRAILER, BLOBS>::set(const ByteMessagePrefixedBlob<INDEX, MAXLEN> &, const uint8_t * data, size_t length) {
+    static_assert(INDEX < FIELDS && is_blob(INDEX), "set the bit for this blob in BLOBS");
+    const size_t pos = field_pos(INDEX);
+    const size_t old_size = field_size(msgarr, pos, msglen - TRAILER, true);
+    // bytes available for length prefix and data
+    const size_t available = MAXSIZE - (msglen - old_size);
+    size_t room = available - bm_varint_size(available);
+    if (bm_varint_size(room+1) + room + 1 <= available) {
+        room++;
+    }
+    if (length > MAXLEN) length = MAXLEN;
+    if (length > room) length = room;
+    uint8_t prefix[bm_varint_max_size<size_t>()];
+    const size_t prefix_size = bm_varint_encode(prefix, length);
+    const size_t new_size = prefix_size + length;
+    if (new_size != old_size) {
+        memmove(msgarr + pos + new_size, msgarr + pos + old_size, msglen - pos - old_size);
+        msglen = msglen - old_size + new_size;
+    }
+    memcpy(msgarr + pos, prefix, prefix_size);
+    memcpy(msgarr + pos + prefix_size, data, length);
+    return length;
+}
+
+// implement get() for length-prefixed blobs
+/**
+ * @brief  Copy data from a length-prefixed blob to an existing array.
+ * @param  blob
+ *         A ByteMessagePrefixedBlob<INDEX, MAXLEN>, usually a static 
+ *         constexpr member of the derived class.
+ * @param  data
+ *         Pointer to an array of uint8_t to copy the bytes to.
+ * @param  length
+ *         The maximum number of bytes to copy.
+ * @return Number of bytes which were actually copied to data.
+ */
+template <uint8_t TYPE, size_t MAXSIZE, size_t HEADER, size_t FIELDS, size_t TRAILER, uint32_t BLOBS>
+template <size_t INDEX, size_t MAXLEN>
+size_t ByteMessageVariable<TYPE, MAXSIZE, HEADER, FIELDS, TRAILER, BLOBS>::get(const ByteMessagePrefixedBlob<INDEX, MAXLEN> &blob, uint8_t * data, size_t length) const {
+    const size_t stored = this->length(blob);
+    if (length > stored) length = stored;
+    memcpy(data, get_ptr(blob), length);
+    return length;
+}
+
+// implement length() for length-prefixed blobs
+/**
+ * @brief  Get the number of bytes stored in a length-prefixed blob.
+ * @param  blob
+ *         A ByteMessagePrefixedBlob<INDEX, MAXLEN>, usually a static 
+ *         constexpr member of the derived class.
+ * @return The number of data bytes, without the length prefix.
+ */
+template <uint8_t TYPE, size_t MAXSIZE, size_t HEADER, size_t FIELDS, size_t TRAILER, uint32_t BLOBS>
+template <size_t INDEX, size_t MAXLEN>
+size_t ByteMessageVariable<TYPE, MAXSIZE, HEADER, FIELDS, TRAILER, BLOBS>::length(const ByteMessagePrefixedBlob<INDEX, MAXLEN> &) const {
+    static_assert(INDEX < FIELDS && is_blob(INDEX), "set the bit for this blob in BLOBS");
+    const size_t pos = field_pos(INDEX);
+    size_t stored = 0;
+    bm_varint_decode(msgarr + pos, msglen - TRAILER - pos, stored);
+    return stored;
+}
+
+// implement get_ptr() for length-prefixed blobs
+/**
+ * @brief  Get read-only access to the data of a length-prefixed blob.
+ * @param  blob
+ *         A ByteMessagePrefixedBlob<INDEX, MAXLEN>, usually a static 
+ *         constexpr member of the derived class.
+ * @return A pointer to the first data byte (after the length prefix).
+ * @warning Only length(blob) bytes belong to the blob.
+ */
+template <uint8_t TYPE, size_t MAXSIZE, size_t HEADER, size_t FIELDS, size_t TRAILER, uint32_t BLOBS>
+template <size_t INDEX, size_t MAXLEN>
+const uint8_t* ByteMessageVariable<TYPE, MAXSIZE, HEADER, FIELDS, TRAILER, BLOBS>::get_ptr(const ByteMessagePrefixedBlob<INDEX, MAXLEN> &) const {
+    static_assert(INDEX < FIELDS && is_blob(INDEX), "set the bit for this blob in BLOBS");
+    const size_t pos = field_pos(INDEX);
+    return msgarr + pos + bm_varint_skip(msgarr + pos, msglen - TRAILER - pos);
+}
+
+/** @cond variable_internals */
+// check if bit index is set in BLOBS
+template <uint8_t TYPE, size_t MAXSIZE, size_t HEADER, size_t FIELDS, size_t TRAILER, uint32_t BLOBS>
+constexpr bool ByteMessageVariable<TYPE, MAXSIZE, HEADER, FIELDS, TRAILER, BLOBS>::is_blob(size_t index) {
+    return (index < 32) && ((BLOBS >> index) & 1);
+}
+
+// find position of variable-length field by skipping all fields before it
+// Note: The frame is always valid (see constructor and populate()), so 
+// field_size() cannot fail here.
+template <uint8_t TYPE, size_t MAXSIZE, size_t HEADER, size_t FIELDS, size_t TRAILER, uint32_t BLOBS>
+size_t ByteMessageVariable<TYPE, MAXSIZE, HEADER, FIELDS, TRAILER, BLOBS>::field_pos(size_t index) const {
+    size_t pos = HEADER;
+    for (size_t i = 0; i < index; i++) {
+        pos += field_size(msgarr, pos, msglen - TRAILER, is_blob(i));
+    }
+    return pos;
+}
+
+// number of bytes of variable-length field at frame+pos, 0 if it does not end before frame+end
+template <uint8_t TYPE, size_t MAXSIZE, size_t HEADER, size_t FIELDS, size_t TRAILER, uint32_t BLOBS>
+size_t ByteMessageVariable<TYPE, MAXSIZE, HEADER, FIELDS, TRAILER, BLOBS>::field_size(const uint8_t * frame, size_t pos, size_t end, bool blob) {
+    if (!blob) {
+        return bm_varint_skip(frame + pos, end - pos);
+    }
+    size_t stored = 0;
+    const size_t n = bm_varint_decode(frame + pos, end - pos, stored);
+    if (n == 0 || stored > end - pos - n) {
+        return 0;
+    }
+    return n + stored;
+}
+/** @endcond */
@@ -0,0 +1,53 @@
+/**
+ * @file    ByteMessageVarint.cpp
+ * @brief   Implementation file for variable-length integer fields
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageVarint_cpp License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ByteMessageVarint.h"
+
+// implement bm_varint_skip()
+/**
+ * @brief  Find the length of a varint without decoding it.
+ * @param  src
+ *         The byte array.
+ * @param  length
+ *         The number of bytes available at src.
+ * @return The number of bytes of the varint at src, or 0 if it is 
+ *         truncated or longer than 10 bytes (the maximum for uint64_t).
+ */
+size_t bm_varint_skip(const uint8_t * src, size_t length) {
+    constexpr size_t max_size = bm_varint_max_size<uint64_t>();
+    for (size_t n = 0; n < length && n < max_size; n++) {
+        if ((src[n] & 0x80) == 0) {
+            return n+1;
+        }
+    }
+    return 0;
+}
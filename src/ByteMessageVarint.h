@@ -0,0 +1,105 @@
+/**
+ * @file    ByteMessageVarint.h
+ * @brief   Header file for variable-length integer fields
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageVarint_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ByteMessageVarint_h
+#define ByteMessageVarint_h
+
+#include <stdint.h> // needed for fixed-size data types
+#include <stddef.h> // needed for size_t data type
+
+/* Note: This header file also includes the complete implementation from ByteMessageVarint.hpp! */
+
+/* 
+ * Important points:
+ * - Integers are encoded as base 128 varints (like in Protocol Buffers):
+ *   7 bits per byte, least significant group first, the most significant 
+ *   bit of each byte is set if more bytes follow. Values 0...127 take a
+ *   single byte, a uint32_t takes at most 5 bytes, a uint64_t at most 10.
+ * - Signed integers are zigzag-encoded first (0, -1, 1, -2, 2, ... are 
+ *   mapped to 0, 1, 2, 3, 4, ...), so small negative values are short, too.
+ * - ByteMessageVarintField<T, INDEX> has no data members. It is the 
+ *   INDEX-th variable-length field of a ByteMessageVariable (see 
+ *   ByteMessageVariable.h), whose position depends on the lengths of all 
+ *   varint fields before it.
+ * - The free functions bm_varint_encode() / bm_varint_decode() can also 
+ *   be used on their own.
+ */
+
+/* declaration of codec template */
+/**
+ * @class   ByteMessageVarintCodec
+ * @brief   Mapping between integer values and the unsigned values encoded as varint.
+ * @details wire_type is the unsigned type of the same size as T. to_wire()
+ *          and from_wire() are the identity for unsigned types and the 
+ *          zigzag mapping for signed types.
+ * @note    The codec only exists for the following data types: uint8_t, 
+ *          uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t.
+ */
+template <class T>
+struct ByteMessageVarintCodec;
+
+// largest number of bytes of a varint of unsigned type U
+template <class U> constexpr size_t bm_varint_max_size(void);
+
+// number of bytes of the varint for value
+template <class U> constexpr size_t bm_varint_size(U value);
+
+// write value as varint to dst, return number of bytes written
+template <class U> size_t bm_varint_encode(uint8_t * dst, U value);
+
+// read varint from at most length bytes at src, return number of bytes read or 0 on error
+template <class U> size_t bm_varint_decode(const uint8_t * src, size_t length, U &value);
+
+// return length of varint at src (up to 10 bytes), 0 if there is no valid varint within length bytes
+size_t bm_varint_skip(const uint8_t * src, size_t length);
+
+/**
+ * @class   ByteMessageVarintField
+ * @brief   Variable-length integer field of a ByteMessageVariable.
+ * @details Declare as "static constexpr" member of a class derived from 
+ *          ByteMessageVariable and access it through the message, e.g.
+ *          msg.set(msg.counter, 42) and msg.get(msg.counter).
+ *          INDEX counts the varint fields of the message, starting at 0.
+ */
+template <class T, size_t INDEX>
+class ByteMessageVarintField final {
+    public:
+        using value_type = T;                                                   ///< The data type of the field.
+        using wire_type  = typename ByteMessageVarintCodec<T>::wire_type;       ///< Unsigned type encoded as varint.
+        static constexpr size_t index    = INDEX;                               ///< Index among the varint fields of the message.
+        static constexpr size_t max_size = bm_varint_max_size<wire_type>();     ///< Largest number of bytes of the encoded value.
+};
+
+// include implementation
+#include "ByteMessageVarint.hpp"
+
+#endif
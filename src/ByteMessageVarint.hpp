@@ -0,0 +1,139 @@
+/**
+ * @file    ByteMessageVarint.hpp
+ * @brief   Implementation file for variable-length integer fields
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageVarint_hpp License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/** @cond varint_codecs */
+
+// unsigned types are encoded as they are
+template <class T>
+struct ByteMessageVarintUnsignedCodec {
+    using wire_type = T;
+    static constexpr wire_type to_wire(T value) {
+        return value;
+    }
+    static constexpr T from_wire(wire_type value) {
+        return value;
+    }
+};
+
+// signed types are zigzag-encoded
+template <class T, class U>
+struct ByteMessageVarintZigzagCodec {
+    using wire_type = U;
+    static constexpr wire_type to_wire(T value) {
+        // arithmetic shift gives all ones for negative values, all zeros otherwise
+        return static_cast<U>(static_cast<U>(static_cast<U>(value) << 1) ^ static_cast<U>(value >> (8*sizeof(T)-1)));
+    }
+    static constexpr T from_wire(wire_type value) {
+        return static_cast<T>(static_cast<U>(value >> 1) ^ static_cast<U>(-static_cast<U>(value & 1)));
+    }
+};
+
+template <> struct ByteMessageVarintCodec<uint8_t>  : ByteMessageVarintUnsignedCodec<uint8_t>  {};
+template <> struct ByteMessageVarintCodec<uint16_t> : ByteMessageVarintUnsignedCodec<uint16_t> {};
+template <> struct ByteMessageVarintCodec<uint32_t> : ByteMessageVarintUnsignedCodec<uint32_t> {};
+template <> struct ByteMessageVarintCodec<uint64_t> : ByteMessageVarintUnsignedCodec<uint64_t> {};
+template <> struct ByteMessageVarintCodec<int8_t>   : ByteMessageVarintZigzagCodec<int8_t,  uint8_t>  {};
+template <> struct ByteMessageVarintCodec<int16_t>  : ByteMessageVarintZigzagCodec<int16_t, uint16_t> {};
+template <> struct ByteMessageVarintCodec<int32_t>  : ByteMessageVarintZigzagCodec<int32_t, uint32_t> {};
+template <> struct ByteMessageVarintCodec<int64_t>  : ByteMessageVarintZigzagCodec<int64_t, uint64_t> {};
+
+/** @endcond */
+
+// implement bm_varint_max_size()
+/**
+ * @brief  Largest number of bytes of a varint of unsigned type U.
+ * @return The number of bytes, i.e. ceil(bits/7).
+ */
+template <class U>
+constexpr size_t bm_varint_max_size(void) {
+    return (8*sizeof(U) + 6) / 7;
+}
+
+// implement bm_varint_size()
+/**
+ * @brief  Number of bytes of the varint encoding of a value.
+ * @param  value
+ *         The unsigned value.
+ * @return The number of bytes bm_varint_encode() writes for value.
+ */
+template <class U>
+constexpr size_t bm_varint_size(U value) {
+    // recursive instead of a loop, so the function is constexpr in C++11
+    return (value < 0x80) ? 1 : 1 + bm_varint_size<U>(static_cast<U>(value >> 7));
+}
+
+// implement bm_varint_encode()
+/**
+ * @brief  Write an unsigned value as varint.
+ * @param  dst
+ *         The byte array. Must hold bm_varint_max_size<U>() bytes.
+ * @param  value
+ *         The unsigned value. Use ByteMessageVarintCodec<T>::to_wire() 
+ *         for signed values.
+ * @return The number of bytes written.
+ */
+template <class U>
+size_t bm_varint_encode(uint8_t * dst, U value) {
+    size_t n = 0;
+    while (value >= 0x80) {
+        dst[n++] = static_cast<uint8_t>(value | 0x80);
+        value = static_cast<U>(value >> 7);
+    }
+    dst[n++] = static_cast<uint8_t>(value);
+    return n;
+}
+
+// implement bm_varint_decode()
+/**
+ * @brief  Read an unsigned value from a varint.
+ * @param  src
+ *         The byte array.
+ * @param  length
+ *         The number of bytes available at src.
+ * @param  value
+ *         Reference to store the decoded value in. Bits which do not fit 
+ *         into U are discarded. Only changed if decoding succeeds.
+ * @return The number of bytes read, or 0 if the varint is truncated or 
+ *         longer than bm_varint_max_size<U>() bytes.
+ */
+template <class U>
+size_t bm_varint_decode(const uint8_t * src, size_t length, U &value) {
+    U v = 0;
+    for (size_t n = 0; n < length && n < bm_varint_max_size<U>(); n++) {
+        v = static_cast<U>(v | static_cast<U>(static_cast<U>(src[n] & 0x7F) << (7*n)));
+        if ((src[n] & 0x80) == 0) {
+            value = v;
+            return n+1;
+        }
+    }
+    return 0;
+}
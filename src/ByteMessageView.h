@@ -0,0 +1,137 @@
+/**
+ * @file    ByteMessageView.h
+ * @brief   Header file for the ByteMessageView class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageView_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ByteMessageView_h
+#define ByteMessageView_h
+
+#include <stdint.h> // needed for fixed-size data types
+#include <stddef.h> // needed for size_t data type
+
+#include "ByteMessageSpan.h" // needed for bm_zero_byte and BM_ASSERT_INDEX
+
+/* Note: This header file also includes the complete implementation from ByteMessageView.hpp! */
+
+/* 
+ * Important points:
+ * - A view does not own any data. It only stores a pointer to a buffer
+ *   owned by somebody else (e.g. a DMA or UART receive buffer).
+ * - Attaching a view to a buffer checks type and size exactly like
+ *   ByteMessage::populate(), but nothing is copied.
+ * - Only compile-time fields and checksums (ByteMessageField<T, POS> and
+ *   ByteMessageChecksum<T, POS, FUNC>) can be accessed through a view.
+ *   Classic fields are bound to the array of a ByteMessage object.
+ * - ByteMessageView<MSG> allows reading and writing. 
+ *   ByteMessageView<const MSG> is read-only.
+ * - The buffer must outlive the view.
+ * - A detached view can be used safely: reads return zero, check() 
+ *   returns false and writes are ignored. Check with valid().
+ */
+
+/**
+ * @class   ByteMessageView
+ * @brief   Non-owning, mutable view of a message of type MSG in an external buffer.
+ * @details MSG must be a class derived from ByteMessage. Fields and checksums
+ *          are accessed with the same member functions as for ByteMessage
+ *          objects, e.g. view.get(Point3DCompact::x).
+ */
+template <class MSG>
+class ByteMessageView {
+
+    public:
+        ByteMessageView(void);                                        // create detached view
+        ByteMessageView(uint8_t * raw_message, size_t message_size);  // create view and attach it
+        const uint8_t& operator[](size_t index) const;                // read-only subscript operator
+
+        static constexpr uint8_t type = MSG::type;                    ///< The numeric type of the message.
+        static constexpr size_t  size = MSG::size;                    ///< The size of the viewed array.
+
+        // attach view to buffer if type and size match
+        bool attach(uint8_t * raw_message, size_t message_size);
+
+        // detach view from buffer
+        void detach(void);
+
+        // check if view is attached to a buffer
+        bool valid(void) const;
+
+        // return pointer to constant viewed data
+        const uint8_t* get_ptr(void) const;
+
+        // access compile-time fields
+        template <class FIELD> typename FIELD::value_type get(const FIELD &field) const;
+        template <class FIELD> void set(const FIELD &field, typename FIELD::value_type value);
+        template <class FIELD, class CHECKSUM> void set(const FIELD &field, typename FIELD::value_type value, const CHECKSUM &checksum);
+
+        // access compile-time checksums
+        template <class CHECKSUM> typename CHECKSUM::value_type calc(const CHECKSUM &checksum) const;
+        template <class CHECKSUM> void update(const CHECKSUM &checksum);
+        template <class CHECKSUM> bool check(const CHECKSUM &checksum) const;
+
+    private:
+        uint8_t * msgptr;                                             // pointer to viewed buffer, nullptr if detached
+};
+
+/** @cond class_specialization_const */
+/**
+ * @class   ByteMessageView<const MSG>
+ * @brief   Non-owning, read-only view of a message of type MSG in an external buffer.
+ */
+template <class MSG>
+class ByteMessageView<const MSG> {
+
+    public:
+        ByteMessageView(void);
+        ByteMessageView(const uint8_t * raw_message, size_t message_size);
+        ByteMessageView(const ByteMessageView<MSG> &view);            // a mutable view converts to a read-only view
+        const uint8_t& operator[](size_t index) const;
+
+        static constexpr uint8_t type = MSG::type;
+        static constexpr size_t  size = MSG::size;
+
+        bool attach(const uint8_t * raw_message, size_t message_size);
+        void detach(void);
+        bool valid(void) const;
+        const uint8_t* get_ptr(void) const;
+
+        template <class FIELD> typename FIELD::value_type get(const FIELD &field) const;
+        template <class CHECKSUM> typename CHECKSUM::value_type calc(const CHECKSUM &checksum) const;
+        template <class CHECKSUM> bool check(const CHECKSUM &checksum) const;
+
+    private:
+        const uint8_t * msgptr;
+};
+/** @endcond */
+
+// include implementation file
+#include "ByteMessageView.hpp"
+
+#endif
@@ -0,0 +1,312 @@
+/**
+ * @file    ByteMessageView.hpp
+ * @brief   Implementation file for the ByteMessageView class
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_ByteMessageView_hpp License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h> // needed for memcpy()
+
+/* member function definitions for mutable views */
+
+// implement default constructor
+/**
+ * @brief  The default constructor.
+ * @note   Creates a detached view. Call attach() before accessing data.
+ */
+template <class MSG>
+ByteMessageView<MSG>::ByteMessageView(void)
+    : msgptr{nullptr} {}
+
+// implement attaching constructor
+/**
+ * @brief  Create a view and attach it to a buffer.
+ * @param  raw_message
+ *         A pointer to a uint8_t array holding the message.
+ * @param  message_size
+ *         The number of bytes in raw_message.
+ * @note   The view is only attached if type and size match, see attach().
+ *         Check with valid() before accessing data.
+ */
+template <class MSG>
+ByteMessageView<MSG>::ByteMessageView(uint8_t * raw_message, size_t message_size)
+    : msgptr{nullptr} {
+    attach(raw_message, message_size);
+}
+
+// implement read-only subscript operator
+/**
+ * @brief   Read-only subscript operator
+ * @details Access the raw bytes of the viewed buffer like an array.
+ *          If you try to access an element by an out-of-bounds index, or
+ *          if the view is detached, a reference to a constant containing 
+ *          zero is returned.
+ * @param   index
+ *          The index into the viewed buffer.
+ * @return  A constant reference to the element in the viewed buffer.
+ */
+template <class MSG>
+const uint8_t& ByteMessageView<MSG>::operator[] (size_t index) const {
+    BM_ASSERT_INDEX(index, size);
+    // select the address instead of branching, detached views read as zero
+    return *((index < size && msgptr != nullptr) ? msgptr + index : &bm_zero_byte);
+}
+
+// implement attach()
+/**
+ * @brief  Attach view to a buffer.
+ * @param  raw_message
+ *         A pointer to a uint8_t array holding the message.
+ * @param  message_size
+ *         The number of bytes in raw_message.
+ * @return true if the view was attached to raw_message, false otherwise.
+ *         If false, the view was changed in no way.
+ * @note   Same rules as for ByteMessage::populate(): The number of bytes
+ *         must exactly match the size of MSG AND the first byte in
+ *         raw_message must reflect the correct type. No data is copied.
+ */
+template <class MSG>
+bool ByteMessageView<MSG>::attach(uint8_t * raw_message, size_t message_size) {
+    if ( (size != message_size) || (*raw_message != type) ) {
+        return false;
+    }
+    else {
+        msgptr = raw_message;
+        return true;
+    }
+}
+
+// implement detach()
+/**
+ * @brief  Detach view from buffer.
+ */
+template <class MSG>
+void ByteMessageView<MSG>::detach(void) {
+    msgptr = nullptr;
+}
+
+// implement valid()
+/**
+ * @brief  Check if the view is attached to a buffer.
+ * @return true if attached, false otherwise.
+ */
+template <class MSG>
+bool ByteMessageView<MSG>::valid(void) const {
+    return msgptr != nullptr;
+}
+
+// implement get_ptr()
+/**
+ * @brief  Get a pointer to the viewed buffer.
+ * @return A read-only pointer to the viewed buffer, nullptr if detached.
+ */
+template <class MSG>
+const uint8_t* ByteMessageView<MSG>::get_ptr(void) const {
+    return msgptr;
+}
+
+// implement get() for compile-time fields
+/**
+ * @brief  Get the value of a compile-time field (or checksum).
+ * @param  field
+ *         A ByteMessageField<T, POS> or ByteMessageChecksum<T, POS, FUNC>.
+ * @return The value stored in the viewed buffer for this field, 
+ *         a value-initialized value (i.e. zero) if the view is detached.
+ */
+template <class MSG>
+template <class FIELD>
+typename FIELD::value_type ByteMessageView<MSG>::get(const FIELD &) const {
+    static_assert(FIELD::pos > 0 && FIELD::pos + FIELD::size <= size, "field does not fit into the message");
+    if (msgptr == nullptr) return typename FIELD::value_type{};
+    return FIELD::get(msgptr);
+}
+
+// implement set() for compile-time fields
+/**
+ * @brief  Set the value of a compile-time field in the viewed buffer.
+ * @param  field
+ *         A ByteMessageField<T, POS>.
+ * @param  value
+ *         The value to write.
+ * @note   Does nothing if the view is detached.
+ */
+template <class MSG>
+template <class FIELD>
+void ByteMessageView<MSG>::set(const FIELD &, typename FIELD::value_type value) {
+    static_assert(FIELD::pos > 0 && FIELD::pos + FIELD::size <= size, "field does not fit into the message");
+    if (msgptr == nullptr) return;
+    FIELD::set(msgptr, value);
+}
+
+// implement set() for compile-time fields, with checksum patch
+/**
+ * @brief  Set the value of a compile-time field in the viewed buffer and patch a checksum.
+ * @param  field
+ *         A ByteMessageField<T, POS>.
+ * @param  value
+ *         The value to write.
+ * @param  checksum
+ *         A ByteMessageChecksum<T, POS, FUNC> whose stored value is
+ *         valid before the call.
+ * @note   Does nothing if the view is detached.
+ */
+template <class MSG>
+template <class FIELD, class CHECKSUM>
+void ByteMessageView<MSG>::set(const FIELD &, typename FIELD::value_type value, const CHECKSUM &) {
+    static_assert(FIELD::pos > 0 && FIELD::pos + FIELD::size <= size, "field does not fit into the message");
+    static_assert(CHECKSUM::pos > 0 && CHECKSUM::pos + CHECKSUM::size <= size, "checksum does not fit into the message");
+    if (msgptr == nullptr) return;
+    uint8_t old_data[FIELD::size];
+    memcpy(old_data, msgptr+FIELD::pos, FIELD::size);
+    FIELD::set(msgptr, value);
+    CHECKSUM::patch(msgptr, FIELD::pos, old_data, FIELD::size);
+}
+
+// implement calc() for compile-time checksums
+/**
+ * @brief  Calculate a compile-time checksum over the viewed buffer, but do not store it.
+ * @param  checksum
+ *         A ByteMessageChecksum<T, POS, FUNC>.
+ * @return The calculated checksum, zero if the view is detached.
+ */
+template <class MSG>
+template <class CHECKSUM>
+typename CHECKSUM::value_type ByteMessageView<MSG>::calc(const CHECKSUM &) const {
+    static_assert(CHECKSUM::pos > 0 && CHECKSUM::pos + CHECKSUM::size <= size, "checksum does not fit into the message");
+    if (msgptr == nullptr) return typename CHECKSUM::value_type{};
+    return CHECKSUM::calc(msgptr);
+}
+
+// implement update() for compile-time checksums
+/**
+ * @brief  Calculate a compile-time checksum and store it in the viewed buffer.
+ * @param  checksum
+ *         A ByteMessageChecksum<T, POS, FUNC>.
+ * @note   Does nothing if the view is detached.
+ */
+template <class MSG>
+template <class CHECKSUM>
+void ByteMessageView<MSG>::update(const CHECKSUM &) {
+    static_assert(CHECKSUM::pos > 0 && CHECKSUM::pos + CHECKSUM::size <= size, "checksum does not fit into the message");
+    if (msgptr == nullptr) return;
+    CHECKSUM::update(msgptr);
+}
+
+// implement check() for compile-time checksums
+/**
+ * @brief  Check if the (re-)calculated checksum matches the stored checksum.
+ * @param  checksum
+ *         A ByteMessageChecksum<T, POS, FUNC>.
+ * @return true if calculated and stored checksum match exacly, false otherwise
+ *         (including detached views).
+ */
+template <class MSG>
+template <class CHECKSUM>
+bool ByteMessageView<MSG>::check(const CHECKSUM &) const {
+    static_assert(CHECKSUM::pos > 0 && CHECKSUM::pos + CHECKSUM::size <= size, "checksum does not fit into the message");
+    if (msgptr == nullptr) return false;
+    return CHECKSUM::check(msgptr);
+}
+
+/** @cond class_specialization_const */
+
+/* member function definitions for read-only views */
+/* see mutable views above for documentation */
+
+template <class MSG>
+ByteMessageView<const MSG>::ByteMessageView(void)
+    : msgptr{nullptr} {}
+
+template <class MSG>
+ByteMessageView<const MSG>::ByteMessageView(const uint8_t * raw_message, size_t message_size)
+    : msgptr{nullptr} {
+    attach(raw_message, message_size);
+}
+
+template <class MSG>
+ByteMessageView<const MSG>::ByteMessageView(const ByteMessageView<MSG> &view)
+    : msgptr{view.get_ptr()} {}
+
+template <class MSG>
+const uint8_t& ByteMessageView<const MSG>::operator[] (size_t index) const {
+    BM_ASSERT_INDEX(index, size);
+    // select the address instead of branching, detached views read as zero
+    return *((index < size && msgptr != nullptr) ? msgptr + index : &bm_zero_byte);
+}
+
+template <class MSG>
+bool ByteMessageView<const MSG>::attach(const uint8_t * raw_message, size_t message_size) {
+    if ( (size != message_size) || (*raw_message != type) ) {
+        return false;
+    }
+    else {
+        msgptr = raw_message;
+        return true;
+    }
+}
+
+template <class MSG>
+void ByteMessageView<const MSG>::detach(void) {
+    msgptr = nullptr;
+}
+
+template <class MSG>
+bool ByteMessageView<const MSG>::valid(void) const {
+    return msgptr != nullptr;
+}
+
+template <class MSG>
+const uint8_t* ByteMessageView<const MSG>::get_ptr(void) const {
+    return msgptr;
+}
+
+template <class MSG>
+template <class FIELD>
+typename FIELD::value_type ByteMessageView<const MSG>::get(const FIELD &) const {
+    static_assert(FIELD::pos > 0 && FIELD::pos + FIELD::size <= size, "field does not fit into the message");
+    if (msgptr == nullptr) return typename FIELD::value_type{};
+    return FIELD::get(msgptr);
+}
+
+template <class MSG>
+template <class CHECKSUM>
+typename CHECKSUM::value_type ByteMessageView<const MSG>::calc(const CHECKSUM &) const {
+    static_assert(CHECKSUM::pos > 0 && CHECKSUM::pos + CHECKSUM::size <= size, "checksum does not fit into the message");
+    if (msgptr == nullptr) return typename CHECKSUM::value_type{};
+    return CHECKSUM::calc(msgptr);
+}
+
+template <class MSG>
+template <class CHECKSUM>
+bool ByteMessageView<const MSG>::check(const CHECKSUM &) const {
+    static_assert(CHECKSUM::pos > 0 && CHECKSUM::pos + CHECKSUM::size <= size, "checksum does not fit into the message");
+    if (msgptr == nullptr) return false;
+    return CHECKSUM::check(msgptr);
+}
+
+/** @endcond */
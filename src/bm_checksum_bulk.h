@@ -0,0 +1,382 @@
+/**
+ * @file    bm_checksum_bulk.h
+ * @brief   Internal header with word-at-a-time and SIMD helpers for checksum functions
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_bm_checksum_bulk_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef bulkChecksum_h
+#define bulkChecksum_h
+
+#include <stddef.h> // needed for size_t data type
+#include <stdint.h> // needed for fixed size integer data types
+#include <string.h> // needed for memcpy()
+
+/* 
+ * Important points:
+ * - This header is internal. It is only included by the bm_checksum_*.cpp 
+ *   files and does not declare any checksum functions itself.
+ * - The helpers process a prefix of the data in large chunks and return 
+ *   the number of bytes processed. This number is always a multiple of 8,
+ *   so the checksum functions can handle the remaining bytes with their 
+ *   regular code without changing the byte position within a word.
+ * - The implementation is selected at compile time:
+ *   - AVX2 (__AVX2__), SSE2 (__SSE2__) or NEON (__ARM_NEON) for 32 or 16 
+ *     byte chunks. Define BM_CHECKSUM_NO_SIMD to disable.
+ *   - portable 64-bit words for all targets with at least 32 bit pointers. 
+ *     Define BM_CHECKSUM_NO_WORDWISE to disable. 8 and 16 bit targets 
+ *     (e.g. AVR) always use the byte-by-byte code.
+ * - Results are bit-identical to the byte-by-byte code.
+ */
+
+/** @cond bulk_checksum_internals */
+
+#if !defined(BM_CHECKSUM_NO_SIMD)
+    #if defined(__AVX2__)
+        #define BM_CHECKSUM_AVX2
+    #endif
+    #if defined(__SSE2__)
+        #define BM_CHECKSUM_SSE2
+        #include <immintrin.h>
+    #endif
+    #if defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #define BM_CHECKSUM_NEON
+        #include <arm_neon.h>
+    #endif
+#endif
+
+#if !defined(BM_CHECKSUM_NO_WORDWISE) && (UINTPTR_MAX > 0xFFFF)
+    #define BM_CHECKSUM_WORDWISE
+#endif
+
+#if defined(BM_CHECKSUM_AVX2) || defined(BM_CHECKSUM_SSE2) || defined(BM_CHECKSUM_NEON) || defined(BM_CHECKSUM_WORDWISE)
+    #define BM_CHECKSUM_BULK ///< defined if any bulk implementation is available
+#endif
+
+#if defined(BM_CHECKSUM_BULK)
+
+// load 8 bytes in native byte order
+inline uint64_t bm_load_native64(const uint8_t * data) {
+    uint64_t v;
+    memcpy(&v, data, sizeof(uint64_t));
+    return v;
+}
+
+/*
+ * XOR together all bytes in complete chunks. After the call, lanes[i]
+ * additionally contains the XOR of all processed bytes at positions 
+ * p with p % 8 == i.
+ */
+inline size_t bm_bulk_xor_lanes(const uint8_t * data, size_t length, uint8_t lanes[8]) {
+    size_t done = 0;
+    #if defined(BM_CHECKSUM_AVX2)
+    if (length >= 32) {
+        __m256i acc = _mm256_setzero_si256();
+        for (; done + 32 <= length; done += 32) {
+            acc = _mm256_xor_si256(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + done)));
+        }
+        uint8_t tmp[32];
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(tmp), acc);
+        for (uint_fast8_t i = 0; i < 32; i++) lanes[i & 0x07] ^= tmp[i];
+    }
+    #endif
+    #if defined(BM_CHECKSUM_SSE2)
+    if (length - done >= 16) {
+        __m128i acc = _mm_setzero_si128();
+        for (; done + 16 <= length; done += 16) {
+            acc = _mm_xor_si128(acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + done)));
+        }
+        uint8_t tmp[16];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(tmp), acc);
+        for (uint_fast8_t i = 0; i < 16; i++) lanes[i & 0x07] ^= tmp[i];
+    }
+    #endif
+    #if defined(BM_CHECKSUM_NEON)
+    if (length - done >= 16) {
+        uint8x16_t acc = vdupq_n_u8(0);
+        for (; done + 16 <= length; done += 16) {
+            acc = veorq_u8(acc, vld1q_u8(data + done));
+        }
+        uint8_t tmp[16];
+        vst1q_u8(tmp, acc);
+        for (uint_fast8_t i = 0; i < 16; i++) lanes[i & 0x07] ^= tmp[i];
+    }
+    #endif
+    #if defined(BM_CHECKSUM_WORDWISE)
+    if (length - done >= 8) {
+        uint64_t acc = 0;
+        for (; done + 8 <= length; done += 8) {
+            acc ^= bm_load_native64(data + done);
+        }
+        // lanes are in memory order, independent of native byte order
+        uint8_t tmp[8];
+        memcpy(tmp, &acc, sizeof(uint64_t));
+        for (uint_fast8_t i = 0; i < 8; i++) lanes[i] ^= tmp[i];
+    }
+    #endif
+    return done;
+}
+
+/*
+ * Add all bytes in complete chunks to sum (exact sum, no modulus).
+ */
+inline size_t bm_bulk_byte_sum(const uint8_t * data, size_t length, uint64_t &sum) {
+    size_t done = 0;
+    #if defined(BM_CHECKSUM_AVX2)
+    if (length >= 32) {
+        const __m256i zero = _mm256_setzero_si256();
+        __m256i acc = zero; // four 64 bit lanes
+        for (; done + 32 <= length; done += 32) {
+            acc = _mm256_add_epi64(acc, _mm256_sad_epu8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + done)), zero));
+        }
+        uint64_t tmp[4];
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(tmp), acc);
+        sum += tmp[0] + tmp[1] + tmp[2] + tmp[3];
+    }
+    #endif
+    #if defined(BM_CHECKSUM_SSE2)
+    if (length - done >= 16) {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i acc = zero; // two 64 bit lanes
+        for (; done + 16 <= length; done += 16) {
+            acc = _mm_add_epi64(acc, _mm_sad_epu8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + done)), zero));
+        }
+        uint64_t tmp[2];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(tmp), acc);
+        sum += tmp[0] + tmp[1];
+    }
+    #endif
+    #if defined(BM_CHECKSUM_NEON)
+    if (length - done >= 16) {
+        uint64x2_t acc = vdupq_n_u64(0);
+        for (; done + 16 <= length; done += 16) {
+            acc = vpadalq_u32(acc, vpaddlq_u16(vpaddlq_u8(vld1q_u8(data + done))));
+        }
+        sum += vgetq_lane_u64(acc, 0) + vgetq_lane_u64(acc, 1);
+    }
+    #endif
+    #if defined(BM_CHECKSUM_WORDWISE)
+    constexpr uint64_t mask = 0x00FF00FF00FF00FF;
+    for (; done + 8 <= length; done += 8) {
+        const uint64_t w = bm_load_native64(data + done);
+        // add neighbouring bytes into four 16 bit lanes, then add lanes by multiplication
+        const uint64_t pairs = (w & mask) + ((w >> 8) & mask);
+        sum += (pairs * 0x0001000100010001) >> 48;
+    }
+    #endif
+    return done;
+}
+
+/*
+ * Add all bytes in complete chunks to pos[p % 8], p being the position
+ * of the byte (exact sums, no modulus). Any sum of big-endian words of
+ * up to 8 bytes can be derived from these eight sums.
+ * Bytes are added into 16 bit lanes (separately for even and odd 
+ * positions), which are flushed every 256 iterations before they can
+ * overflow (256 * 255 < 2^16).
+ */
+inline size_t bm_bulk_position_sums(const uint8_t * data, size_t length, uint64_t pos[8]) {
+    size_t done = 0;
+    #if ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+    // in little endian 16 bit lanes the byte at the even position is the low byte
+    #if defined(BM_CHECKSUM_AVX2)
+    if (length >= 32) {
+        const __m256i mask = _mm256_set1_epi16(0x00FF);
+        while (length - done >= 32) {
+            __m256i even = _mm256_setzero_si256();
+            __m256i odd  = _mm256_setzero_si256();
+            for (uint_fast16_t n = 0; n < 256 && done + 32 <= length; n++, done += 32) {
+                const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + done));
+                even = _mm256_add_epi16(even, _mm256_and_si256(v, mask));
+                odd  = _mm256_add_epi16(odd,  _mm256_srli_epi16(v, 8));
+            }
+            uint16_t tmp_even[16];
+            uint16_t tmp_odd[16];
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(tmp_even), even);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(tmp_odd), odd);
+            for (uint_fast8_t i = 0; i < 16; i++) {
+                pos[(2*i) & 0x07]   += tmp_even[i];
+                pos[(2*i+1) & 0x07] += tmp_odd[i];
+            }
+        }
+    }
+    #endif
+    #if defined(BM_CHECKSUM_SSE2)
+    if (length - done >= 16) {
+        const __m128i mask = _mm_set1_epi16(0x00FF);
+        while (length - done >= 16) {
+            __m128i even = _mm_setzero_si128();
+            __m128i odd  = _mm_setzero_si128();
+            for (uint_fast16_t n = 0; n < 256 && done + 16 <= length; n++, done += 16) {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + done));
+                even = _mm_add_epi16(even, _mm_and_si128(v, mask));
+                odd  = _mm_add_epi16(odd,  _mm_srli_epi16(v, 8));
+            }
+            uint16_t tmp_even[8];
+            uint16_t tmp_odd[8];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(tmp_even), even);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(tmp_odd), odd);
+            for (uint_fast8_t i = 0; i < 8; i++) {
+                pos[(2*i) & 0x07]   += tmp_even[i];
+                pos[(2*i+1) & 0x07] += tmp_odd[i];
+            }
+        }
+    }
+    #endif
+    #if defined(BM_CHECKSUM_NEON)
+    if (length - done >= 16) {
+        const uint16x8_t mask = vdupq_n_u16(0x00FF);
+        while (length - done >= 16) {
+            uint16x8_t even = vdupq_n_u16(0);
+            uint16x8_t odd  = vdupq_n_u16(0);
+            for (uint_fast16_t n = 0; n < 256 && done + 16 <= length; n++, done += 16) {
+                const uint16x8_t v = vreinterpretq_u16_u8(vld1q_u8(data + done));
+                even = vaddq_u16(even, vandq_u16(v, mask));
+                odd  = vaddq_u16(odd,  vshrq_n_u16(v, 8));
+            }
+            uint16_t tmp_even[8];
+            uint16_t tmp_odd[8];
+            vst1q_u16(tmp_even, even);
+            vst1q_u16(tmp_odd, odd);
+            for (uint_fast8_t i = 0; i < 8; i++) {
+                pos[(2*i) & 0x07]   += tmp_even[i];
+                pos[(2*i+1) & 0x07] += tmp_odd[i];
+            }
+        }
+    }
+    #endif
+    #endif // little endian
+    #if defined(BM_CHECKSUM_WORDWISE)
+    constexpr uint64_t mask = 0x00FF00FF00FF00FF;
+    while (length - done >= 8) {
+        uint64_t low  = 0; // four 16 bit lanes with sums of the low bytes
+        uint64_t high = 0; // four 16 bit lanes with sums of the high bytes
+        for (uint_fast16_t n = 0; n < 256 && done + 8 <= length; n++, done += 8) {
+            const uint64_t w = bm_load_native64(data + done);
+            low  += w & mask;
+            high += (w >> 8) & mask;
+        }
+        // 16 bit lanes are in memory order
+        uint16_t tmp_low[4];
+        uint16_t tmp_high[4];
+        memcpy(tmp_low, &low, sizeof(uint64_t));
+        memcpy(tmp_high, &high, sizeof(uint64_t));
+        for (uint_fast8_t i = 0; i < 4; i++) {
+            #if ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+                pos[2*i]   += tmp_low[i];
+                pos[2*i+1] += tmp_high[i];
+            #else
+                pos[2*i]   += tmp_high[i];
+                pos[2*i+1] += tmp_low[i];
+            #endif
+        }
+    }
+    #endif
+    return done;
+}
+
+/*
+ * Add all big-endian 16 bit words in complete chunks to sum, using 
+ * one's complement arithmetic. The result (folded to 16 bit) is 
+ * congruent modulo 0xFFFF to the plain sum of the words, and zero only
+ * if all processed bytes are zero.
+ * Note: The one's complement sum can be calculated in native byte order 
+ * and byte-swapped at the end (see RFC1071).
+ */
+inline size_t bm_bulk_onesum16(const uint8_t * data, size_t length, uint_fast32_t &sum) {
+    size_t done = 0;
+    uint64_t acc = 0; // sum in native byte order, with end-around carry
+    #if defined(BM_CHECKSUM_AVX2)
+    if (length >= 32) {
+        const __m256i zero = _mm256_setzero_si256();
+        while (length - done >= 32) {
+            // each 32 bit lane grows by at most 2*0xFFFF per iteration
+            __m256i acc32 = zero;
+            for (uint_fast16_t n = 0; n < 16384 && done + 32 <= length; n++, done += 32) {
+                const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + done));
+                acc32 = _mm256_add_epi32(acc32, _mm256_add_epi32(_mm256_unpacklo_epi16(v, zero), _mm256_unpackhi_epi16(v, zero)));
+            }
+            uint32_t tmp[8];
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(tmp), acc32);
+            for (uint_fast8_t i = 0; i < 8; i++) acc += tmp[i]; // cannot overflow
+        }
+    }
+    #endif
+    #if defined(BM_CHECKSUM_SSE2)
+    if (length - done >= 16) {
+        const __m128i zero = _mm_setzero_si128();
+        while (length - done >= 16) {
+            __m128i acc32 = zero;
+            for (uint_fast16_t n = 0; n < 16384 && done + 16 <= length; n++, done += 16) {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + done));
+                acc32 = _mm_add_epi32(acc32, _mm_add_epi32(_mm_unpacklo_epi16(v, zero), _mm_unpackhi_epi16(v, zero)));
+            }
+            uint32_t tmp[4];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(tmp), acc32);
+            for (uint_fast8_t i = 0; i < 4; i++) acc += tmp[i];
+        }
+    }
+    #endif
+    #if defined(BM_CHECKSUM_NEON)
+    if (length - done >= 16) {
+        while (length - done >= 16) {
+            uint32x4_t acc32 = vdupq_n_u32(0);
+            for (uint_fast16_t n = 0; n < 16384 && done + 16 <= length; n++, done += 16) {
+                acc32 = vpadalq_u16(acc32, vreinterpretq_u16_u8(vld1q_u8(data + done)));
+            }
+            acc += static_cast<uint64_t>(vgetq_lane_u32(acc32, 0)) + vgetq_lane_u32(acc32, 1) + 
+                   vgetq_lane_u32(acc32, 2) + vgetq_lane_u32(acc32, 3);
+        }
+    }
+    #endif
+    #if defined(BM_CHECKSUM_WORDWISE)
+    for (; done + 8 <= length; done += 8) {
+        const uint64_t w = bm_load_native64(data + done);
+        acc += w;
+        acc += (acc < w); // end-around carry
+    }
+    #endif
+    // fold 64 bit to 16 bit, 0xFFFF divides 2^64-1 and 2^32-1
+    acc = (acc >> 32) + (acc & 0xFFFFFFFF);
+    acc = (acc >> 32) + (acc & 0xFFFFFFFF);
+    while (acc >> 16) {
+        acc = (acc >> 16) + (acc & 0xFFFF);
+    }
+    #if ( __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+        acc = ((acc & 0xFF) << 8) | (acc >> 8);
+    #endif
+    sum += static_cast<uint_fast32_t>(acc);
+    return done;
+}
+
+#endif // BM_CHECKSUM_BULK
+
+/** @endcond */
+
+#endif
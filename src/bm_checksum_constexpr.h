@@ -0,0 +1,413 @@
+/**
+ * @file    bm_checksum_constexpr.h
+ * @brief   Header-only constexpr versions of all checksum functions
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_bm_checksum_constexpr_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef constexprChecksum_h
+#define constexprChecksum_h
+
+#if (__cplusplus < 201402L)
+    #error "bm_checksum_constexpr.h needs C++14 (constexpr functions with loops)"
+#endif
+
+#include <stddef.h> // needed for size_t data type
+#include <stdint.h> // needed for fixed size integer data types
+
+/* 
+ * Important points:
+ * - All functions in this file are constexpr, i.e. they can be evaluated
+ *   at compile time, e.g. to calculate the checksum of a constant frame 
+ *   (see ByteMessageConstant.h). All functions are implicitly inline, 
+ *   no .cpp file is needed.
+ * - Results are identical to the functions with the same name 
+ *   without the "_constexpr" suffix.
+ * - The functions are straightforward implementations, optimized for 
+ *   simplicity, not for speed. They can be used at run time, too, and
+ *   have the usual signature of checksum functions. Because their 
+ *   definition is always visible, the compiler may inline them when 
+ *   used as FUNC template parameter of ByteMessageChecksum.
+ * - The functions need C++14 (loops in constexpr functions).
+ */
+
+/** @cond constexpr_checksum_internals */
+
+// XOR over lanes of N bytes, big-endian, implicitly zero-padded
+template <class T, size_t N>
+constexpr T bm_xor_checksum_constexpr(const uint8_t * data, size_t length) {
+    T sum = 0;
+    for (size_t i = 0; i < length; i++) {
+        sum ^= static_cast<T>(static_cast<T>(data[i]) << (8 * (N - 1 - (i % N))));
+    }
+    return sum;
+}
+
+// two's complement sum of big-endian words of N bytes, implicitly zero-padded
+template <class T, size_t N>
+constexpr T bm_sum_checksum_constexpr(const uint8_t * data, size_t length) {
+    T sum = 0;
+    for (size_t i = 0; i < length; i++) {
+        sum += static_cast<T>(static_cast<T>(data[i]) << (8 * (N - 1 - (i % N))));
+    }
+    return sum;
+}
+
+// one's complement sum of big-endian words of N bytes, implicitly zero-padded
+// S must have at least twice the width of T
+template <class T, class S, size_t N>
+constexpr T bm_onesum_checksum_constexpr(const uint8_t * data, size_t length) {
+    constexpr S mask = static_cast<T>(~static_cast<T>(0));
+    S sum = 0;
+    for (size_t i = 0; i < length; i++) {
+        sum += static_cast<S>(data[i]) << (8 * (N - 1 - (i % N)));
+        sum = (sum >> (8 * N)) + (sum & mask);
+    }
+    return static_cast<T>(~static_cast<T>(sum));
+}
+
+// CRC of width W bits, bit by bit; for reflected CRCs, POLY is given reflected
+template <class T, uint_fast8_t W, T POLY, T INIT, T XOROUT, bool REFLECTED>
+constexpr T bm_crc_checksum_constexpr(const uint8_t * data, size_t length) {
+    constexpr T topbit = static_cast<T>(static_cast<T>(1) << (W - 1));
+    T crc = INIT;
+    for (size_t i = 0; i < length; i++) {
+        crc = REFLECTED ? static_cast<T>(crc ^ data[i]) : static_cast<T>(crc ^ (static_cast<T>(data[i]) << (W - 8)));
+        for (uint_fast8_t bit = 0; bit < 8; bit++) {
+            if (REFLECTED) {
+                crc = (crc & 0x01) ? static_cast<T>((crc >> 1) ^ POLY) : static_cast<T>(crc >> 1);
+            }
+            else {
+                crc = (crc & topbit) ? static_cast<T>((crc << 1) ^ POLY) : static_cast<T>(crc << 1);
+            }
+        }
+    }
+    return static_cast<T>(crc ^ XOROUT);
+}
+
+/** @endcond */
+
+/* XOR checksums */
+
+/**
+ * @brief   constexpr version of xor8_checksum()
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+constexpr uint8_t xor8_checksum_constexpr(const uint8_t * data, size_t length) {
+    return bm_xor_checksum_constexpr<uint8_t, 1>(data, length);
+}
+
+/**
+ * @brief   constexpr version of xor16_checksum()
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+constexpr uint16_t xor16_checksum_constexpr(const uint8_t * data, size_t length) {
+    return bm_xor_checksum_constexpr<uint16_t, 2>(data, length);
+}
+
+/**
+ * @brief   constexpr version of xor32_checksum()
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+constexpr uint32_t xor32_checksum_constexpr(const uint8_t * data, size_t length) {
+    return bm_xor_checksum_constexpr<uint32_t, 4>(data, length);
+}
+
+/**
+ * @brief   constexpr version of xor64_checksum()
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+constexpr uint64_t xor64_checksum_constexpr(const uint8_t * data, size_t length) {
+    return bm_xor_checksum_constexpr<uint64_t, 8>(data, length);
+}
+
+/* two's complement sums */
+
+/**
+ * @brief   constexpr version of sum8_checksum()
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+constexpr uint8_t sum8_checksum_constexpr(const uint8_t * data, size_t length) {
+    return bm_sum_checksum_constexpr<uint8_t, 1>(data, length);
+}
+
+/**
+ * @brief   constexpr version of sum16_checksum()
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+constexpr uint16_t sum16_checksum_constexpr(const uint8_t * data, size_t length) {
+    return bm_sum_checksum_constexpr<uint16_t, 2>(data, length);
+}
+
+/**
+ * @brief   constexpr version of sum32_checksum()
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+constexpr uint32_t sum32_checksum_constexpr(const uint8_t * data, size_t length) {
+    return bm_sum_checksum_constexpr<uint32_t, 4>(data, length);
+}
+
+/**
+ * @brief   constexpr version of sum64_checksum()
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+constexpr uint64_t sum64_checksum_constexpr(const uint8_t * data, size_t length) {
+    return bm_sum_checksum_constexpr<uint64_t, 8>(data, length);
+}
+
+/* one's complement sums */
+
+/**
+ * @brief   constexpr version of onesum8_checksum()
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+constexpr uint8_t onesum8_checksum_constexpr(const uint8_t * data, size_t length) {
+    return bm_onesum_checksum_constexpr<uint8_t, uint_fast16_t, 1>(data, length);
+}
+
+/**
+ * @brief   constexpr version of onesum16_checksum()
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+constexpr uint16_t onesum16_checksum_constexpr(const uint8_t * data, size_t length) {
+    return bm_onesum_checksum_constexpr<uint16_t, uint_fast32_t, 2>(data, length);
+}
+
+/**
+ * @brief   constexpr version of onesum32_checksum()
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+constexpr uint32_t onesum32_checksum_constexpr(const uint8_t * data, size_t length) {
+    return bm_onesum_checksum_constexpr<uint32_t, uint_fast64_t, 4>(data, length);
+}
+
+/* Fletcher's checksums */
+
+/**
+ * @brief   constexpr version of fletcher8_checksum()
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+constexpr uint8_t fletcher8_checksum_constexpr(const uint8_t * data, size_t length) {
+    uint_fast8_t sum1 = 0;
+    uint_fast8_t sum2 = 0;
+    for (size_t i = 0; i < length; i++) {
+        // most significant nibble first
+        sum1 = (sum1 + (data[i] >> 4)) % 15;
+        sum2 = (sum2 + sum1) % 15;
+        // least significant nibble last
+        sum1 = (sum1 + (data[i] & 0x0F)) % 15;
+        sum2 = (sum2 + sum1) % 15;
+    }
+    return static_cast<uint8_t>(sum2 << 4 | sum1);
+}
+
+/**
+ * @brief   constexpr version of fletcher16_checksum()
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+constexpr uint16_t fletcher16_checksum_constexpr(const uint8_t * data, size_t length) {
+    uint_fast16_t sum1 = 0;
+    uint_fast16_t sum2 = 0;
+    for (size_t i = 0; i < length; i++) {
+        sum1 = (sum1 + data[i]) % 255;
+        sum2 = (sum2 + sum1) % 255;
+    }
+    return static_cast<uint16_t>(sum2 << 8 | sum1);
+}
+
+/**
+ * @brief   constexpr version of fletcher32_checksum()
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum. If length
+ *          is uneven, data is implicity padded with a zero.
+ * @return  The checksum value
+ */
+constexpr uint32_t fletcher32_checksum_constexpr(const uint8_t * data, size_t length) {
+    uint_fast32_t sum1 = 0;
+    uint_fast32_t sum2 = 0;
+    for (size_t i = 0; i < length; i += 2) {
+        uint_fast32_t number16 = static_cast<uint_fast32_t>(data[i]) << 8;
+        if (i + 1 < length) number16 |= static_cast<uint_fast32_t>(data[i+1]);
+        sum1 = (sum1 + number16) % 65535;
+        sum2 = (sum2 + sum1) % 65535;
+    }
+    return static_cast<uint32_t>(sum2 << 16 | sum1);
+}
+
+/* Luhn's checksums */
+
+/**
+ * @brief   constexpr version of luhn_checksum()
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @param   base
+ *          The base for the calculation, 0 means 256.
+ * @return  The checksum value
+ * @note    Like for luhn_checksum(), all bytes must be valid digits, 
+ *          i.e. smaller than base. For other bytes the result matches
+ *          luhn_checksum_textbook().
+ */
+constexpr uint8_t luhn_checksum_constexpr(const uint8_t * data, size_t length, uint8_t base=10) {
+    const uint_fast16_t intbase = (base == 0) ? 256 : base;
+    uint_fast16_t sum = 0;
+    // the last (i.e. rightmost) byte is multiplied by 2
+    uint_fast16_t factor = 2;
+    for (size_t i = length; i > 0; i--) {
+        const uint_fast16_t addend = factor * static_cast<uint_fast16_t>(data[i-1]);
+        sum = (sum + (addend / intbase) + (addend % intbase)) % intbase;
+        factor = (factor == 2) ? 1 : 2;
+    }
+    return static_cast<uint8_t>( (intbase - sum) % intbase );
+}
+
+/**
+ * @brief   constexpr version of luhn256_checksum()
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+constexpr uint8_t luhn256_checksum_constexpr(const uint8_t * data, size_t length) {
+    return luhn_checksum_constexpr(data, length, 0);
+}
+
+/* cyclic redundancy checks */
+
+/**
+ * @brief   constexpr version of crc8_checksum()
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+constexpr uint8_t crc8_checksum_constexpr(const uint8_t * data, size_t length) {
+    return bm_crc_checksum_constexpr<uint8_t, 8, 0x07, 0x00, 0x00, false>(data, length);
+}
+
+/**
+ * @brief   constexpr version of crc16_checksum()
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+constexpr uint16_t crc16_checksum_constexpr(const uint8_t * data, size_t length) {
+    return bm_crc_checksum_constexpr<uint16_t, 16, 0x1021, 0xFFFF, 0x0000, false>(data, length);
+}
+
+/**
+ * @brief   constexpr version of crc32_checksum()
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+constexpr uint32_t crc32_checksum_constexpr(const uint8_t * data, size_t length) {
+    return bm_crc_checksum_constexpr<uint32_t, 32, 0xEDB88320, 0xFFFFFFFF, 0xFFFFFFFF, true>(data, length);
+}
+
+/**
+ * @brief   constexpr version of crc32c_checksum()
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+constexpr uint32_t crc32c_checksum_constexpr(const uint8_t * data, size_t length) {
+    return bm_crc_checksum_constexpr<uint32_t, 32, 0x82F63B78, 0xFFFFFFFF, 0xFFFFFFFF, true>(data, length);
+}
+
+// alias: original fletcher checksum is fletcher16
+#define fletcher_checksum_constexpr fletcher16_checksum_constexpr ///< constexpr version of fletcher_checksum()
+
+// alias: one's complement sum over 16 bit is the internet checksum
+#define internet_checksum_constexpr onesum16_checksum_constexpr ///< constexpr version of internet_checksum()
+
+#endif
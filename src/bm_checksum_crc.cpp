@@ -0,0 +1,566 @@
+/**
+ * @file    bm_checksum_crc.cpp
+ * @brief   Implementation file for cyclic redundancy check (CRC) functions, to be used with the ByteMessageChecksum class.
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_bm_checksum_crc_cpp License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "bm_checksum_crc.h"
+
+#include <string.h> // needed for memcpy()
+
+#if defined(__AVR__)
+    #include <avr/pgmspace.h> // keep lookup tables in flash on AVR
+#endif
+#if !defined(PROGMEM)
+    #define PROGMEM
+#endif
+
+#if defined(BM_CHECKSUM_CRC32C_HW) && defined(__SSE4_2__)
+    #include <nmmintrin.h>    // needed for _mm_crc32_*()
+#elif defined(BM_CHECKSUM_CRC32C_HW)
+    #include <arm_acle.h>     // needed for __crc32*()
+#endif
+
+/* cyclic redundancy checks (CRC) with different widths */
+
+namespace {
+
+/*
+ * Parameters of the CRC algorithms.
+ * For reflected algorithms, poly is given in reflected (LSB first) form.
+ */
+struct crc8_parameters {
+    using type = uint8_t;
+    static constexpr uint_fast8_t width = 8;
+    static constexpr type poly      = 0x07;
+    static constexpr type init      = 0x00;
+    static constexpr type xorout    = 0x00;
+    static constexpr bool reflected = false;
+};
+
+struct crc16_parameters {
+    using type = uint16_t;
+    static constexpr uint_fast8_t width = 16;
+    static constexpr type poly      = 0x1021;
+    static constexpr type init      = 0xFFFF;
+    static constexpr type xorout    = 0x0000;
+    static constexpr bool reflected = false;
+};
+
+struct crc32_parameters {
+    using type = uint32_t;
+    static constexpr uint_fast8_t width = 32;
+    static constexpr type poly      = 0xEDB88320; // 0x04C11DB7 reflected
+    static constexpr type init      = 0xFFFFFFFF;
+    static constexpr type xorout    = 0xFFFFFFFF;
+    static constexpr bool reflected = true;
+};
+
+struct crc32c_parameters {
+    using type = uint32_t;
+    static constexpr uint_fast8_t width = 32;
+    static constexpr type poly      = 0x82F63B78; // 0x1EDC6F41 reflected
+    static constexpr type init      = 0xFFFFFFFF;
+    static constexpr type xorout    = 0xFFFFFFFF;
+    static constexpr bool reflected = true;
+};
+
+// process one bit
+template <class P>
+constexpr typename P::type crc_bit_step(typename P::type crc) {
+    using T = typename P::type;
+    return P::reflected ? ((crc & 0x01) ? static_cast<T>((crc >> 1) ^ P::poly) : static_cast<T>(crc >> 1))
+                        : ((crc & static_cast<T>(static_cast<T>(1) << (P::width - 1))) ? static_cast<T>((crc << 1) ^ P::poly) : static_cast<T>(crc << 1));
+}
+
+// process the 8 bits of one byte, which must already be combined with crc
+// (recursive instead of a loop, so the function is constexpr in C++11)
+template <class P>
+constexpr typename P::type crc_bitwise_step(typename P::type crc, uint_fast8_t bits = 8) {
+    return (bits == 0) ? crc : crc_bitwise_step<P>(crc_bit_step<P>(crc), static_cast<uint_fast8_t>(bits - 1));
+}
+
+// combine the next input byte with crc
+template <class P>
+constexpr typename P::type crc_combine(typename P::type crc, uint8_t byte) {
+    using T = typename P::type;
+    return P::reflected ? static_cast<T>(crc ^ byte) : static_cast<T>(crc ^ (static_cast<T>(byte) << (P::width - 8)));
+}
+
+// N lookup tables with 256 entries each
+// tables[k][i] is the CRC contribution of byte i followed by k zero bytes
+template <class T, size_t N>
+struct crc_tables {
+    T t[N][256];
+};
+
+// entry tables[0][i], the CRC contribution of byte i
+template <class P>
+constexpr typename P::type crc_table_base(size_t i) {
+    return crc_bitwise_step<P>(crc_combine<P>(0, static_cast<uint8_t>(i)));
+}
+
+// entry of the next table, given the entry prev of the previous table
+template <class P>
+constexpr typename P::type crc_table_shift(typename P::type prev) {
+    using T = typename P::type;
+    return P::reflected ? static_cast<T>((prev >> 8) ^ crc_table_base<P>(prev & 0xFF))
+                        : static_cast<T>(static_cast<T>(prev << 8) ^ crc_table_base<P>((prev >> (P::width - 8)) & 0xFF));
+}
+
+// entry tables[k][i]
+template <class P>
+constexpr typename P::type crc_table_entry(size_t k, size_t i) {
+    return (k == 0) ? crc_table_base<P>(i) : crc_table_shift<P>(crc_table_entry<P>(k-1, i));
+}
+
+// list of indices 0..N-1, built by halving to keep the template recursion shallow
+template <size_t... I> struct crc_index_list {};
+template <class A, class B> struct crc_index_concat;
+template <size_t... I, size_t... J>
+struct crc_index_concat<crc_index_list<I...>, crc_index_list<J...>> {
+    using type = crc_index_list<I..., (sizeof...(I) + J)...>;
+};
+template <size_t N>
+struct crc_make_index_list {
+    using type = typename crc_index_concat<typename crc_make_index_list<N/2>::type, 
+                                           typename crc_make_index_list<N - N/2>::type>::type;
+};
+template <> struct crc_make_index_list<0> { using type = crc_index_list<>; };
+template <> struct crc_make_index_list<1> { using type = crc_index_list<0>; };
+
+// one initializer per entry, row by row (the braces of the rows are elided)
+template <class P, size_t N, size_t... J>
+constexpr crc_tables<typename P::type, N> make_crc_tables(crc_index_list<J...>) {
+    return crc_tables<typename P::type, N>{ { crc_table_entry<P>(J / 256, J % 256)... } };
+}
+
+template <class P, size_t N>
+constexpr crc_tables<typename P::type, N> make_crc_tables(void) {
+    return make_crc_tables<P, N>(typename crc_make_index_list<N * 256>::type{});
+}
+
+// the lookup tables, in flash on AVR
+constexpr crc_tables<uint8_t, 1>  crc8_table    PROGMEM = make_crc_tables<crc8_parameters, 1>();
+constexpr crc_tables<uint8_t, 8>  crc8_tables8  PROGMEM = make_crc_tables<crc8_parameters, 8>();
+constexpr crc_tables<uint16_t, 1> crc16_table   PROGMEM = make_crc_tables<crc16_parameters, 1>();
+constexpr crc_tables<uint16_t, 8> crc16_tables8 PROGMEM = make_crc_tables<crc16_parameters, 8>();
+constexpr crc_tables<uint32_t, 1> crc32_table   PROGMEM = make_crc_tables<crc32_parameters, 1>();
+constexpr crc_tables<uint32_t, 8> crc32_tables8 PROGMEM = make_crc_tables<crc32_parameters, 8>();
+constexpr crc_tables<uint32_t, 1> crc32c_table  PROGMEM = make_crc_tables<crc32c_parameters, 1>();
+constexpr crc_tables<uint32_t, 8> crc32c_tables8 PROGMEM = make_crc_tables<crc32c_parameters, 8>();
+
+// read a table entry
+#if defined(__AVR__)
+inline uint8_t  crc_table_read(const uint8_t * entry)  { return pgm_read_byte(entry); }
+inline uint16_t crc_table_read(const uint16_t * entry) { return pgm_read_word(entry); }
+inline uint32_t crc_table_read(const uint32_t * entry) { return pgm_read_dword(entry); }
+#else
+template <class T>
+inline T crc_table_read(const T * entry) { return *entry; }
+#endif
+
+// advance crc by one byte, using the first lookup table
+template <class P, size_t N>
+inline typename P::type crc_table_step(typename P::type crc, uint8_t byte, const crc_tables<typename P::type, N> &tables) {
+    using T = typename P::type;
+    if (P::reflected) {
+        return static_cast<T>((crc >> 8) ^ crc_table_read(&tables.t[0][(crc ^ byte) & 0xFF]));
+    }
+    else {
+        return static_cast<T>(static_cast<T>(crc << 8) ^ crc_table_read(&tables.t[0][((crc >> (P::width - 8)) ^ byte) & 0xFF]));
+    }
+}
+
+// the three software implementations
+
+template <class P>
+typename P::type crc_bitwise(const uint8_t * data, size_t length) {
+    typename P::type crc = P::init;
+    while (length > 0) {
+        crc = crc_bitwise_step<P>(crc_combine<P>(crc, *data++));
+        length--;
+    }
+    return static_cast<typename P::type>(crc ^ P::xorout);
+}
+
+template <class P>
+typename P::type crc_table(const uint8_t * data, size_t length, const crc_tables<typename P::type, 1> &tables) {
+    typename P::type crc = P::init;
+    while (length > 0) {
+        crc = crc_table_step<P, 1>(crc, *data++, tables);
+        length--;
+    }
+    return static_cast<typename P::type>(crc ^ P::xorout);
+}
+
+template <class P>
+typename P::type crc_slicing8(const uint8_t * data, size_t length, const crc_tables<typename P::type, 8> &tables) {
+    using T = typename P::type;
+    constexpr uint_fast8_t crcbytes = P::width / 8;
+    T crc = P::init;
+    while (length >= 8) {
+        // the first bytes of the block are combined with the current crc,
+        // all eight bytes are looked up independently of each other
+        T next = 0;
+        for (uint_fast8_t j = 0; j < 8; j++) {
+            uint8_t index = data[j];
+            if (j < crcbytes) {
+                index ^= P::reflected ? static_cast<uint8_t>(crc >> (8 * j)) : static_cast<uint8_t>(crc >> (P::width - 8 - 8 * j));
+            }
+            next ^= crc_table_read(&tables.t[7 - j][index]);
+        }
+        crc = next;
+        data += 8;
+        length -= 8;
+    }
+    while (length > 0) {
+        crc = crc_table_step<P, 8>(crc, *data++, tables);
+        length--;
+    }
+    return static_cast<T>(crc ^ P::xorout);
+}
+
+} // end anonymous namespace
+
+/* 8 bit CRC */
+
+/**
+ * @brief   CRC-8, bit by bit
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ * @note    No lookup table, smallest implementation.
+ */
+uint8_t crc8_checksum_bitwise(const uint8_t * data, size_t length) {
+    return crc_bitwise<crc8_parameters>(data, length);
+}
+
+/**
+ * @brief   CRC-8 with one 256-byte lookup table
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+uint8_t crc8_checksum_table(const uint8_t * data, size_t length) {
+    return crc_table<crc8_parameters>(data, length, crc8_table);
+}
+
+/**
+ * @brief   CRC-8 with eight 256-byte lookup tables (slicing-by-8)
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+uint8_t crc8_checksum_slicing8(const uint8_t * data, size_t length) {
+    return crc_slicing8<crc8_parameters>(data, length, crc8_tables8);
+}
+
+/* 16 bit CRC */
+
+/**
+ * @brief   CRC-16-CCITT, bit by bit
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ * @note    No lookup table, smallest implementation.
+ */
+uint16_t crc16_checksum_bitwise(const uint8_t * data, size_t length) {
+    return crc_bitwise<crc16_parameters>(data, length);
+}
+
+/**
+ * @brief   CRC-16-CCITT with one 512-byte lookup table
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+uint16_t crc16_checksum_table(const uint8_t * data, size_t length) {
+    return crc_table<crc16_parameters>(data, length, crc16_table);
+}
+
+/**
+ * @brief   CRC-16-CCITT with eight 512-byte lookup tables (slicing-by-8)
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+uint16_t crc16_checksum_slicing8(const uint8_t * data, size_t length) {
+    return crc_slicing8<crc16_parameters>(data, length, crc16_tables8);
+}
+
+/* 32 bit CRC */
+
+/**
+ * @brief   CRC-32, bit by bit
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ * @note    No lookup table, smallest implementation.
+ */
+uint32_t crc32_checksum_bitwise(const uint8_t * data, size_t length) {
+    return crc_bitwise<crc32_parameters>(data, length);
+}
+
+/**
+ * @brief   CRC-32 with one 1 KB lookup table
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+uint32_t crc32_checksum_table(const uint8_t * data, size_t length) {
+    return crc_table<crc32_parameters>(data, length, crc32_table);
+}
+
+/**
+ * @brief   CRC-32 with eight 1 KB lookup tables (slicing-by-8)
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+uint32_t crc32_checksum_slicing8(const uint8_t * data, size_t length) {
+    return crc_slicing8<crc32_parameters>(data, length, crc32_tables8);
+}
+
+#if defined(BM_CHECKSUM_CRC32_HW)
+/**
+ * @brief   CRC-32 with the CRC instructions of ARMv8
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+uint32_t crc32_checksum_hw(const uint8_t * data, size_t length) {
+    uint32_t crc = crc32_parameters::init;
+    while (length >= 8) {
+        uint64_t word;
+        memcpy(&word, data, 8); // unaligned load, little-endian
+        crc = __crc32d(crc, word);
+        data += 8;
+        length -= 8;
+    }
+    while (length > 0) {
+        crc = __crc32b(crc, *data++);
+        length--;
+    }
+    return crc ^ crc32_parameters::xorout;
+}
+#endif
+
+/* 32 bit CRC, Castagnoli polynomial */
+
+/**
+ * @brief   CRC-32C, bit by bit
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ * @note    No lookup table, smallest implementation.
+ */
+uint32_t crc32c_checksum_bitwise(const uint8_t * data, size_t length) {
+    return crc_bitwise<crc32c_parameters>(data, length);
+}
+
+/**
+ * @brief   CRC-32C with one 1 KB lookup table
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+uint32_t crc32c_checksum_table(const uint8_t * data, size_t length) {
+    return crc_table<crc32c_parameters>(data, length, crc32c_table);
+}
+
+/**
+ * @brief   CRC-32C with eight 1 KB lookup tables (slicing-by-8)
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+uint32_t crc32c_checksum_slicing8(const uint8_t * data, size_t length) {
+    return crc_slicing8<crc32c_parameters>(data, length, crc32c_tables8);
+}
+
+#if defined(BM_CHECKSUM_CRC32C_HW)
+/**
+ * @brief   CRC-32C with the CRC instructions of SSE4.2 or ARMv8
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ */
+uint32_t crc32c_checksum_hw(const uint8_t * data, size_t length) {
+#if defined(__SSE4_2__) && defined(__x86_64__)
+    uint64_t crc = crc32c_parameters::init;
+    while (length >= 8) {
+        uint64_t word;
+        memcpy(&word, data, 8); // unaligned load
+        crc = _mm_crc32_u64(crc, word);
+        data += 8;
+        length -= 8;
+    }
+    while (length > 0) {
+        crc = _mm_crc32_u8(static_cast<uint32_t>(crc), *data++);
+        length--;
+    }
+    return static_cast<uint32_t>(crc) ^ crc32c_parameters::xorout;
+#elif defined(__SSE4_2__)
+    uint32_t crc = crc32c_parameters::init;
+    while (length >= 4) {
+        uint32_t word;
+        memcpy(&word, data, 4); // unaligned load
+        crc = _mm_crc32_u32(crc, word);
+        data += 4;
+        length -= 4;
+    }
+    while (length > 0) {
+        crc = _mm_crc32_u8(crc, *data++);
+        length--;
+    }
+    return crc ^ crc32c_parameters::xorout;
+#else
+    uint32_t crc = crc32c_parameters::init;
+    while (length >= 8) {
+        uint64_t word;
+        memcpy(&word, data, 8); // unaligned load, little-endian
+        crc = __crc32cd(crc, word);
+        data += 8;
+        length -= 8;
+    }
+    while (length > 0) {
+        crc = __crc32cb(crc, *data++);
+        length--;
+    }
+    return crc ^ crc32c_parameters::xorout;
+#endif
+}
+#endif
+
+/* implementations chosen at compile time */
+
+/**
+ * @brief   CRC-8 (CRC-8/SMBUS)
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ * @note    Uses crc8_checksum_slicing8() on 64 bit targets and 
+ *          crc8_checksum_table() otherwise.
+ */
+uint8_t crc8_checksum(const uint8_t * data, size_t length) {
+#if (UINTPTR_MAX > 0xFFFFFFFF)
+    return crc8_checksum_slicing8(data, length);
+#else
+    return crc8_checksum_table(data, length);
+#endif
+}
+
+/**
+ * @brief   CRC-16-CCITT (CRC-16/CCITT-FALSE)
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ * @note    Uses crc16_checksum_slicing8() on 64 bit targets and 
+ *          crc16_checksum_table() otherwise.
+ */
+uint16_t crc16_checksum(const uint8_t * data, size_t length) {
+#if (UINTPTR_MAX > 0xFFFFFFFF)
+    return crc16_checksum_slicing8(data, length);
+#else
+    return crc16_checksum_table(data, length);
+#endif
+}
+
+/**
+ * @brief   CRC-32
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ * @note    Uses crc32_checksum_hw() if available, crc32_checksum_slicing8()
+ *          on (other) 64 bit targets and crc32_checksum_table() otherwise.
+ */
+uint32_t crc32_checksum(const uint8_t * data, size_t length) {
+#if defined(BM_CHECKSUM_CRC32_HW)
+    return crc32_checksum_hw(data, length);
+#elif (UINTPTR_MAX > 0xFFFFFFFF)
+    return crc32_checksum_slicing8(data, length);
+#else
+    return crc32_checksum_table(data, length);
+#endif
+}
+
+/**
+ * @brief   CRC-32C
+ * @param   data
+ *          Pointer to array with bytes to calculate the checksum over.
+ * @param   length
+ *          Number of bytes in data to calculate the checksum.
+ * @return  The checksum value
+ * @note    Uses crc32c_checksum_hw() if available, crc32c_checksum_slicing8()
+ *          on (other) 64 bit targets and crc32c_checksum_table() otherwise.
+ */
+uint32_t crc32c_checksum(const uint8_t * data, size_t length) {
+#if defined(BM_CHECKSUM_CRC32C_HW)
+    return crc32c_checksum_hw(data, length);
+#elif (UINTPTR_MAX > 0xFFFFFFFF)
+    return crc32c_checksum_slicing8(data, length);
+#else
+    return crc32c_checksum_table(data, length);
+#endif
+}
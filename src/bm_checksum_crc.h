@@ -0,0 +1,108 @@
+/**
+ * @file    bm_checksum_crc.h
+ * @brief   Header file for cyclic redundancy check (CRC) functions, to be used with the ByteMessageChecksum class.
+ * @author  Andreas Grommek
+ * @version 1.0.0
+ * @date    2026-10-14
+ * 
+ * @section license_bm_checksum_crc_h License
+ * 
+ * The MIT Licence (MIT)
+ * 
+ * Copyright (c) 2026 Andreas Grommek
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef crc_checksum_h
+#define crc_checksum_h
+
+/* cyclic redundancy checks (CRC) with different widths */
+
+#include <stdint.h> // needed for fixed-size data types
+#include <stddef.h> // needed for size_t data type
+
+/* 
+ * Important points:
+ * - Four CRC algorithms are implemented (parameters from the "Catalogue of 
+ *   parametrised CRC algorithms" by Greg Cook):
+ *     crc8:   CRC-8 (CRC-8/SMBUS), poly 0x07, init 0x00, not reflected, xorout 0x00
+ *     crc16:  CRC-16-CCITT (CRC-16/CCITT-FALSE), poly 0x1021, init 0xFFFF, 
+ *             not reflected, xorout 0x0000
+ *     crc32:  CRC-32 (Ethernet, zip, PNG), poly 0x04C11DB7, init 0xFFFFFFFF, 
+ *             reflected, xorout 0xFFFFFFFF
+ *     crc32c: CRC-32C (Castagnoli, iSCSI, ext4), poly 0x1EDC6F41, init 0xFFFFFFFF, 
+ *             reflected, xorout 0xFFFFFFFF
+ * - Every algorithm has several implementations with identical results:
+ *     _bitwise:  bit by bit, no lookup table, smallest flash footprint, slow
+ *     _table:    one 256-entry lookup table (PROGMEM on AVR), one byte per step
+ *     _slicing8: eight 256-entry lookup tables (PROGMEM on AVR), 8 bytes per step,
+ *                meant for hosts with large caches
+ *     _hw:       CRC instructions of the CPU (SSE4.2 or ARMv8 CRC extension),
+ *                only crc32c on x86 and crc32/crc32c on ARMv8
+ * - The functions without suffix pick an implementation at compile time:
+ *   _hw if available, else _slicing8 on 64 bit targets, else _table.
+ * - The _hw functions are only declared if BM_CHECKSUM_CRC32_HW or 
+ *   BM_CHECKSUM_CRC32C_HW, respectively, is defined. Compile e.g. with 
+ *   -msse4.2 or -march=armv8-a+crc to enable them. Define BM_CHECKSUM_NO_HWCRC
+ *   to disable them.
+ */
+
+#if !defined(BM_CHECKSUM_NO_HWCRC)
+    #if defined(__SSE4_2__)
+        #define BM_CHECKSUM_CRC32C_HW ///< defined if crc32c_checksum_hw() is available
+    #endif
+    #if defined(__ARM_FEATURE_CRC32) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+        #define BM_CHECKSUM_CRC32_HW  ///< defined if crc32_checksum_hw() is available
+        #if !defined(BM_CHECKSUM_CRC32C_HW)
+            #define BM_CHECKSUM_CRC32C_HW
+        #endif
+    #endif
+#endif
+
+// choose one of these if you want to pick the implementation yourself
+uint8_t crc8_checksum_bitwise(const uint8_t * data, size_t length);
+uint8_t crc8_checksum_table(const uint8_t * data, size_t length);
+uint8_t crc8_checksum_slicing8(const uint8_t * data, size_t length);
+
+uint16_t crc16_checksum_bitwise(const uint8_t * data, size_t length);
+uint16_t crc16_checksum_table(const uint8_t * data, size_t length);
+uint16_t crc16_checksum_slicing8(const uint8_t * data, size_t length);
+
+uint32_t crc32_checksum_bitwise(const uint8_t * data, size_t length);
+uint32_t crc32_checksum_table(const uint8_t * data, size_t length);
+uint32_t crc32_checksum_slicing8(const uint8_t * data, size_t length);
+#if defined(BM_CHECKSUM_CRC32_HW)
+uint32_t crc32_checksum_hw(const uint8_t * data, size_t length);
+#endif
+
+uint32_t crc32c_checksum_bitwise(const uint8_t * data, size_t length);
+uint32_t crc32c_checksum_table(const uint8_t * data, size_t length);
+uint32_t crc32c_checksum_slicing8(const uint8_t * data, size_t length);
+#if defined(BM_CHECKSUM_CRC32C_HW)
+uint32_t crc32c_checksum_hw(const uint8_t * data, size_t length);
+#endif
+
+// versions with implementation chosen at compile time - use these!
+uint8_t crc8_checksum(const uint8_t * data, size_t length);
+uint16_t crc16_checksum(const uint8_t * data, size_t length);
+uint32_t crc32_checksum(const uint8_t * data, size_t length);
+uint32_t crc32c_checksum(const uint8_t * data, size_t length);
+
+#endif
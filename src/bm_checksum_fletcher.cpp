@@ -43,15 +43,37 @@
  */
 uint8_t fletcher8_checksum(const uint8_t * data, size_t length) {
     constexpr uint_fast8_t base = 15; // 0x0F
-    uint_fast8_t sum1 = 0;
-    uint_fast8_t sum2 = 0;
-    for (size_t i=0; i< length; i++) {
-        // most significant nibble first
-        sum1 = (sum1 + (data[i] >> 4)); // defer modulus operation
-        sum2 = (sum2 + sum1);           // defer modulus operation
-        // least significant nibble last
-        sum1 = (sum1 + (data[i] & 0x0F)) % base;
-        sum2 = (sum2 + sum1) % base;
+    /*
+    prevent overflow of sum2 with deferred modulus operation
+    Each byte adds two nibbles, i.e. k = 2*n terms for n bytes. With
+    sum1 and sum2 < base at the start of a block, the largest max(sum2) is
+    14 + 14*k + 15*k*(k+1)/2. Solve for the largest n with
+    max(sum2) <= UINT_FASTxx_MAX.
+    */
+    constexpr uint_fast16_t blocksize_limit = 
+        (UINT_FAST16_MAX == 0xFFFFFF) ?                 747 : // 24 bit
+        (UINT_FAST16_MAX == 0xFFFFFFFF) ?             11964 : // 32 bit
+        (UINT_FAST16_MAX == 0xFFFFFFFFFF) ?          191442 : // 40 bit
+        (UINT_FAST16_MAX == 0xFFFFFFFFFFFF) ?       3063085 : // 48 bit
+        (UINT_FAST16_MAX == 0xFFFFFFFFFFFFFF) ?    49009384 : // 56 bit
+        (UINT_FAST16_MAX == 0xFFFFFFFFFFFFFFFF) ? 784150156 : // 64 bit 
+                                                         46 ; // else assume 16 bit
+    uint_fast16_t sum1 = 0;
+    uint_fast16_t sum2 = 0;
+    while (length > 0) {
+        uint_fast16_t blocksize = (length > blocksize_limit) ? blocksize_limit : length;
+        length -= blocksize;
+        while (blocksize > 0) {
+            // most significant nibble first
+            sum1 += (*data >> 4);
+            sum2 += sum1;
+            // least significant nibble last
+            sum1 += (*data++ & 0x0F);
+            sum2 += sum1;
+            blocksize--;
+        }
+        sum1 %= base;
+        sum2 %= base;
     }
     return static_cast<uint8_t>(sum2 << 4 | sum1);
 }
@@ -141,3 +163,166 @@ uint32_t fletcher32_checksum(const uint8_t * data, size_t length) {
     }
     return static_cast<uint32_t>(sum2 << 16 | sum1);
 }
+
+/*
+ * Streaming calculation
+ * 
+ * Each buffer is handled by the one-shot function. For a part of k terms
+ * (nibbles, bytes or 16 bit words) with sums a2 and b2, the sums over all
+ * data so far become a = a1 + a2 and b = b1 + b2 + k * a1, modulo base.
+ * Fletcher32 works on 16 bit words: a byte left over at the end of a 
+ * buffer is kept in the context until the next byte arrives.
+ */
+
+/**
+ * @brief   Start streaming calculation of Fletcher's checksum with single-byte return value
+ * @param   ctx
+ *          The context to initialize.
+ */
+void fletcher8_checksum_init(fletcher8_checksum_context &ctx) {
+    ctx.sum1 = 0;
+    ctx.sum2 = 0;
+    ctx.length = 0;
+}
+
+/**
+ * @brief   Add bytes to streaming calculation of Fletcher's checksum with single-byte return value
+ * @param   ctx
+ *          The context, initialized with fletcher8_checksum_init().
+ * @param   data
+ *          Pointer to the next bytes.
+ * @param   length
+ *          Number of bytes in data.
+ */
+void fletcher8_checksum_update(fletcher8_checksum_context &ctx, const uint8_t * data, size_t length) {
+    constexpr uint_fast8_t base = 15;
+    if (length == 0) return;
+    const uint_fast8_t part = fletcher8_checksum(data, length);
+    // two nibbles per byte
+    const uint_fast16_t terms = (2 * (length % base)) % base;
+    ctx.sum2 = static_cast<uint8_t>((ctx.sum2 + (part >> 4) + terms * ctx.sum1) % base);
+    ctx.sum1 = static_cast<uint8_t>((ctx.sum1 + (part & 0x0F)) % base);
+    ctx.length += length;
+}
+
+/**
+ * @brief   Finish streaming calculation of Fletcher's checksum with single-byte return value
+ * @param   ctx
+ *          The context.
+ * @return  The checksum value, identical to fletcher8_checksum() over all 
+ *          bytes passed to fletcher8_checksum_update().
+ */
+uint8_t fletcher8_checksum_final(const fletcher8_checksum_context &ctx) {
+    return static_cast<uint8_t>(ctx.sum2 << 4 | ctx.sum1);
+}
+
+/**
+ * @brief   Start streaming calculation of the original Fletcher's checksum
+ * @param   ctx
+ *          The context to initialize.
+ */
+void fletcher16_checksum_init(fletcher16_checksum_context &ctx) {
+    ctx.sum1 = 0;
+    ctx.sum2 = 0;
+    ctx.length = 0;
+}
+
+/**
+ * @brief   Add bytes to streaming calculation of the original Fletcher's checksum
+ * @param   ctx
+ *          The context, initialized with fletcher16_checksum_init().
+ * @param   data
+ *          Pointer to the next bytes.
+ * @param   length
+ *          Number of bytes in data.
+ */
+void fletcher16_checksum_update(fletcher16_checksum_context &ctx, const uint8_t * data, size_t length) {
+    constexpr uint_fast8_t base = 255;
+    if (length == 0) return;
+    const uint_fast16_t part = fletcher16_checksum(data, length);
+    const uint_fast16_t terms = length % base;
+    // terms * sum1 <= 254 * 254, no overflow even for 16 bit
+    ctx.sum2 = static_cast<uint8_t>((ctx.sum2 + (part >> 8) + (terms * ctx.sum1) % base) % base);
+    ctx.sum1 = static_cast<uint8_t>((ctx.sum1 + (part & 0xFF)) % base);
+    ctx.length += length;
+}
+
+/**
+ * @brief   Finish streaming calculation of the original Fletcher's checksum
+ * @param   ctx
+ *          The context.
+ * @return  The checksum value, identical to fletcher16_checksum() over all 
+ *          bytes passed to fletcher16_checksum_update().
+ */
+uint16_t fletcher16_checksum_final(const fletcher16_checksum_context &ctx) {
+    return static_cast<uint16_t>(static_cast<uint16_t>(ctx.sum2) << 8 | ctx.sum1);
+}
+
+/**
+ * @brief   Start streaming calculation of Fletcher's checksum taken over pairs of bytes
+ * @param   ctx
+ *          The context to initialize.
+ */
+void fletcher32_checksum_init(fletcher32_checksum_context &ctx) {
+    ctx.sum1 = 0;
+    ctx.sum2 = 0;
+    ctx.length = 0;
+    ctx.pending = 0;
+}
+
+/**
+ * @brief   Add bytes to streaming calculation of Fletcher's checksum taken over pairs of bytes
+ * @param   ctx
+ *          The context, initialized with fletcher32_checksum_init().
+ * @param   data
+ *          Pointer to the next bytes.
+ * @param   length
+ *          Number of bytes in data. Buffers of uneven length are fine, 
+ *          bytes are paired across buffers.
+ */
+void fletcher32_checksum_update(fletcher32_checksum_context &ctx, const uint8_t * data, size_t length) {
+    constexpr uint_fast32_t base = 65535;
+    if (length == 0) return;
+    uint_fast32_t sum1 = ctx.sum1;
+    uint_fast32_t sum2 = ctx.sum2;
+    ctx.length += length;
+    // complete word started by the last buffer
+    if ((ctx.length - length) & 0x01) {
+        const uint_fast32_t number16 = static_cast<uint_fast32_t>(ctx.pending) << 8 | static_cast<uint_fast32_t>(*data++);
+        sum1 = (sum1 + number16) % base;
+        sum2 = (sum2 + sum1) % base;
+        length--;
+    }
+    const size_t even = length & ~static_cast<size_t>(0x01);
+    if (even > 0) {
+        const uint32_t part = fletcher32_checksum(data, even);
+        const uint32_t terms = static_cast<uint32_t>((even / 2) % base);
+        // terms * sum1 <= 65534 * 65534 fits into 32 bits
+        sum2 = (sum2 + (part >> 16) + (terms * static_cast<uint32_t>(sum1)) % base) % base;
+        sum1 = (sum1 + (part & 0xFFFF)) % base;
+    }
+    if (length & 0x01) {
+        ctx.pending = data[even];
+    }
+    ctx.sum1 = static_cast<uint16_t>(sum1);
+    ctx.sum2 = static_cast<uint16_t>(sum2);
+}
+
+/**
+ * @brief   Finish streaming calculation of Fletcher's checksum taken over pairs of bytes
+ * @param   ctx
+ *          The context.
+ * @return  The checksum value, identical to fletcher32_checksum() over all 
+ *          bytes passed to fletcher32_checksum_update(). If the total 
+ *          length is uneven, an implicit 0 is added.
+ */
+uint32_t fletcher32_checksum_final(const fletcher32_checksum_context &ctx) {
+    constexpr uint_fast32_t base = 65535;
+    uint_fast32_t sum1 = ctx.sum1;
+    uint_fast32_t sum2 = ctx.sum2;
+    if (ctx.length & 0x01) {
+        sum1 = (sum1 + (static_cast<uint_fast32_t>(ctx.pending) << 8)) % base;
+        sum2 = (sum2 + sum1) % base;
+    }
+    return static_cast<uint32_t>(sum2 << 16 | sum1);
+}
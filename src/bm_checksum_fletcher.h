@@ -40,7 +40,29 @@ uint8_t fletcher8_checksum(const uint8_t * data, size_t length);
 uint16_t fletcher16_checksum(const uint8_t * data, size_t length);
 uint32_t fletcher32_checksum(const uint8_t * data, size_t length);
 
+// Calculate checksum over several buffers in a row, e.g. a ring buffer 
+// which wraps around or scatter-gather segments: call _init() once, 
+// _update() for each buffer and _final() for the result. The result is
+// identical to the checksum over all buffers joined together.
+struct fletcher8_checksum_context  { uint8_t  sum1; uint8_t  sum2; size_t length; };
+struct fletcher16_checksum_context { uint8_t  sum1; uint8_t  sum2; size_t length; };
+struct fletcher32_checksum_context { uint16_t sum1; uint16_t sum2; size_t length; uint8_t pending; };
+
+void fletcher8_checksum_init(fletcher8_checksum_context &ctx);
+void fletcher8_checksum_update(fletcher8_checksum_context &ctx, const uint8_t * data, size_t length);
+uint8_t fletcher8_checksum_final(const fletcher8_checksum_context &ctx);
+void fletcher16_checksum_init(fletcher16_checksum_context &ctx);
+void fletcher16_checksum_update(fletcher16_checksum_context &ctx, const uint8_t * data, size_t length);
+uint16_t fletcher16_checksum_final(const fletcher16_checksum_context &ctx);
+void fletcher32_checksum_init(fletcher32_checksum_context &ctx);
+void fletcher32_checksum_update(fletcher32_checksum_context &ctx, const uint8_t * data, size_t length);
+uint32_t fletcher32_checksum_final(const fletcher32_checksum_context &ctx);
+
 // alias: original fletcher checksum is fletcher16
 #define fletcher_checksum fletcher16_checksum ///< fletcher16_checksum is the original Fletcher's checksum
+#define fletcher_checksum_context fletcher16_checksum_context ///< alias for streaming calculation of the original Fletcher's checksum
+#define fletcher_checksum_init fletcher16_checksum_init ///< alias for streaming calculation of the original Fletcher's checksum
+#define fletcher_checksum_update fletcher16_checksum_update ///< alias for streaming calculation of the original Fletcher's checksum
+#define fletcher_checksum_final fletcher16_checksum_final ///< alias for streaming calculation of the original Fletcher's checksum
 
 #endif
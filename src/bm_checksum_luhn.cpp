@@ -193,3 +193,109 @@ uint8_t luhn256_checksum(const uint8_t* data, size_t length) {
     sum &= 0xFF; // same as sum %= 256, in case sizeof(uint_fast8_t) > 1
     return static_cast<uint8_t>( base256 - sum ); // use overflow properties in case of sum = 0
 }
+
+/*
+ * Streaming calculation
+ * 
+ * The factor of a byte depends on its distance from the END of the data,
+ * which is not known before the last buffer. The context keeps two sums:
+ * one with factor 2 for bytes at even positions (counted from the start),
+ * and one with factor 2 for bytes at odd positions. The total length 
+ * decides which one is used.
+ */
+
+namespace {
+    // sum of the digits of addend in base intbase, like in luhn_checksum_textbook()
+    inline uint_fast16_t luhn_digit_sum(uint_fast16_t addend, uint_fast16_t intbase) {
+        if (addend < intbase) return addend;
+        if (addend < 2 * intbase) return addend - (intbase - 1);
+        return (addend / intbase) + (addend % intbase);
+    }
+}
+
+/**
+ * @brief   Start streaming calculation of Luhn's mod-N checksum
+ * @param   ctx
+ *          The context to initialize.
+ * @param   base
+ *          The base of the numbering scheme, 0 means 256.
+ */
+void luhn_checksum_init(luhn_checksum_context &ctx, uint8_t base) {
+    ctx.sum_even = 0;
+    ctx.sum_odd = 0;
+    ctx.base = (base == 0) ? 256 : base;
+    ctx.length = 0;
+}
+
+/**
+ * @brief   Start streaming calculation of Luhn's mod-N checksum for base 256
+ * @param   ctx
+ *          The context to initialize.
+ */
+void luhn256_checksum_init(luhn_checksum_context &ctx) {
+    luhn_checksum_init(ctx, 0);
+}
+
+/**
+ * @brief   Add bytes to streaming calculation of Luhn's mod-N checksum
+ * @param   ctx
+ *          The context, initialized with luhn_checksum_init() or luhn256_checksum_init().
+ * @param   data
+ *          Pointer to the next bytes.
+ * @param   length
+ *          Number of bytes in data.
+ */
+void luhn_checksum_update(luhn_checksum_context &ctx, const uint8_t * data, size_t length) {
+    const uint_fast16_t intbase = ctx.base;
+    // a digit sum is at most 510 (2*255 in base 1), so 128 of them 
+    // can be added to a sum < intbase without overflow of 16 bits
+    constexpr uint_fast16_t blocksize_limit = 128;
+    uint_fast16_t sum_a = ctx.sum_even;
+    uint_fast16_t sum_b = ctx.sum_odd;
+    // swap sums for odd start position, so sum_a always gets factor 2 for i even
+    const bool odd_start = (ctx.length & 0x01);
+    if (odd_start) {
+        sum_a = ctx.sum_odd;
+        sum_b = ctx.sum_even;
+    }
+    ctx.length += length;
+    while (length > 0) {
+        uint_fast16_t blocksize = (length > blocksize_limit) ? blocksize_limit : static_cast<uint_fast16_t>(length);
+        length -= blocksize;
+        while (blocksize > 1) {
+            const uint_fast16_t first = *data++;
+            const uint_fast16_t second = *data++;
+            sum_a += luhn_digit_sum(2 * first, intbase) + luhn_digit_sum(second, intbase);
+            sum_b += luhn_digit_sum(first, intbase) + luhn_digit_sum(2 * second, intbase);
+            blocksize -= 2;
+        }
+        if (blocksize == 1) {
+            // block of uneven length: the next byte has the other parity
+            const uint_fast16_t value = *data++;
+            sum_a += luhn_digit_sum(2 * value, intbase);
+            sum_b += luhn_digit_sum(value, intbase);
+            const uint_fast16_t swap = sum_a;
+            sum_a = sum_b;
+            sum_b = swap;
+        }
+        sum_a %= intbase;
+        sum_b %= intbase;
+    }
+    // undo the swaps
+    const bool odd_end = (ctx.length & 0x01);
+    ctx.sum_even = static_cast<uint16_t>(odd_end ? sum_b : sum_a);
+    ctx.sum_odd  = static_cast<uint16_t>(odd_end ? sum_a : sum_b);
+}
+
+/**
+ * @brief   Finish streaming calculation of Luhn's mod-N checksum
+ * @param   ctx
+ *          The context.
+ * @return  The checksum value, identical to luhn_checksum_textbook() over 
+ *          all bytes passed to luhn_checksum_update().
+ */
+uint8_t luhn_checksum_final(const luhn_checksum_context &ctx) {
+    // the last byte has factor 2
+    const uint_fast16_t sum = ((ctx.length & 0x01) == 0) ? ctx.sum_odd : ctx.sum_even;
+    return static_cast<uint8_t>( (ctx.base - sum) % ctx.base );
+}
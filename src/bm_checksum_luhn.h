@@ -48,5 +48,18 @@ uint8_t luhn_checksum(const uint8_t* ptr, size_t length, uint8_t base=10);
 // May or may not be faster than general implementation.
 uint8_t luhn256_checksum(const uint8_t* ptr, size_t length);
 
+// Calculate checksum over several buffers in a row, e.g. a ring buffer 
+// which wraps around or scatter-gather segments: call _init() once, 
+// _update() for each buffer and _final() for the result. The result is
+// identical to luhn_checksum_textbook() over all buffers joined together
+// (and to luhn_checksum() if all bytes are smaller than base).
+// base = 256 <--> base = 0
+struct luhn_checksum_context { uint16_t sum_even; uint16_t sum_odd; uint16_t base; size_t length; };
+
+void luhn_checksum_init(luhn_checksum_context &ctx, uint8_t base=10);
+void luhn256_checksum_init(luhn_checksum_context &ctx);
+void luhn_checksum_update(luhn_checksum_context &ctx, const uint8_t * data, size_t length);
+uint8_t luhn_checksum_final(const luhn_checksum_context &ctx);
+
 #endif
 
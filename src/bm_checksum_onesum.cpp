@@ -31,6 +31,7 @@
  */
 
 #include "bm_checksum_onesum.h"
+#include "bm_checksum_bulk.h" // word-at-a-time and SIMD helpers
 
 /* One's complement checksum over different sizes */
 
@@ -72,6 +73,18 @@ uint8_t onesum8_checksum_textbook(const uint8_t * data, size_t length) {
 uint8_t onesum8_checksum(const uint8_t * data, size_t length) {
     constexpr size_t blocklength_limit = 256;
     uint_fast16_t sum = 0;
+    #if defined(BM_CHECKSUM_BULK)
+    // handle large chunks first: the one's complement sum of single
+    // bytes is the plain sum of all bytes, folded to 8 bit
+    uint64_t bulk = 0;
+    const size_t done = bm_bulk_byte_sum(data, length, bulk);
+    data += done;
+    length -= done;
+    while (bulk >> 8) {
+        bulk = (bulk >> 8) + (bulk & 0xFF);
+    }
+    sum = static_cast<uint_fast16_t>(bulk);
+    #endif
     while (length > 0) {
         size_t blocklength = (length > blocklength_limit) ? blocklength_limit : length;
         length -= blocklength;
@@ -129,6 +142,12 @@ uint16_t onesum16_checksum(const uint8_t * data, size_t length) {
     // Note: blocklength_limit must be even for the calculate-last-byte logic to work correctly!!
     constexpr size_t blocklength_limit = 2*254;
     uint_fast32_t  sum = 0;
+    #if defined(BM_CHECKSUM_BULK)
+    // handle large chunks first
+    const size_t done = bm_bulk_onesum16(data, length, sum);
+    data += done;
+    length -= done;
+    #endif
     // handle all complete byte-pairs 
     while (length > 0) {
         // blocklength is even, except maybe during last iteration if len is uneven
@@ -204,6 +223,27 @@ uint32_t onesum32_checksum(const uint8_t * data, size_t length) {
     // Note: blocklength_limit must be dividable by 4 for the calculate-last-bytes logic to work correctly!!
     constexpr size_t blocklength_limit = 4*254;
     uint_fast64_t  sum = 0;
+    #if defined(BM_CHECKSUM_BULK)
+    // handle large chunks first: the sum of all big-endian 32 bit words 
+    // is derived from the sums of the bytes at each position
+    {
+        uint64_t pos[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+        const size_t done = bm_bulk_position_sums(data, length, pos);
+        data += done;
+        length -= done;
+        for (uint_fast8_t i = 0; i < 8; i++) {
+            // fold to 32 bit first to prevent overflow when shifting
+            uint64_t p = pos[i];
+            while (p >> 32) {
+                p = (p >> 32) + (p & 0xFFFFFFFF);
+            }
+            sum += p << (8 * (3 - (i % 4)));
+        }
+        while (sum >> 32) {
+            sum = (sum >> 32) + (sum & 0xFFFFFFFF);
+        }
+    }
+    #endif
     uint_fast64_t bytes[4] = {0, 0, 0, 0};
     uint_fast8_t modulus = length & 0x03; // same as length % 4
     // handle all complete byte-quartets
@@ -220,8 +260,11 @@ uint32_t onesum32_checksum(const uint8_t * data, size_t length) {
             blocklength -= 4;
         }
         // handle remaining bytes if input length was not dividable by four
-        for (uint_fast8_t i=0; i<modulus; i++) {
-            sum += static_cast<uint_fast64_t>(*data++) << (24-(8*i));
+        // (only possible in the last block)
+        if (length == 0) {
+            for (uint_fast8_t i=0; i<modulus; i++) {
+                sum += static_cast<uint_fast64_t>(*data++) << (24-(8*i));
+            }
         }
         // fold back carry into the sum until there is no more carry
         while (sum >> 32) {
@@ -265,3 +308,235 @@ uint32_t onesum32_checksum_textbook(const uint8_t * data, size_t length) {
     // invert sum (i.e. calculate the one's complement) and return it
     return ~(static_cast<uint32_t>(sum));
 }
+
+/*
+ * Delta updates
+ * 
+ * Implements eqn. 3 from RFC1624: HC' = ~(~HC + ~m + m'), applied byte by 
+ * byte. Each byte is treated as a word with only one non-zero byte, 
+ * the position of that byte depending on its position modulo N.
+ * 
+ * Note: One's complement arithmetic has two representations of zero.
+ * The result is identical to a full recalculation except for the case 
+ * that ALL bytes covered by the checksum are zero after the change. This
+ * can never happen within a ByteMessage unless its type is 0.
+ */
+
+namespace {
+    // T is the checksum type, S a type with at least twice the width of T,
+    // N is the width of the checksum in bytes (a power of two).
+    template <class T, class S, size_t N>
+    T onesum_checksum_delta(T checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length) {
+        constexpr S mask = static_cast<T>(~static_cast<T>(0));
+        constexpr uint_fast8_t width = 8 * N;
+        S sum = static_cast<T>(~checksum);
+        for (size_t i = 0; i < length; i++) {
+            const uint_fast8_t shift = 8 * (N - 1 - ((offset + i) & (N - 1)));
+            sum += static_cast<T>(~static_cast<T>(static_cast<T>(old_data[i]) << shift));
+            sum += static_cast<T>(static_cast<T>(new_data[i]) << shift);
+            // fold back carry into the sum until there is no more carry
+            while (sum >> width) {
+                sum = (sum >> width) + (sum & mask);
+            }
+        }
+        return static_cast<T>(~static_cast<T>(sum));
+    }
+}
+
+/**
+ * @brief   Update a one's complement sum over single bytes after some bytes changed
+ * @param   checksum
+ *          The checksum over the old data.
+ * @param   offset
+ *          Position of the first changed byte, relative to the start of 
+ *          the data the checksum is calculated over.
+ * @param   old_data
+ *          Pointer to the old values of the changed bytes.
+ * @param   new_data
+ *          Pointer to the new values of the changed bytes.
+ * @param   length
+ *          Number of changed bytes.
+ * @return  The checksum over the new data, identical to onesum8_checksum().
+ * @note    See the note on one's complement delta updates above.
+ */
+uint8_t onesum8_checksum_delta(uint8_t checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length) {
+    return onesum_checksum_delta<uint8_t, uint_fast16_t, 1>(checksum, offset, old_data, new_data, length);
+}
+
+/**
+ * @brief   Update a one's complement sum over pairs of bytes after some bytes changed
+ * @param   checksum
+ *          The checksum over the old data.
+ * @param   offset
+ *          Position of the first changed byte, relative to the start of 
+ *          the data the checksum is calculated over.
+ * @param   old_data
+ *          Pointer to the old values of the changed bytes.
+ * @param   new_data
+ *          Pointer to the new values of the changed bytes.
+ * @param   length
+ *          Number of changed bytes.
+ * @return  The checksum over the new data, identical to onesum16_checksum().
+ * @note    See the note on one's complement delta updates above.
+ */
+uint16_t onesum16_checksum_delta(uint16_t checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length) {
+    return onesum_checksum_delta<uint16_t, uint_fast32_t, 2>(checksum, offset, old_data, new_data, length);
+}
+
+/**
+ * @brief   Update a one's complement sum over groups of four bytes after some bytes changed
+ * @param   checksum
+ *          The checksum over the old data.
+ * @param   offset
+ *          Position of the first changed byte, relative to the start of 
+ *          the data the checksum is calculated over.
+ * @param   old_data
+ *          Pointer to the old values of the changed bytes.
+ * @param   new_data
+ *          Pointer to the new values of the changed bytes.
+ * @param   length
+ *          Number of changed bytes.
+ * @return  The checksum over the new data, identical to onesum32_checksum().
+ * @note    See the note on one's complement delta updates above.
+ */
+uint32_t onesum32_checksum_delta(uint32_t checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length) {
+    return onesum_checksum_delta<uint32_t, uint_fast64_t, 4>(checksum, offset, old_data, new_data, length);
+}
+
+/*
+ * Streaming calculation
+ * 
+ * The context holds the one's complement sum itself, not its complement.
+ * Like for the two's complement sums, the first bytes of a buffer are 
+ * added one by one until the position is a multiple of N, and the rest is
+ * handled by the one-shot function. One's complement sums of the parts add
+ * up with end-around carry. The sum is zero if and only if all bytes are 
+ * zero, exactly like for the one-shot function, so both representations 
+ * of zero come out the same.
+ */
+
+namespace {
+    // one's complement addition: fold carry back into the sum
+    template <class T>
+    T onesum_add(T a, T b) {
+        const T sum = static_cast<T>(a + b);
+        return static_cast<T>(sum + ((sum < a) ? 1 : 0));
+    }
+
+    // N is the width of the checksum in bytes, must be a power of two
+    template <class CTX, class T, size_t N, T (*FUNC)(const uint8_t*, size_t)>
+    void onesum_checksum_update(CTX &ctx, const uint8_t * data, size_t length) {
+        while (length > 0 && (ctx.length & (N - 1)) != 0) {
+            const uint_fast8_t shift = 8 * (N - 1 - (ctx.length & (N - 1)));
+            ctx.sum = onesum_add<T>(ctx.sum, static_cast<T>(static_cast<T>(*data++) << shift));
+            ctx.length++;
+            length--;
+        }
+        if (length > 0) {
+            ctx.sum = onesum_add<T>(ctx.sum, static_cast<T>(~FUNC(data, length)));
+            ctx.length += length;
+        }
+    }
+}
+
+/**
+ * @brief   Start streaming calculation of one's complement sum over single bytes
+ * @param   ctx
+ *          The context to initialize.
+ */
+void onesum8_checksum_init(onesum8_checksum_context &ctx) {
+    ctx.sum = 0;
+    ctx.length = 0;
+}
+
+/**
+ * @brief   Add bytes to streaming calculation of one's complement sum over single bytes
+ * @param   ctx
+ *          The context, initialized with onesum8_checksum_init().
+ * @param   data
+ *          Pointer to the next bytes.
+ * @param   length
+ *          Number of bytes in data.
+ */
+void onesum8_checksum_update(onesum8_checksum_context &ctx, const uint8_t * data, size_t length) {
+    onesum_checksum_update<onesum8_checksum_context, uint8_t, 1, &onesum8_checksum>(ctx, data, length);
+}
+
+/**
+ * @brief   Finish streaming calculation of one's complement sum over single bytes
+ * @param   ctx
+ *          The context.
+ * @return  The checksum value, identical to onesum8_checksum() over all 
+ *          bytes passed to onesum8_checksum_update().
+ */
+uint8_t onesum8_checksum_final(const onesum8_checksum_context &ctx) {
+    return static_cast<uint8_t>(~ctx.sum);
+}
+
+/**
+ * @brief   Start streaming calculation of one's complement sum over pairs of bytes
+ * @param   ctx
+ *          The context to initialize.
+ */
+void onesum16_checksum_init(onesum16_checksum_context &ctx) {
+    ctx.sum = 0;
+    ctx.length = 0;
+}
+
+/**
+ * @brief   Add bytes to streaming calculation of one's complement sum over pairs of bytes
+ * @param   ctx
+ *          The context, initialized with onesum16_checksum_init().
+ * @param   data
+ *          Pointer to the next bytes.
+ * @param   length
+ *          Number of bytes in data.
+ */
+void onesum16_checksum_update(onesum16_checksum_context &ctx, const uint8_t * data, size_t length) {
+    onesum_checksum_update<onesum16_checksum_context, uint16_t, 2, &onesum16_checksum>(ctx, data, length);
+}
+
+/**
+ * @brief   Finish streaming calculation of one's complement sum over pairs of bytes
+ * @param   ctx
+ *          The context.
+ * @return  The checksum value, identical to onesum16_checksum() over all 
+ *          bytes passed to onesum16_checksum_update().
+ */
+uint16_t onesum16_checksum_final(const onesum16_checksum_context &ctx) {
+    return static_cast<uint16_t>(~ctx.sum);
+}
+
+/**
+ * @brief   Start streaming calculation of one's complement sum over groups of four bytes
+ * @param   ctx
+ *          The context to initialize.
+ */
+void onesum32_checksum_init(onesum32_checksum_context &ctx) {
+    ctx.sum = 0;
+    ctx.length = 0;
+}
+
+/**
+ * @brief   Add bytes to streaming calculation of one's complement sum over groups of four bytes
+ * @param   ctx
+ *          The context, initialized with onesum32_checksum_init().
+ * @param   data
+ *          Pointer to the next bytes.
+ * @param   length
+ *          Number of bytes in data.
+ */
+void onesum32_checksum_update(onesum32_checksum_context &ctx, const uint8_t * data, size_t length) {
+    onesum_checksum_update<onesum32_checksum_context, uint32_t, 4, &onesum32_checksum>(ctx, data, length);
+}
+
+/**
+ * @brief   Finish streaming calculation of one's complement sum over groups of four bytes
+ * @param   ctx
+ *          The context.
+ * @return  The checksum value, identical to onesum32_checksum() over all 
+ *          bytes passed to onesum32_checksum_update().
+ */
+uint32_t onesum32_checksum_final(const onesum32_checksum_context &ctx) {
+    return static_cast<uint32_t>(~ctx.sum);
+}
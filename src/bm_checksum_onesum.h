@@ -49,7 +49,36 @@ uint8_t onesum8_checksum_textbook(const uint8_t * data, size_t length);
 uint16_t onesum16_checksum_textbook(const uint8_t * data, size_t length);
 uint32_t onesum32_checksum_textbook(const uint8_t * data, size_t length);
 
+// Derive new checksum from old checksum after a range of bytes changed 
+// (see RFC1624). Cost depends only on the number of changed bytes.
+uint8_t onesum8_checksum_delta(uint8_t checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length);
+uint16_t onesum16_checksum_delta(uint16_t checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length);
+uint32_t onesum32_checksum_delta(uint32_t checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length);
+
+// Calculate checksum over several buffers in a row, e.g. a ring buffer 
+// which wraps around or scatter-gather segments: call _init() once, 
+// _update() for each buffer and _final() for the result. The result is
+// identical to the checksum over all buffers joined together.
+struct onesum8_checksum_context { uint8_t sum; size_t length; };
+struct onesum16_checksum_context { uint16_t sum; size_t length; };
+struct onesum32_checksum_context { uint32_t sum; size_t length; };
+
+void onesum8_checksum_init(onesum8_checksum_context &ctx);
+void onesum8_checksum_update(onesum8_checksum_context &ctx, const uint8_t * data, size_t length);
+uint8_t onesum8_checksum_final(const onesum8_checksum_context &ctx);
+void onesum16_checksum_init(onesum16_checksum_context &ctx);
+void onesum16_checksum_update(onesum16_checksum_context &ctx, const uint8_t * data, size_t length);
+uint16_t onesum16_checksum_final(const onesum16_checksum_context &ctx);
+void onesum32_checksum_init(onesum32_checksum_context &ctx);
+void onesum32_checksum_update(onesum32_checksum_context &ctx, const uint8_t * data, size_t length);
+uint32_t onesum32_checksum_final(const onesum32_checksum_context &ctx);
+
 // aliases: one's complement sum over 16 bit is the internet checksum
 #define internet_checksum onesum16_checksum ///< alias: one's complement sum over 16 bit is also called "internet checksum" (RFC1071).
+#define internet_checksum_delta onesum16_checksum_delta ///< alias for delta update of the internet checksum
+#define internet_checksum_context onesum16_checksum_context ///< alias for streaming calculation of the internet checksum
+#define internet_checksum_init onesum16_checksum_init ///< alias for streaming calculation of the internet checksum
+#define internet_checksum_update onesum16_checksum_update ///< alias for streaming calculation of the internet checksum
+#define internet_checksum_final onesum16_checksum_final ///< alias for streaming calculation of the internet checksum
 
 #endif
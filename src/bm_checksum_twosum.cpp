@@ -31,6 +31,23 @@
  */
 
 #include "bm_checksum_twosum.h"
+#include "bm_checksum_bulk.h" // word-at-a-time and SIMD helpers
+
+#if defined(BM_CHECKSUM_BULK)
+namespace {
+    // Sum of all complete chunks, as big-endian words of N bytes, 
+    // modulo 2^64. Returns number of bytes processed.
+    template <uint_fast8_t N>
+    size_t bulk_word_sum(const uint8_t * data, size_t length, uint64_t &sum) {
+        uint64_t pos[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+        const size_t done = bm_bulk_position_sums(data, length, pos);
+        for (uint_fast8_t i = 0; i < 8; i++) {
+            sum += pos[i] << (8 * (N - 1 - (i % N)));
+        }
+        return done;
+    }
+}
+#endif
 
 /**
  * @brief   Twos's complement sum over single bytes
@@ -42,6 +59,14 @@
  */
 uint8_t sum8_checksum(const uint8_t * data, size_t length) {
     uint_fast8_t sum = 0;
+    #if defined(BM_CHECKSUM_BULK)
+    // handle large chunks first
+    uint64_t bulk = 0;
+    const size_t done = bm_bulk_byte_sum(data, length, bulk);
+    data += done;
+    length -= done;
+    sum = static_cast<uint_fast8_t>(bulk & UINT8_MAX);
+    #endif
     const uint8_t * const end = data + length;
     while (data < end) {
         sum += *data++;
@@ -60,6 +85,14 @@ uint8_t sum8_checksum(const uint8_t * data, size_t length) {
  */
 uint16_t sum16_checksum(const uint8_t * data, size_t length) {
     uint_fast16_t sum = 0;
+    #if defined(BM_CHECKSUM_BULK)
+    // handle large chunks first
+    uint64_t bulk = 0;
+    const size_t done = bulk_word_sum<2>(data, length, bulk);
+    data += done;
+    length -= done;
+    sum = static_cast<uint_fast16_t>(bulk & UINT16_MAX);
+    #endif
     const uint_fast8_t modulus = length & 0x01; // same as length % 2
     const uint8_t * const end = data + length - modulus;
     while (data < end) {
@@ -84,6 +117,14 @@ uint16_t sum16_checksum(const uint8_t * data, size_t length) {
  */
 uint32_t sum32_checksum(const uint8_t * data, size_t length) {
     uint_fast32_t sum = 0;
+    #if defined(BM_CHECKSUM_BULK)
+    // handle large chunks first
+    uint64_t bulk = 0;
+    const size_t done = bulk_word_sum<4>(data, length, bulk);
+    data += done;
+    length -= done;
+    sum = static_cast<uint_fast32_t>(bulk & UINT32_MAX);
+    #endif
     const uint_fast8_t modulus = length & 0x03; // same as length % 4
     const uint8_t * const end = data + length - modulus;
     uint_fast32_t addend;
@@ -115,6 +156,14 @@ uint32_t sum32_checksum(const uint8_t * data, size_t length) {
  */
 uint64_t sum64_checksum(const uint8_t * data, size_t length) {
     uint_fast64_t sum = 0;
+    #if defined(BM_CHECKSUM_BULK)
+    // handle large chunks first
+    uint64_t bulk = 0;
+    const size_t done = bulk_word_sum<8>(data, length, bulk);
+    data += done;
+    length -= done;
+    sum = bulk;
+    #endif
     const uint_fast8_t modulus = length & 0x07; // same as length % 8
     const uint8_t * const end = data + length - modulus;
     uint_fast64_t addend;
@@ -138,3 +187,262 @@ uint64_t sum64_checksum(const uint8_t * data, size_t length) {
     sum += addend;
     return static_cast<uint64_t>(sum & UINT64_MAX);
 }
+
+/*
+ * Delta updates
+ * 
+ * Every byte contributes (byte << shift) to the sum, shift depending on 
+ * its position modulo N. Because two's complement addition wraps around,
+ * the contribution of the old byte can simply be subtracted.
+ */
+
+namespace {
+    // N is the width of the checksum in bytes, must be a power of two
+    template <class T, size_t N>
+    T sum_checksum_delta(T checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length) {
+        for (size_t i = 0; i < length; i++) {
+            const uint_fast8_t shift = 8 * (N - 1 - ((offset + i) & (N - 1)));
+            checksum += static_cast<T>(static_cast<T>(new_data[i]) << shift);
+            checksum -= static_cast<T>(static_cast<T>(old_data[i]) << shift);
+        }
+        return checksum;
+    }
+}
+
+/**
+ * @brief   Update a two's complement sum over single bytes after some bytes changed
+ * @param   checksum
+ *          The checksum over the old data.
+ * @param   offset
+ *          Position of the first changed byte, relative to the start of 
+ *          the data the checksum is calculated over.
+ * @param   old_data
+ *          Pointer to the old values of the changed bytes.
+ * @param   new_data
+ *          Pointer to the new values of the changed bytes.
+ * @param   length
+ *          Number of changed bytes.
+ * @return  The checksum over the new data, identical to sum8_checksum().
+ */
+uint8_t sum8_checksum_delta(uint8_t checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length) {
+    return sum_checksum_delta<uint8_t, 1>(checksum, offset, old_data, new_data, length);
+}
+
+/**
+ * @brief   Update a two's complement sum over pairs of bytes after some bytes changed
+ * @param   checksum
+ *          The checksum over the old data.
+ * @param   offset
+ *          Position of the first changed byte, relative to the start of 
+ *          the data the checksum is calculated over.
+ * @param   old_data
+ *          Pointer to the old values of the changed bytes.
+ * @param   new_data
+ *          Pointer to the new values of the changed bytes.
+ * @param   length
+ *          Number of changed bytes.
+ * @return  The checksum over the new data, identical to sum16_checksum().
+ */
+uint16_t sum16_checksum_delta(uint16_t checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length) {
+    return sum_checksum_delta<uint16_t, 2>(checksum, offset, old_data, new_data, length);
+}
+
+/**
+ * @brief   Update a two's complement sum over groups of four bytes after some bytes changed
+ * @param   checksum
+ *          The checksum over the old data.
+ * @param   offset
+ *          Position of the first changed byte, relative to the start of 
+ *          the data the checksum is calculated over.
+ * @param   old_data
+ *          Pointer to the old values of the changed bytes.
+ * @param   new_data
+ *          Pointer to the new values of the changed bytes.
+ * @param   length
+ *          Number of changed bytes.
+ * @return  The checksum over the new data, identical to sum32_checksum().
+ */
+uint32_t sum32_checksum_delta(uint32_t checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length) {
+    return sum_checksum_delta<uint32_t, 4>(checksum, offset, old_data, new_data, length);
+}
+
+/**
+ * @brief   Update a two's complement sum over groups of eight bytes after some bytes changed
+ * @param   checksum
+ *          The checksum over the old data.
+ * @param   offset
+ *          Position of the first changed byte, relative to the start of 
+ *          the data the checksum is calculated over.
+ * @param   old_data
+ *          Pointer to the old values of the changed bytes.
+ * @param   new_data
+ *          Pointer to the new values of the changed bytes.
+ * @param   length
+ *          Number of changed bytes.
+ * @return  The checksum over the new data, identical to sum64_checksum().
+ */
+uint64_t sum64_checksum_delta(uint64_t checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length) {
+    return sum_checksum_delta<uint64_t, 8>(checksum, offset, old_data, new_data, length);
+}
+
+/*
+ * Streaming calculation
+ * 
+ * Same idea as for the XOR checksums: the first bytes of a buffer are 
+ * added one by one until the position is a multiple of N, the rest is 
+ * handled by the one-shot function. Two's complement sums of the parts 
+ * simply add up.
+ */
+
+namespace {
+    // N is the width of the checksum in bytes, must be a power of two
+    template <class CTX, class T, size_t N, T (*FUNC)(const uint8_t*, size_t)>
+    void sum_checksum_update(CTX &ctx, const uint8_t * data, size_t length) {
+        while (length > 0 && (ctx.length & (N - 1)) != 0) {
+            const uint_fast8_t shift = 8 * (N - 1 - (ctx.length & (N - 1)));
+            ctx.sum += static_cast<T>(static_cast<T>(*data++) << shift);
+            ctx.length++;
+            length--;
+        }
+        if (length > 0) {
+            ctx.sum += FUNC(data, length);
+            ctx.length += length;
+        }
+    }
+}
+
+/**
+ * @brief   Start streaming calculation of two's complement sum over single bytes
+ * @param   ctx
+ *          The context to initialize.
+ */
+void sum8_checksum_init(sum8_checksum_context &ctx) {
+    ctx.sum = 0;
+    ctx.length = 0;
+}
+
+/**
+ * @brief   Add bytes to streaming calculation of two's complement sum over single bytes
+ * @param   ctx
+ *          The context, initialized with sum8_checksum_init().
+ * @param   data
+ *          Pointer to the next bytes.
+ * @param   length
+ *          Number of bytes in data.
+ */
+void sum8_checksum_update(sum8_checksum_context &ctx, const uint8_t * data, size_t length) {
+    sum_checksum_update<sum8_checksum_context, uint8_t, 1, &sum8_checksum>(ctx, data, length);
+}
+
+/**
+ * @brief   Finish streaming calculation of two's complement sum over single bytes
+ * @param   ctx
+ *          The context.
+ * @return  The checksum value, identical to sum8_checksum() over all 
+ *          bytes passed to sum8_checksum_update().
+ */
+uint8_t sum8_checksum_final(const sum8_checksum_context &ctx) {
+    return ctx.sum;
+}
+
+/**
+ * @brief   Start streaming calculation of two's complement sum over pairs of bytes
+ * @param   ctx
+ *          The context to initialize.
+ */
+void sum16_checksum_init(sum16_checksum_context &ctx) {
+    ctx.sum = 0;
+    ctx.length = 0;
+}
+
+/**
+ * @brief   Add bytes to streaming calculation of two's complement sum over pairs of bytes
+ * @param   ctx
+ *          The context, initialized with sum16_checksum_init().
+ * @param   data
+ *          Pointer to the next bytes.
+ * @param   length
+ *          Number of bytes in data.
+ */
+void sum16_checksum_update(sum16_checksum_context &ctx, const uint8_t * data, size_t length) {
+    sum_checksum_update<sum16_checksum_context, uint16_t, 2, &sum16_checksum>(ctx, data, length);
+}
+
+/**
+ * @brief   Finish streaming calculation of two's complement sum over pairs of bytes
+ * @param   ctx
+ *          The context.
+ * @return  The checksum value, identical to sum16_checksum() over all 
+ *          bytes passed to sum16_checksum_update().
+ */
+uint16_t sum16_checksum_final(const sum16_checksum_context &ctx) {
+    return ctx.sum;
+}
+
+/**
+ * @brief   Start streaming calculation of two's complement sum over groups of four bytes
+ * @param   ctx
+ *          The context to initialize.
+ */
+void sum32_checksum_init(sum32_checksum_context &ctx) {
+    ctx.sum = 0;
+    ctx.length = 0;
+}
+
+/**
+ * @brief   Add bytes to streaming calculation of two's complement sum over groups of four bytes
+ * @param   ctx
+ *          The context, initialized with sum32_checksum_init().
+ * @param   data
+ *          Pointer to the next bytes.
+ * @param   length
+ *          Number of bytes in data.
+ */
+void sum32_checksum_update(sum32_checksum_context &ctx, const uint8_t * data, size_t length) {
+    sum_checksum_update<sum32_checksum_context, uint32_t, 4, &sum32_checksum>(ctx, data, length);
+}
+
+/**
+ * @brief   Finish streaming calculation of two's complement sum over groups of four bytes
+ * @param   ctx
+ *          The context.
+ * @return  The checksum value, identical to sum32_checksum() over all 
+ *          bytes passed to sum32_checksum_update().
+ */
+uint32_t sum32_checksum_final(const sum32_checksum_context &ctx) {
+    return ctx.sum;
+}
+
+/**
+ * @brief   Start streaming calculation of two's complement sum over groups of eight bytes
+ * @param   ctx
+ *          The context to initialize.
+ */
+void sum64_checksum_init(sum64_checksum_context &ctx) {
+    ctx.sum = 0;
+    ctx.length = 0;
+}
+
+/**
+ * @brief   Add bytes to streaming calculation of two's complement sum over groups of eight bytes
+ * @param   ctx
+ *          The context, initialized with sum64_checksum_init().
+ * @param   data
+ *          Pointer to the next bytes.
+ * @param   length
+ *          Number of bytes in data.
+ */
+void sum64_checksum_update(sum64_checksum_context &ctx, const uint8_t * data, size_t length) {
+    sum_checksum_update<sum64_checksum_context, uint64_t, 8, &sum64_checksum>(ctx, data, length);
+}
+
+/**
+ * @brief   Finish streaming calculation of two's complement sum over groups of eight bytes
+ * @param   ctx
+ *          The context.
+ * @return  The checksum value, identical to sum64_checksum() over all 
+ *          bytes passed to sum64_checksum_update().
+ */
+uint64_t sum64_checksum_final(const sum64_checksum_context &ctx) {
+    return ctx.sum;
+}
@@ -42,4 +42,33 @@ uint16_t sum16_checksum(const uint8_t * data, size_t length);
 uint32_t sum32_checksum(const uint8_t * data, size_t length);
 uint64_t sum64_checksum(const uint8_t * data, size_t length);
 
+// Derive new checksum from old checksum after a range of bytes changed.
+// Cost depends only on the number of changed bytes.
+uint8_t sum8_checksum_delta(uint8_t checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length);
+uint16_t sum16_checksum_delta(uint16_t checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length);
+uint32_t sum32_checksum_delta(uint32_t checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length);
+uint64_t sum64_checksum_delta(uint64_t checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length);
+
+// Calculate checksum over several buffers in a row, e.g. a ring buffer 
+// which wraps around or scatter-gather segments: call _init() once, 
+// _update() for each buffer and _final() for the result. The result is
+// identical to the checksum over all buffers joined together.
+struct sum8_checksum_context { uint8_t sum; size_t length; };
+struct sum16_checksum_context { uint16_t sum; size_t length; };
+struct sum32_checksum_context { uint32_t sum; size_t length; };
+struct sum64_checksum_context { uint64_t sum; size_t length; };
+
+void sum8_checksum_init(sum8_checksum_context &ctx);
+void sum8_checksum_update(sum8_checksum_context &ctx, const uint8_t * data, size_t length);
+uint8_t sum8_checksum_final(const sum8_checksum_context &ctx);
+void sum16_checksum_init(sum16_checksum_context &ctx);
+void sum16_checksum_update(sum16_checksum_context &ctx, const uint8_t * data, size_t length);
+uint16_t sum16_checksum_final(const sum16_checksum_context &ctx);
+void sum32_checksum_init(sum32_checksum_context &ctx);
+void sum32_checksum_update(sum32_checksum_context &ctx, const uint8_t * data, size_t length);
+uint32_t sum32_checksum_final(const sum32_checksum_context &ctx);
+void sum64_checksum_init(sum64_checksum_context &ctx);
+void sum64_checksum_update(sum64_checksum_context &ctx, const uint8_t * data, size_t length);
+uint64_t sum64_checksum_final(const sum64_checksum_context &ctx);
+
 #endif
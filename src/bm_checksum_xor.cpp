@@ -31,6 +31,7 @@
  */
 
 #include "bm_checksum_xor.h"
+#include "bm_checksum_bulk.h" // word-at-a-time and SIMD helpers
 
 /**
  * @brief   Simple XOR checksum over single bytes
@@ -42,6 +43,14 @@
  */
 uint8_t xor8_checksum(const uint8_t * data, size_t length) {
     uint_fast8_t sum = 0;
+    #if defined(BM_CHECKSUM_BULK)
+    // handle large chunks first
+    uint8_t lanes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    const size_t done = bm_bulk_xor_lanes(data, length, lanes);
+    data += done;
+    length -= done;
+    for (uint_fast8_t i = 0; i < 8; i++) sum ^= lanes[i];
+    #endif
     const uint8_t * const end = data + length;
     while (data < end) {
         sum ^= static_cast<uint_fast8_t>(*data++);
@@ -61,6 +70,15 @@ uint8_t xor8_checksum(const uint8_t * data, size_t length) {
 uint16_t xor16_checksum(const uint8_t * data, size_t length) {
     uint_fast8_t sum_msb = 0;
     uint_fast8_t sum_lsb = 0;
+    #if defined(BM_CHECKSUM_BULK)
+    // handle large chunks first
+    uint8_t lanes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    const size_t done = bm_bulk_xor_lanes(data, length, lanes);
+    data += done;
+    length -= done;
+    sum_msb = lanes[0] ^ lanes[2] ^ lanes[4] ^ lanes[6];
+    sum_lsb = lanes[1] ^ lanes[3] ^ lanes[5] ^ lanes[7];
+    #endif
     const uint_fast8_t modulus = length & 0x01; // same as length % 2
     const uint8_t * const end = data + length - modulus;
     // independently XOR together bytes for all complete two-byte-blocks
@@ -87,6 +105,14 @@ uint16_t xor16_checksum(const uint8_t * data, size_t length) {
  */
 uint32_t xor32_checksum(const uint8_t * data, size_t length) {
     uint_fast8_t sum[4] = {0, 0, 0, 0};
+    #if defined(BM_CHECKSUM_BULK)
+    // handle large chunks first
+    uint8_t lanes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    const size_t done = bm_bulk_xor_lanes(data, length, lanes);
+    data += done;
+    length -= done;
+    for (uint_fast8_t i = 0; i < 4; i++) sum[i] = lanes[i] ^ lanes[i+4];
+    #endif
     const uint_fast8_t modulus = length & 0x03; // same as length % 4
     const uint8_t * const end = data + length - modulus;
     // independently XOR together bytes for all complete four-byte-blocks
@@ -118,6 +144,14 @@ uint32_t xor32_checksum(const uint8_t * data, size_t length) {
  */
 uint64_t xor64_checksum(const uint8_t * data, size_t length) {
     uint_fast8_t sum[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    #if defined(BM_CHECKSUM_BULK)
+    // handle large chunks first
+    uint8_t lanes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    const size_t done = bm_bulk_xor_lanes(data, length, lanes);
+    data += done;
+    length -= done;
+    for (uint_fast8_t i = 0; i < 8; i++) sum[i] = lanes[i];
+    #endif
     const uint_fast8_t modulus = length & 0x07; // same as length % 8
     const uint8_t * const end = data + length - modulus;
     // independently XOR together bytes for all complete four-byte-blocks
@@ -145,3 +179,261 @@ uint64_t xor64_checksum(const uint8_t * data, size_t length) {
            static_cast<uint64_t>(sum[6]) <<  8 | 
            static_cast<uint64_t>(sum[7]);
 }
+
+/*
+ * Delta updates
+ * 
+ * Every byte is XORed into one of N lanes, depending on its position
+ * modulo N. Changing a byte from a to b therefore changes its lane by
+ * a XOR b, independent of all other bytes.
+ */
+
+namespace {
+    // N is the width of the checksum in bytes, must be a power of two
+    template <class T, size_t N>
+    T xor_checksum_delta(T checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length) {
+        for (size_t i = 0; i < length; i++) {
+            const uint_fast8_t shift = 8 * (N - 1 - ((offset + i) & (N - 1)));
+            checksum ^= static_cast<T>(static_cast<T>(old_data[i] ^ new_data[i]) << shift);
+        }
+        return checksum;
+    }
+}
+
+/**
+ * @brief   Update a XOR checksum over single bytes after some bytes changed
+ * @param   checksum
+ *          The checksum over the old data.
+ * @param   offset
+ *          Position of the first changed byte, relative to the start of 
+ *          the data the checksum is calculated over.
+ * @param   old_data
+ *          Pointer to the old values of the changed bytes.
+ * @param   new_data
+ *          Pointer to the new values of the changed bytes.
+ * @param   length
+ *          Number of changed bytes.
+ * @return  The checksum over the new data, identical to xor8_checksum().
+ */
+uint8_t xor8_checksum_delta(uint8_t checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length) {
+    return xor_checksum_delta<uint8_t, 1>(checksum, offset, old_data, new_data, length);
+}
+
+/**
+ * @brief   Update a XOR checksum over pairs of bytes after some bytes changed
+ * @param   checksum
+ *          The checksum over the old data.
+ * @param   offset
+ *          Position of the first changed byte, relative to the start of 
+ *          the data the checksum is calculated over.
+ * @param   old_data
+ *          Pointer to the old values of the changed bytes.
+ * @param   new_data
+ *          Pointer to the new values of the changed bytes.
+ * @param   length
+ *          Number of changed bytes.
+ * @return  The checksum over the new data, identical to xor16_checksum().
+ */
+uint16_t xor16_checksum_delta(uint16_t checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length) {
+    return xor_checksum_delta<uint16_t, 2>(checksum, offset, old_data, new_data, length);
+}
+
+/**
+ * @brief   Update a XOR checksum over groups of four bytes after some bytes changed
+ * @param   checksum
+ *          The checksum over the old data.
+ * @param   offset
+ *          Position of the first changed byte, relative to the start of 
+ *          the data the checksum is calculated over.
+ * @param   old_data
+ *          Pointer to the old values of the changed bytes.
+ * @param   new_data
+ *          Pointer to the new values of the changed bytes.
+ * @param   length
+ *          Number of changed bytes.
+ * @return  The checksum over the new data, identical to xor32_checksum().
+ */
+uint32_t xor32_checksum_delta(uint32_t checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length) {
+    return xor_checksum_delta<uint32_t, 4>(checksum, offset, old_data, new_data, length);
+}
+
+/**
+ * @brief   Update a XOR checksum over groups of eight bytes after some bytes changed
+ * @param   checksum
+ *          The checksum over the old data.
+ * @param   offset
+ *          Position of the first changed byte, relative to the start of 
+ *          the data the checksum is calculated over.
+ * @param   old_data
+ *          Pointer to the old values of the changed bytes.
+ * @param   new_data
+ *          Pointer to the new values of the changed bytes.
+ * @param   length
+ *          Number of changed bytes.
+ * @return  The checksum over the new data, identical to xor64_checksum().
+ */
+uint64_t xor64_checksum_delta(uint64_t checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length) {
+    return xor_checksum_delta<uint64_t, 8>(checksum, offset, old_data, new_data, length);
+}
+
+/*
+ * Streaming calculation
+ * 
+ * Bytes are XORed into the lanes given by their position modulo N. The 
+ * first bytes of a buffer are handled one by one until the position is a
+ * multiple of N. The rest starts with lane 0, so the one-shot function
+ * (with all its optimizations) can be used for it.
+ */
+
+namespace {
+    // N is the width of the checksum in bytes, must be a power of two
+    template <class CTX, class T, size_t N, T (*FUNC)(const uint8_t*, size_t)>
+    void xor_checksum_update(CTX &ctx, const uint8_t * data, size_t length) {
+        while (length > 0 && (ctx.length & (N - 1)) != 0) {
+            const uint_fast8_t shift = 8 * (N - 1 - (ctx.length & (N - 1)));
+            ctx.sum ^= static_cast<T>(static_cast<T>(*data++) << shift);
+            ctx.length++;
+            length--;
+        }
+        if (length > 0) {
+            ctx.sum ^= FUNC(data, length);
+            ctx.length += length;
+        }
+    }
+}
+
+/**
+ * @brief   Start streaming calculation of XOR checksum over single bytes
+ * @param   ctx
+ *          The context to initialize.
+ */
+void xor8_checksum_init(xor8_checksum_context &ctx) {
+    ctx.sum = 0;
+    ctx.length = 0;
+}
+
+/**
+ * @brief   Add bytes to streaming calculation of XOR checksum over single bytes
+ * @param   ctx
+ *          The context, initialized with xor8_checksum_init().
+ * @param   data
+ *          Pointer to the next bytes.
+ * @param   length
+ *          Number of bytes in data.
+ */
+void xor8_checksum_update(xor8_checksum_context &ctx, const uint8_t * data, size_t length) {
+    xor_checksum_update<xor8_checksum_context, uint8_t, 1, &xor8_checksum>(ctx, data, length);
+}
+
+/**
+ * @brief   Finish streaming calculation of XOR checksum over single bytes
+ * @param   ctx
+ *          The context.
+ * @return  The checksum value, identical to xor8_checksum() over all 
+ *          bytes passed to xor8_checksum_update().
+ */
+uint8_t xor8_checksum_final(const xor8_checksum_context &ctx) {
+    return ctx.sum;
+}
+
+/**
+ * @brief   Start streaming calculation of XOR checksum over pairs of bytes
+ * @param   ctx
+ *          The context to initialize.
+ */
+void xor16_checksum_init(xor16_checksum_context &ctx) {
+    ctx.sum = 0;
+    ctx.length = 0;
+}
+
+/**
+ * @brief   Add bytes to streaming calculation of XOR checksum over pairs of bytes
+ * @param   ctx
+ *          The context, initialized with xor16_checksum_init().
+ * @param   data
+ *          Pointer to the next bytes.
+ * @param   length
+ *          Number of bytes in data.
+ */
+void xor16_checksum_update(xor16_checksum_context &ctx, const uint8_t * data, size_t length) {
+    xor_checksum_update<xor16_checksum_context, uint16_t, 2, &xor16_checksum>(ctx, data, length);
+}
+
+/**
+ * @brief   Finish streaming calculation of XOR checksum over pairs of bytes
+ * @param   ctx
+ *          The context.
+ * @return  The checksum value, identical to xor16_checksum() over all 
+ *          bytes passed to xor16_checksum_update().
+ */
+uint16_t xor16_checksum_final(const xor16_checksum_context &ctx) {
+    return ctx.sum;
+}
+
+/**
+ * @brief   Start streaming calculation of XOR checksum over groups of four bytes
+ * @param   ctx
+ *          The context to initialize.
+ */
+void xor32_checksum_init(xor32_checksum_context &ctx) {
+    ctx.sum = 0;
+    ctx.length = 0;
+}
+
+/**
+ * @brief   Add bytes to streaming calculation of XOR checksum over groups of four bytes
+ * @param   ctx
+ *          The context, initialized with xor32_checksum_init().
+ * @param   data
+ *          Pointer to the next bytes.
+ * @param   length
+ *          Number of bytes in data.
+ */
+void xor32_checksum_update(xor32_checksum_context &ctx, const uint8_t * data, size_t length) {
+    xor_checksum_update<xor32_checksum_context, uint32_t, 4, &xor32_checksum>(ctx, data, length);
+}
+
+/**
+ * @brief   Finish streaming calculation of XOR checksum over groups of four bytes
+ * @param   ctx
+ *          The context.
+ * @return  The checksum value, identical to xor32_checksum() over all 
+ *          bytes passed to xor32_checksum_update().
+ */
+uint32_t xor32_checksum_final(const xor32_checksum_context &ctx) {
+    return ctx.sum;
+}
+
+/**
+ * @brief   Start streaming calculation of XOR checksum over groups of eight bytes
+ * @param   ctx
+ *          The context to initialize.
+ */
+void xor64_checksum_init(xor64_checksum_context &ctx) {
+    ctx.sum = 0;
+    ctx.length = 0;
+}
+
+/**
+ * @brief   Add bytes to streaming calculation of XOR checksum over groups of eight bytes
+ * @param   ctx
+ *          The context, initialized with xor64_checksum_init().
+ * @param   data
+ *          Pointer to the next bytes.
+ * @param   length
+ *          Number of bytes in data.
+ */
+void xor64_checksum_update(xor64_checksum_context &ctx, const uint8_t * data, size_t length) {
+    xor_checksum_update<xor64_checksum_context, uint64_t, 8, &xor64_checksum>(ctx, data, length);
+}
+
+/**
+ * @brief   Finish streaming calculation of XOR checksum over groups of eight bytes
+ * @param   ctx
+ *          The context.
+ * @return  The checksum value, identical to xor64_checksum() over all 
+ *          bytes passed to xor64_checksum_update().
+ */
+uint64_t xor64_checksum_final(const xor64_checksum_context &ctx) {
+    return ctx.sum;
+}
@@ -41,4 +41,33 @@ uint16_t xor16_checksum(const uint8_t * data, size_t length);
 uint32_t xor32_checksum(const uint8_t * data, size_t length);
 uint64_t xor64_checksum(const uint8_t * data, size_t length);
 
+// Derive new checksum from old checksum after a range of bytes changed.
+// Cost depends only on the number of changed bytes.
+uint8_t xor8_checksum_delta(uint8_t checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length);
+uint16_t xor16_checksum_delta(uint16_t checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length);
+uint32_t xor32_checksum_delta(uint32_t checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length);
+uint64_t xor64_checksum_delta(uint64_t checksum, size_t offset, const uint8_t * old_data, const uint8_t * new_data, size_t length);
+
+// Calculate checksum over several buffers in a row, e.g. a ring buffer 
+// which wraps around or scatter-gather segments: call _init() once, 
+// _update() for each buffer and _final() for the result. The result is
+// identical to the checksum over all buffers joined together.
+struct xor8_checksum_context { uint8_t sum; size_t length; };
+struct xor16_checksum_context { uint16_t sum; size_t length; };
+struct xor32_checksum_context { uint32_t sum; size_t length; };
+struct xor64_checksum_context { uint64_t sum; size_t length; };
+
+void xor8_checksum_init(xor8_checksum_context &ctx);
+void xor8_checksum_update(xor8_checksum_context &ctx, const uint8_t * data, size_t length);
+uint8_t xor8_checksum_final(const xor8_checksum_context &ctx);
+void xor16_checksum_init(xor16_checksum_context &ctx);
+void xor16_checksum_update(xor16_checksum_context &ctx, const uint8_t * data, size_t length);
+uint16_t xor16_checksum_final(const xor16_checksum_context &ctx);
+void xor32_checksum_init(xor32_checksum_context &ctx);
+void xor32_checksum_update(xor32_checksum_context &ctx, const uint8_t * data, size_t length);
+uint32_t xor32_checksum_final(const xor32_checksum_context &ctx);
+void xor64_checksum_init(xor64_checksum_context &ctx);
+void xor64_checksum_update(xor64_checksum_context &ctx, const uint8_t * data, size_t length);
+uint64_t xor64_checksum_final(const xor64_checksum_context &ctx);
+
 #endif